@@ -1,10 +1,13 @@
 # Usage:
-# cmake -P GenerateMappings.cmake <path/to/mappings.h.in> <path/to/mappings.h>
+# cmake -P GenerateMappings.cmake <path/to/mappings.h.in> <path/to/mappings.h> [path/to/gamecontrollerdb.txt]
+#
+# The mappings are compiled into sorted tables of _GLFWmapping records so that
+# GLFW does not need to parse them at run-time.  If no local copy of the
+# database is specified, the latest version is downloaded.
 
 cmake_policy(VERSION 3.16)
 
 set(source_url "https://raw.githubusercontent.com/gabomdq/SDL_GameControllerDB/master/gamecontrollerdb.txt")
-set(source_path "${CMAKE_CURRENT_BINARY_DIR}/gamecontrollerdb.txt")
 set(template_path "${CMAKE_ARGV3}")
 set(target_path "${CMAKE_ARGV4}")
 
@@ -12,39 +15,195 @@ if (NOT EXISTS "${template_path}")
     message(FATAL_ERROR "Failed to find template file ${template_path}")
 endif()
 
-file(DOWNLOAD "${source_url}" "${source_path}"
-     STATUS download_status
-     TLS_VERIFY on)
+if (CMAKE_ARGV5)
+    set(source_path "${CMAKE_ARGV5}")
+else()
+    set(source_path "${CMAKE_CURRENT_BINARY_DIR}/gamecontrollerdb.txt")
 
-list(GET download_status 0 status_code)
-list(GET download_status 1 status_message)
+    file(DOWNLOAD "${source_url}" "${source_path}"
+         STATUS download_status
+         TLS_VERIFY on)
 
-if (status_code)
-    message(FATAL_ERROR "Failed to download ${source_url}: ${status_message}")
+    list(GET download_status 0 status_code)
+    list(GET download_status 1 status_message)
+
+    if (status_code)
+        message(FATAL_ERROR "Failed to download ${source_url}: ${status_message}")
+    endif()
 endif()
 
+set(button_names a b x y leftshoulder rightshoulder back start guide
+    leftstick rightstick dpup dpright dpdown dpleft)
+set(axis_names leftx lefty rightx righty lefttrigger righttrigger)
+
+# Compiles an element binding like b3, h0.4, +a2 or a5~ into a _GLFWmapelement
+# initializer the same way parseMapping in input.c does
+function(compile_element binding output)
+    set(minimum -1)
+    set(maximum 1)
+
+    if (binding MATCHES "^\\+(.*)$")
+        set(minimum 0)
+        set(binding "${CMAKE_MATCH_1}")
+    elseif (binding MATCHES "^-(.*)$")
+        set(maximum 0)
+        set(binding "${CMAKE_MATCH_1}")
+    endif()
+
+    if (binding MATCHES "^a([0-9]*)(~?)")
+        set(invert "${CMAKE_MATCH_2}")
+        math(EXPR index "0${CMAKE_MATCH_1} & 255")
+        math(EXPR scale "2 / (${maximum} - ${minimum})")
+        math(EXPR offset "-(${maximum} + ${minimum})")
+        if (invert)
+            math(EXPR scale "-${scale}")
+            math(EXPR offset "-(${offset})")
+        endif()
+        set(${output} "{1,${index},${scale},${offset}}" PARENT_SCOPE)
+    elseif (binding MATCHES "^b([0-9]*)")
+        math(EXPR index "0${CMAKE_MATCH_1} & 255")
+        set(${output} "{2,${index},0,0}" PARENT_SCOPE)
+    elseif (binding MATCHES "^h([0-9]*)\\.?([0-9]*)")
+        math(EXPR index "((0${CMAKE_MATCH_1} << 4) | 0${CMAKE_MATCH_2}) & 255")
+        set(${output} "{3,${index},0,0}" PARENT_SCOPE)
+    endif()
+endfunction()
+
+# Compiles an SDL_GameControllerDB line into a _GLFWmapping initializer, with
+# the GUID converted to the form used by the specified platform, or sets the
+# output variables to empty strings if the line is not a valid mapping
+function(compile_mapping line platform output_guid output_record)
+    set(${output_guid} "" PARENT_SCOPE)
+    set(${output_record} "" PARENT_SCOPE)
+
+    if (NOT line MATCHES "^([0-9a-fA-F]+),([^,]*),(.*)$")
+        return()
+    endif()
+
+    string(TOLOWER "${CMAKE_MATCH_1}" guid)
+    set(name "${CMAKE_MATCH_2}")
+    string(REPLACE "," ";" fields "${CMAKE_MATCH_3}")
+
+    string(LENGTH "${guid}" guid_length)
+    string(LENGTH "${name}" name_length)
+    if (NOT guid_length EQUAL 32 OR name_length GREATER_EQUAL 128)
+        return()
+    endif()
+
+    foreach(element IN LISTS button_names axis_names)
+        set(element_${element} "{0,0,0,0}")
+    endforeach()
+
+    foreach(field IN LISTS fields)
+        # Output modifiers are not supported
+        if (field MATCHES "^[+-]")
+            return()
+        endif()
+
+        if (field MATCHES "^([a-z]+):(.*)$")
+            set(element "${CMAKE_MATCH_1}")
+            set(binding "${CMAKE_MATCH_2}")
+            if (element IN_LIST button_names OR element IN_LIST axis_names)
+                compile_element("${binding}" element_${element})
+            endif()
+        endif()
+    endforeach()
+
+    string(SUBSTRING "${guid}" 0 4 vendor)
+    string(SUBSTRING "${guid}" 4 4 product)
+    string(SUBSTRING "${guid}" 4 12 middle)
+    string(SUBSTRING "${guid}" 16 4 cocoa_product)
+    string(SUBSTRING "${guid}" 20 12 tail)
+
+    # These match the _glfwUpdateGamepadGUID functions of each platform
+    if (platform STREQUAL "Windows" AND tail STREQUAL "504944564944")
+        set(guid "03000000${vendor}0000${product}000000000000")
+    elseif (platform STREQUAL "Mac OS X" AND
+            middle STREQUAL "000000000000" AND tail STREQUAL "000000000000")
+        set(guid "03000000${vendor}0000${cocoa_product}000000000000")
+    endif()
+
+    string(REPLACE "\\" "\\\\" name "${name}")
+    string(REPLACE "\"" "\\\"" name "${name}")
+
+    set(buttons "")
+    foreach(element IN LISTS button_names)
+        list(APPEND buttons "${element_${element}}")
+    endforeach()
+    list(JOIN buttons "," buttons)
+
+    set(axes "")
+    foreach(element IN LISTS axis_names)
+        list(APPEND axes "${element_${element}}")
+    endforeach()
+    list(JOIN axes "," axes)
+
+    set(${output_guid} "${guid}" PARENT_SCOPE)
+    set(${output_record} "{\"${name}\",\"${guid}\",{${buttons}},{${axes}}}," PARENT_SCOPE)
+endfunction()
+
+# Compiles the mapping lines of a platform into records sorted by GUID, with
+# only the first mapping of each GUID kept
+function(compile_mappings lines platform output)
+    set(guids "")
+    set(entries "")
+
+    foreach(line IN LISTS lines)
+        compile_mapping("${line}" "${platform}" guid record)
+        if (NOT guid STREQUAL "" AND NOT guid IN_LIST guids)
+            list(APPEND guids "${guid}")
+            list(APPEND entries "${guid}${record}")
+        endif()
+    endforeach()
+
+    list(SORT entries)
+
+    set(records "")
+    foreach(entry IN LISTS entries)
+        string(SUBSTRING "${entry}" 32 -1 record)
+        if (records)
+            string(APPEND records "\n")
+        endif()
+        string(APPEND records "${record}")
+    endforeach()
+
+    set(${output} "${records}" PARENT_SCOPE)
+endfunction()
+
 file(STRINGS "${source_path}" lines)
 list(FILTER lines INCLUDE REGEX "^[0-9a-fA-F]")
 
+# GLFW specific mappings are listed in the template as quoted lines and are
+# compiled together with the upstream ones
+file(STRINGS "${template_path}" glfw_lines REGEX "^\"[0-9a-fA-F]+,.*\",$")
+foreach(line IN LISTS glfw_lines)
+    string(REGEX REPLACE "^\"(.*)\",$" "\\1" line "${line}")
+    list(APPEND lines "${line}")
+endforeach()
+
+set(win32_lines "")
+set(cocoa_lines "")
+set(linux_lines "")
+
 foreach(line IN LISTS lines)
     if (line MATCHES "platform:Windows")
-        if (GLFW_WIN32_MAPPINGS)
-            string(APPEND GLFW_WIN32_MAPPINGS "\n")
-        endif()
-        string(APPEND GLFW_WIN32_MAPPINGS "\"${line}\",")
+        list(APPEND win32_lines "${line}")
     elseif (line MATCHES "platform:Mac OS X")
-        if (GLFW_COCOA_MAPPINGS)
-            string(APPEND GLFW_COCOA_MAPPINGS "\n")
-        endif()
-        string(APPEND GLFW_COCOA_MAPPINGS "\"${line}\",")
+        list(APPEND cocoa_lines "${line}")
     elseif (line MATCHES "platform:Linux")
-        if (GLFW_LINUX_MAPPINGS)
-            string(APPEND GLFW_LINUX_MAPPINGS "\n")
-        endif()
-        string(APPEND GLFW_LINUX_MAPPINGS "\"${line}\",")
+        list(APPEND linux_lines "${line}")
     endif()
 endforeach()
 
-configure_file("${template_path}" "${target_path}" @ONLY NEWLINE_STYLE UNIX)
-file(REMOVE "${source_path}")
+compile_mappings("${win32_lines}" "Windows" GLFW_WIN32_MAPPINGS)
+compile_mappings("${cocoa_lines}" "Mac OS X" GLFW_COCOA_MAPPINGS)
+compile_mappings("${linux_lines}" "Linux" GLFW_LINUX_MAPPINGS)
 
+file(READ "${template_path}" template)
+string(REGEX REPLACE "\n\"[0-9a-fA-F]+,[^\n]*\"," "" template "${template}")
+string(CONFIGURE "${template}" content @ONLY)
+file(WRITE "${target_path}" "${content}")
+
+if (NOT CMAKE_ARGV5)
+    file(REMOVE "${source_path}")
+endif()
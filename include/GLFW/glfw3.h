@@ -1155,6 +1155,8 @@ extern "C" {
 #define GLFW_LOCK_KEY_MODS           0x00033004
 #define GLFW_RAW_MOUSE_MOTION        0x00033005
 #define GLFW_UNLIMITED_MOUSE_BUTTONS 0x00033006
+#define GLFW_EVENT_BATCH             0x00033007
+#define GLFW_COALESCE_CURSOR_MOTION  0x00033008
 
 #define GLFW_CURSOR_NORMAL          0x00034001
 #define GLFW_CURSOR_HIDDEN          0x00034002
@@ -1291,6 +1293,31 @@ extern "C" {
 #define GLFW_CONNECTED              0x00040001
 #define GLFW_DISCONNECTED           0x00040002
 
+/*! @defgroup event_types Event types
+ *  @brief Types of events in an event batch.
+ *
+ *  These are the types of [batched events](@ref event_batch) reported by
+ *  @ref glfwGetEventBatch.  Each corresponds to the callback of the same name.
+ *
+ *  @ingroup window
+ *  @{ */
+#define GLFW_EVENT_KEY                  0x00039001
+#define GLFW_EVENT_CHAR                 0x00039002
+#define GLFW_EVENT_MOUSE_BUTTON         0x00039003
+#define GLFW_EVENT_CURSOR_POS           0x00039004
+#define GLFW_EVENT_CURSOR_ENTER         0x00039005
+#define GLFW_EVENT_SCROLL               0x00039006
+#define GLFW_EVENT_WINDOW_POS           0x00039007
+#define GLFW_EVENT_WINDOW_SIZE          0x00039008
+#define GLFW_EVENT_WINDOW_CLOSE         0x00039009
+#define GLFW_EVENT_WINDOW_REFRESH       0x0003900A
+#define GLFW_EVENT_WINDOW_FOCUS         0x0003900B
+#define GLFW_EVENT_WINDOW_ICONIFY       0x0003900C
+#define GLFW_EVENT_WINDOW_MAXIMIZE      0x0003900D
+#define GLFW_EVENT_FRAMEBUFFER_SIZE     0x0003900E
+#define GLFW_EVENT_WINDOW_CONTENT_SCALE 0x0003900F
+/*! @} */
+
 /*! @addtogroup init
  *  @{ */
 /*! @brief Joystick hat buttons init hint.
@@ -1308,6 +1335,16 @@ extern "C" {
  *  Platform selection [init hint](@ref GLFW_PLATFORM).
  */
 #define GLFW_PLATFORM               0x00050003
+/*! @brief Cursor cache size init hint.
+ *
+ *  Cursor cache size [init hint](@ref GLFW_CURSOR_CACHE_LIMIT_hint).
+ */
+#define GLFW_CURSOR_CACHE_LIMIT     0x00050004
+/*! @brief Standard cursor preloading init hint.
+ *
+ *  Standard cursor preloading [init hint](@ref GLFW_PRELOAD_STANDARD_CURSORS_hint).
+ */
+#define GLFW_PRELOAD_STANDARD_CURSORS 0x00050005
 /*! @brief macOS specific init hint.
  *
  *  macOS specific [init hint](@ref GLFW_COCOA_CHDIR_RESOURCES_hint).
@@ -1969,6 +2006,81 @@ typedef void (* GLFWcharmodsfun)(GLFWwindow* window, unsigned int codepoint, int
  */
 typedef void (* GLFWdropfun)(GLFWwindow* window, int path_count, const char* paths[]);
 
+/*! @brief The function pointer type for path drop stream callbacks.
+ *
+ *  This is the function pointer type for path drop stream callbacks.  A path
+ *  drop stream callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWwindow* window, int path_count, const char* paths[], int last)
+ *  @endcode
+ *
+ *  @param[in] window The window that received the event.
+ *  @param[in] path_count The number of dropped paths in this chunk.
+ *  @param[in] paths The UTF-8 encoded file and/or directory path names.
+ *  @param[in] last `GLFW_TRUE` if this is the last chunk of the drop, or
+ *  `GLFW_FALSE` if more paths will follow.
+ *
+ *  @pointer_lifetime The path array and its strings are valid until the
+ *  callback function returns.
+ *
+ *  @sa @ref path_drop
+ *  @sa @ref glfwSetDropStreamCallback
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWdropstreamfun)(GLFWwindow* window, int path_count, const char* paths[], int last);
+
+/*! @brief The function pointer type for clipboard string callbacks.
+ *
+ *  This is the function pointer type for clipboard string callbacks.
+ *  A clipboard string callback function has the following signature:
+ *  @code
+ *  void function_name(GLFWwindow* window, const char* string)
+ *  @endcode
+ *
+ *  @param[in] window The window that requested the clipboard contents.
+ *  @param[in] string The contents of the clipboard as a UTF-8 encoded string,
+ *  or `NULL` if the clipboard was empty, its contents could not be converted or
+ *  the request timed out.
+ *
+ *  @pointer_lifetime The string is valid until the callback function returns.
+ *
+ *  @sa @ref clipboard
+ *  @sa @ref glfwRequestClipboardString
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef void (* GLFWclipboardfun)(GLFWwindow* window, const char* string);
+
+/*! @brief The function pointer type for clipboard data callbacks.
+ *
+ *  This is the function pointer type for clipboard data callbacks.  A clipboard
+ *  data callback function has the following signature:
+ *  @code
+ *  const void* function_name(const char* type, size_t* size)
+ *  @endcode
+ *
+ *  @param[in] type The MIME type requested by another application.
+ *  @param[out] size Where to store the size, in bytes, of the returned data.
+ *  @return The clipboard contents as the requested type, or `NULL` if they
+ *  cannot be provided.
+ *
+ *  @pointer_lifetime The returned data must remain valid until the clipboard
+ *  contents are replaced or the library is terminated.  It is not copied.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwSetClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+typedef const void* (* GLFWclipboarddatafun)(const char* type, size_t* size);
+
 /*! @brief The function pointer type for monitor configuration callbacks.
  *
  *  This is the function pointer type for monitor configuration callbacks.
@@ -2155,6 +2267,66 @@ typedef struct GLFWallocator
     void* user;
 } GLFWallocator;
 
+/*! @brief Batched window or input event.
+ *
+ *  This describes a single window or input event of a window with the
+ *  @ref GLFW_EVENT_BATCH input mode enabled.  Which member of `data` is valid
+ *  depends on the [event type](@ref event_types).
+ *
+ *  @sa @ref event_batch
+ *  @sa @ref glfwGetEventBatch
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+typedef struct GLFWevent
+{
+    /*! The [type](@ref event_types) of this event.
+     */
+    int type;
+    /*! The window that received this event.
+     */
+    GLFWwindow* window;
+    /*! The time, in seconds, at which GLFW received this event, on the same
+     *  timeline as @ref glfwGetTime.
+     */
+    double time;
+    /*! The event data, matching the arguments of the corresponding callback.
+     */
+    union
+    {
+        /*! Data for `GLFW_EVENT_KEY`.
+         */
+        struct { int key; int scancode; int action; int mods; } key;
+        /*! Data for `GLFW_EVENT_CHAR`.
+         */
+        struct { unsigned int codepoint; int mods; } character;
+        /*! Data for `GLFW_EVENT_MOUSE_BUTTON`.
+         */
+        struct { int button; int action; int mods; } button;
+        /*! Data for `GLFW_EVENT_CURSOR_POS`.
+         */
+        struct { double x; double y; } cursor;
+        /*! Data for `GLFW_EVENT_SCROLL`.
+         */
+        struct { double x; double y; } scroll;
+        /*! Data for `GLFW_EVENT_WINDOW_POS`.
+         */
+        struct { int x; int y; } pos;
+        /*! Data for `GLFW_EVENT_WINDOW_SIZE` and `GLFW_EVENT_FRAMEBUFFER_SIZE`.
+         */
+        struct { int width; int height; } size;
+        /*! Data for `GLFW_EVENT_WINDOW_CONTENT_SCALE`.
+         */
+        struct { float x; float y; } scale;
+        /*! Data for `GLFW_EVENT_CURSOR_ENTER`, `GLFW_EVENT_WINDOW_FOCUS`,
+         *  `GLFW_EVENT_WINDOW_ICONIFY` and `GLFW_EVENT_WINDOW_MAXIMIZE`.
+         */
+        int state;
+    } data;
+} GLFWevent;
+
 
 /*************************************************************************
  * GLFW API functions
@@ -2928,10 +3100,50 @@ GLFWAPI const GLFWvidmode* glfwGetVideoMode(GLFWmonitor* monitor);
  */
 GLFWAPI void glfwSetGamma(GLFWmonitor* monitor, float gamma);
 
+/*! @brief Generates a gamma ramp and sets it for the specified monitors.
+ *
+ *  This function sets the same gamma exponent for each of the specified
+ *  monitors, as if by calling @ref glfwSetGamma for each of them, but the gamma
+ *  ramp is only generated once for all monitors with ramps of the same size.
+ *  The value must be a finite number greater than zero.
+ *
+ *  Monitors whose gamma ramp already matches the exponent are left untouched,
+ *  making this function suitable for animating gamma every frame.
+ *
+ *  @param[in] monitors The monitors whose gamma ramps to set.
+ *  @param[in] count The number of monitors in the array.
+ *  @param[in] gamma The desired exponent.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref GLFW_INVALID_VALUE,
+ *  @ref GLFW_PLATFORM_ERROR and @ref GLFW_FEATURE_UNAVAILABLE (see remarks).
+ *
+ *  @remark @x11 The gamma ramp requests for all monitors are sent to the X
+ *  server together.
+ *
+ *  @remark @wayland Gamma handling is a privileged protocol, this function
+ *  will thus never be implemented and emits @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @pointer_lifetime The specified array is not retained by GLFW.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref monitor_gamma
+ *  @sa @ref glfwSetGamma
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup monitor
+ */
+GLFWAPI void glfwSetMonitorsGamma(GLFWmonitor* const* monitors, int count, float gamma);
+
 /*! @brief Returns the current gamma ramp for the specified monitor.
  *
  *  This function returns the current gamma ramp of the specified monitor.
  *
+ *  The gamma ramp is retrieved from the system once and then remembered along
+ *  with any changes made with GLFW, until the monitor configuration changes.
+ *  Changes made by other programs may therefore not be reflected.
+ *
  *  @param[in] monitor The monitor to query.
  *  @return The current gamma ramp, or `NULL` if an
  *  [error](@ref error_handling) occurred.
@@ -2946,7 +3158,8 @@ GLFWAPI void glfwSetGamma(GLFWmonitor* monitor, float gamma);
  *  @pointer_lifetime The returned structure and its arrays are allocated and
  *  freed by GLFW.  You should not free them yourself.  They are valid until the
  *  specified monitor is disconnected, this function is called again for that
- *  monitor or the library is terminated.
+ *  monitor or the library is terminated.  Their contents are updated when the
+ *  gamma ramp of that monitor is set.
  *
  *  @thread_safety This function must only be called from the main thread.
  *
@@ -2981,6 +3194,9 @@ GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* monitor);
  *  @remark The size of the specified gamma ramp should match the size of the
  *  current ramp for that monitor.
  *
+ *  @remark Setting the gamma ramp that is already current for that monitor does
+ *  nothing.
+ *
  *  @remark @win32 The gamma ramp size must be 256.
  *
  *  @remark @wayland Gamma handling is a privileged protocol, this function
@@ -2999,6 +3215,76 @@ GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* monitor);
  */
 GLFWAPI void glfwSetGammaRamp(GLFWmonitor* monitor, const GLFWgammaramp* ramp);
 
+/*! @brief Gradually changes the gamma ramp of the specified monitor.
+ *
+ *  This function starts a transition from the current gamma ramp of the
+ *  specified monitor to the specified ramp, which is interpolated over the
+ *  specified duration by a thread internal to GLFW.  The intermediate ramps are
+ *  set once per refresh of the monitor, independently of the frame rate of the
+ *  application.
+ *
+ *  When the target ramp has been reached, an empty event is posted as if by
+ *  @ref glfwPostEmptyEvent, waking up any call to @ref glfwWaitEvents.  Use
+ *  @ref glfwGammaTransitionActive to find out whether a transition is still in
+ *  progress.
+ *
+ *  Starting a new transition for a monitor replaces any transition already in
+ *  progress for it, continuing from the ramp it had reached.  Setting the gamma
+ *  ramp with @ref glfwSetGammaRamp, @ref glfwSetGamma or @ref
+ *  glfwSetMonitorsGamma stops the transition at the ramp it had reached.
+ *
+ *  While the transition is in progress, @ref glfwGetGammaRamp returns the
+ *  target ramp.
+ *
+ *  @param[in] monitor The monitor whose gamma ramp to change.
+ *  @param[in] ramp The gamma ramp to change to.  It must have the same size as
+ *  the current ramp of that monitor.
+ *  @param[in] duration The duration of the transition, in seconds, or zero to
+ *  set the ramp immediately.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_PLATFORM_ERROR and @ref
+ *  GLFW_FEATURE_UNAVAILABLE (see remarks).
+ *
+ *  @remark @wayland Gamma handling is a privileged protocol, this function
+ *  will thus never be implemented and emits @ref GLFW_FEATURE_UNAVAILABLE.
+ *
+ *  @pointer_lifetime The specified gamma ramp is copied before this function
+ *  returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref monitor_gamma
+ *  @sa @ref glfwGammaTransitionActive
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup monitor
+ */
+GLFWAPI void glfwStartGammaTransition(GLFWmonitor* monitor, const GLFWgammaramp* ramp, double duration);
+
+/*! @brief Returns whether a gamma transition is in progress for a monitor.
+ *
+ *  This function returns whether a gamma transition started with @ref
+ *  glfwStartGammaTransition is still in progress for the specified monitor.
+ *
+ *  @param[in] monitor The monitor to query.
+ *  @return `GLFW_TRUE` if a gamma transition is in progress, or `GLFW_FALSE`
+ *  otherwise or if an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref monitor_gamma
+ *  @sa @ref glfwStartGammaTransition
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup monitor
+ */
+GLFWAPI int glfwGammaTransitionActive(GLFWmonitor* monitor);
+
 /*! @brief Resets all window hints to their default values.
  *
  *  This function resets all window hints to their
@@ -3142,6 +3428,10 @@ GLFWAPI void glfwWindowHintString(int hint, const char* value);
  *  The [swap interval](@ref buffer_swap) is not set during window creation and
  *  the initial value may vary depending on driver settings and defaults.
  *
+ *  If a windowed mode window is requested with the hints and share window of
+ *  a [window pool](@ref window_pool) that has idle windows, one of those is
+ *  handed out instead of creating a new window.
+ *
  *  @param[in] width The desired width, in screen coordinates, of the window.
  *  This must be greater than zero.
  *  @param[in] height The desired height, in screen coordinates, of the window.
@@ -3228,6 +3518,7 @@ GLFWAPI void glfwWindowHintString(int hint, const char* value);
  *
  *  @sa @ref window_creation
  *  @sa @ref glfwDestroyWindow
+ *  @sa @ref glfwPoolWindows
  *
  *  @since Added in version 3.0.  Replaces `glfwOpenWindow`.
  *
@@ -3235,6 +3526,69 @@ GLFWAPI void glfwWindowHintString(int hint, const char* value);
  */
 GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height, const char* title, GLFWmonitor* monitor, GLFWwindow* share);
 
+/*! @brief Keeps hidden windows ready for the current window hints.
+ *
+ *  This function sets how many idle windows and contexts are kept for the
+ *  current [window hints](@ref window_hints) and the specified share window,
+ *  creating hidden windows until that many are idle.  Later calls to @ref
+ *  glfwCreateWindow with the same hints and share window, for a windowed mode
+ *  window, hand out an idle window instead of creating a new one.
+ *
+ *  The size, title, position, visibility, focus and maximization hints are
+ *  applied when a window is handed out and may differ between windows taken
+ *  from the same pool.  All other hints must be identical.  If the position
+ *  hints are @ref GLFW_ANY_POSITION, a handed out window keeps the position it
+ *  had when it was last destroyed instead of being placed by the window
+ *  manager.
+ *
+ *  When a window handed out from a pool is destroyed with @ref
+ *  glfwDestroyWindow and the pool has fewer idle windows than its size, the
+ *  window is hidden, its attributes, input modes, size limits, cursor, close
+ *  flag and user pointer are reset and it becomes idle again.  Windows that
+ *  are iconified or full screen when destroyed, and windows whose icon or
+ *  opacity has been set, are destroyed as usual.  Handed out windows are not
+ *  replaced, so call this function again at a convenient time to create new
+ *  idle windows.
+ *
+ *  The state of the context of a returned window is not reset, including its
+ *  objects, its [swap interval](@ref buffer_swap) and any state set with the
+ *  client API.
+ *
+ *  Setting a size of zero destroys the idle windows of the pool.  Windows
+ *  already handed out from it are then destroyed as usual.  All pools are
+ *  destroyed when the share window is destroyed and by @ref glfwTerminate.
+ *
+ *  @param[in] count The number of idle windows to keep, or zero to destroy
+ *  the pool.
+ *  @param[in] share The window whose context the pooled contexts share
+ *  resources with, or `NULL` to not share resources.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE, @ref GLFW_API_UNAVAILABLE, @ref
+ *  GLFW_VERSION_UNAVAILABLE, @ref GLFW_FORMAT_UNAVAILABLE, @ref
+ *  GLFW_FEATURE_UNAVAILABLE, @ref GLFW_NO_WINDOW_CONTEXT and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark Windows cannot be pooled while the [GLFW_SCALE_TO_MONITOR](@ref
+ *  GLFW_SCALE_TO_MONITOR) hint is set, as their initial size depends on where
+ *  they are placed.  This emits a @ref GLFW_FEATURE_UNAVAILABLE error.
+ *
+ *  @remark If an error occurs while creating windows, the windows already
+ *  created are kept in the pool.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref window_pool
+ *  @sa @ref glfwCreateWindow
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI int glfwPoolWindows(int count, GLFWwindow* share);
+
 /*! @brief Destroys the specified window and its context.
  *
  *  This function destroys the specified window and its context.  On calling
@@ -3243,6 +3597,10 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height, const char* title, G
  *  If the context of the specified window is current on the main thread, it is
  *  detached before being destroyed.
  *
+ *  If the window was handed out from a [window pool](@ref window_pool) with
+ *  room for it, it is hidden and reset instead and kept for a later @ref
+ *  glfwCreateWindow call.
+ *
  *  @param[in] window The window to destroy.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
@@ -4648,6 +5006,142 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout);
  */
 GLFWAPI void glfwPostEmptyEvent(void);
 
+/*! @brief Returns the events batched by the last event processing call.
+ *
+ *  This function returns the window and input events received by windows with
+ *  the @ref GLFW_EVENT_BATCH input mode enabled since the start of the last
+ *  call to @ref glfwPollEvents, @ref glfwWaitEvents or @ref
+ *  glfwWaitEventsTimeout, in the order they were received.  Events of batching
+ *  windows are never passed to their callbacks.
+ *
+ *  Call this function after each event processing call, as the events it
+ *  returns are removed at the start of the next one.  Events received outside
+ *  of event processing, for example when setting the window size, are kept and
+ *  returned together with those of the next call, unless this function has
+ *  already returned them.
+ *
+ *  @param[out] count Where to store the number of events in the returned
+ *  array.  This is set to zero if the batch is empty or an error occurred.
+ *  @return An array of events, or `NULL` if the batch is empty or an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @pointer_lifetime The returned array is allocated and freed by GLFW.  You
+ *  should not free it yourself.  It is valid until the next call to an event
+ *  processing function, until a window with events in the batch is destroyed,
+ *  until an event is batched outside of event processing or until the library
+ *  is terminated.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref event_batch
+ *  @sa @ref GLFW_EVENT_BATCH
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup window
+ */
+GLFWAPI const GLFWevent* glfwGetEventBatch(int* count);
+
+/*! @brief Starts recording window and input events to a file.
+ *
+ *  This function starts recording the window and input events of all windows
+ *  to the specified file, replacing any existing file.  Events are recorded
+ *  as they are received from the platform, before they are filtered or passed
+ *  to callbacks or the event batch, and are stored in a compact append-only
+ *  binary format that can be replayed with @ref glfwReplayInputRecording.
+ *
+ *  Windows are identified in the recording by the order in which they first
+ *  received an event after the recording was started, starting at zero.
+ *
+ *  If a recording is already in progress, it is finished before the new one is
+ *  started.  The recording is finished by @ref glfwStopInputRecording or when
+ *  the library is terminated.
+ *
+ *  @param[in] path The UTF-8 encoded path of the file to record to.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark Drop events and joystick input are not recorded.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_recording
+ *  @sa @ref glfwStopInputRecording
+ *  @sa @ref glfwReplayInputRecording
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwStartInputRecording(const char* path);
+
+/*! @brief Finishes the current input recording.
+ *
+ *  This function writes any buffered events to the file of the current input
+ *  recording and closes it.  If no recording is in progress, this function
+ *  does nothing.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_recording
+ *  @sa @ref glfwStartInputRecording
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwStopInputRecording(void);
+
+/*! @brief Replays a recording of window and input events.
+ *
+ *  This function reads an input recording created by @ref
+ *  glfwStartInputRecording and passes its events to the specified windows, in
+ *  order and without delay, as if they had been received from the platform.
+ *  This works the same on every platform, including the
+ *  [null platform](@ref platform).
+ *
+ *  Events recorded for window number _n_ are passed to the window at index _n_
+ *  of the specified array.  Events for windows beyond the end of the array or
+ *  for `NULL` elements are skipped.
+ *
+ *  The events are passed to callbacks, or added to the event batch of windows
+ *  with the @ref GLFW_EVENT_BATCH input mode enabled, before this function
+ *  returns.  The times of batched events are the recorded times, in seconds
+ *  since the recording was started.
+ *
+ *  The whole recording is validated before any of it is replayed.
+ *
+ *  @param[in] path The UTF-8 encoded path of the recording to replay.
+ *  @param[in] windows The windows to pass the recorded events to.
+ *  @param[in] count The number of windows in the array.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark The windows must not be destroyed by callbacks called during the
+ *  replay.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref input_recording
+ *  @sa @ref glfwStartInputRecording
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwReplayInputRecording(const char* path, GLFWwindow** windows, int count);
+
 /*! @brief Returns the value of an input option for the specified window.
  *
  *  This function returns the value of an input option for the specified window.
@@ -4678,7 +5172,8 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *  This function sets an input mode option for the specified window.  The mode
  *  must be one of @ref GLFW_CURSOR, @ref GLFW_STICKY_KEYS,
  *  @ref GLFW_STICKY_MOUSE_BUTTONS, @ref GLFW_LOCK_KEY_MODS
- *  @ref GLFW_RAW_MOUSE_MOTION, or @ref GLFW_UNLIMITED_MOUSE_BUTTONS.
+ *  @ref GLFW_RAW_MOUSE_MOTION, @ref GLFW_UNLIMITED_MOUSE_BUTTONS,
+ *  @ref GLFW_EVENT_BATCH or @ref GLFW_COALESCE_CURSOR_MOTION.
  *
  *  If the mode is `GLFW_CURSOR`, the value must be one of the following cursor
  *  modes:
@@ -4723,6 +5218,18 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* window, int mode);
  *  callback, or `GLFW_FALSE` to limit the mouse buttons sent to the callback
  *  to the mouse button token values up to `GLFW_MOUSE_BUTTON_LAST`.
  *
+ *  If the mode is `GLFW_EVENT_BATCH`, the value must be either `GLFW_TRUE` to
+ *  collect the window and input events of the window into the array returned
+ *  by @ref glfwGetEventBatch instead of calling its callbacks, or `GLFW_FALSE`
+ *  to use the callbacks.  Path drop events are always passed to the callback.
+ *
+ *  If the mode is `GLFW_COALESCE_CURSOR_MOTION`, the value must be either
+ *  `GLFW_TRUE` to report consecutive cursor motion events as a single cursor
+ *  position event, or `GLFW_FALSE` to report every motion event.  Coalesced
+ *  motion is reported before the next other input event of the window and at
+ *  the end of event processing.  The cursor position returned by @ref
+ *  glfwGetCursorPos is always up to date.
+ *
  *  @param[in] window The window whose input mode to set.
  *  @param[in] mode One of `GLFW_CURSOR`, `GLFW_STICKY_KEYS`,
  *  `GLFW_STICKY_MOUSE_BUTTONS`, `GLFW_LOCK_KEY_MODS` or
@@ -5030,6 +5537,13 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* window, double xpos, double ypos);
  *  of the cursor image.  Like all other coordinate systems in GLFW, the X-axis
  *  points to the right and the Y-axis points down.
  *
+ *  If the [GLFW_CURSOR_CACHE_LIMIT](@ref GLFW_CURSOR_CACHE_LIMIT_hint) init
+ *  hint is greater than zero, custom cursors are cached by their image and
+ *  hotspot.  If a cursor with the same image and hotspot already exists, or was
+ *  destroyed recently and is still in the cache, that cursor is returned
+ *  instead of creating a new one.  Each call to this function must still be
+ *  matched by a call to @ref glfwDestroyCursor.
+ *
  *  @param[in] image The desired cursor image.
  *  @param[in] xhot The desired x-coordinate, in pixels, of the cursor hotspot.
  *  @param[in] yhot The desired y-coordinate, in pixels, of the cursor hotspot.
@@ -5045,6 +5559,7 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* window, double xpos, double ypos);
  *  @thread_safety This function must only be called from the main thread.
  *
  *  @sa @ref cursor_object
+ *  @sa @ref cursor_cache
  *  @sa @ref glfwDestroyCursor
  *  @sa @ref glfwCreateStandardCursor
  *
@@ -5111,6 +5626,11 @@ GLFWAPI GLFWcursor* glfwCreateStandardCursor(int shape);
  *  If the specified cursor is current for any window, that window will be
  *  reverted to the default cursor.  This does not affect the cursor mode.
  *
+ *  If the same cached custom cursor was returned by more than one call to @ref
+ *  glfwCreateCursor, it is only released when every handle to it has been
+ *  destroyed.  A released custom cursor may be kept in the cursor cache until
+ *  it is evicted or purged with @ref glfwPurgeCursorCache.
+ *
  *  @param[in] cursor The cursor object to destroy.
  *
  *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
@@ -5129,6 +5649,28 @@ GLFWAPI GLFWcursor* glfwCreateStandardCursor(int shape);
  */
 GLFWAPI void glfwDestroyCursor(GLFWcursor* cursor);
 
+/*! @brief Destroys all unused cached custom cursors.
+ *
+ *  This function destroys all custom cursors in the cursor cache that have been
+ *  destroyed with @ref glfwDestroyCursor but kept for reuse.  Cursors that are
+ *  still in use are not affected.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @reentrancy This function must not be called from a callback.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref cursor_cache
+ *  @sa @ref glfwCreateCursor
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwPurgeCursorCache(void);
+
 /*! @brief Sets the cursor for the window.
  *
  *  This function sets the cursor image to be used when the cursor is over the
@@ -5465,6 +6007,46 @@ GLFWAPI GLFWscrollfun glfwSetScrollCallback(GLFWwindow* window, GLFWscrollfun ca
  */
 GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* window, GLFWdropfun callback);
 
+/*! @brief Sets the path drop stream callback.
+ *
+ *  This function sets the path drop stream callback of the specified window,
+ *  which is called when one or more dragged paths are dropped on the window.
+ *  Unlike the [path drop callback](@ref glfwSetDropCallback), it receives the
+ *  paths in chunks as they are parsed, so that processing of large drops can
+ *  begin before all paths are available.  The last chunk of a drop is marked
+ *  by the `last` argument.
+ *
+ *  Both callbacks may be set at the same time, in which case the stream
+ *  callback receives all chunks before the drop callback is called.
+ *
+ *  @param[in] window The window whose callback to set.
+ *  @param[in] callback The new path drop stream callback, or `NULL` to remove
+ *  the currently set callback.
+ *  @return The previously set callback, or `NULL` if no callback was set or the
+ *  library had not been [initialized](@ref intro_init).
+ *
+ *  @callback_signature
+ *  @code
+ *  void function_name(GLFWwindow* window, int path_count, const char* paths[], int last)
+ *  @endcode
+ *  For more information about the callback parameters, see the
+ *  [function pointer type](@ref GLFWdropstreamfun).
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED.
+ *
+ *  @remark @win32 @macos The paths of a drop are always delivered as a single
+ *  chunk.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref path_drop
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI GLFWdropstreamfun glfwSetDropStreamCallback(GLFWwindow* window, GLFWdropstreamfun callback);
+
 /*! @brief Returns whether the specified joystick is present.
  *
  *  This function returns whether the specified joystick is present.
@@ -5825,8 +6407,11 @@ GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun callback);
  *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
  *  [error](@ref error_handling) occurred.
  *
- *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
- *  GLFW_INVALID_VALUE.
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_OUT_OF_MEMORY.
+ *
+ *  @remark Invalid mappings emit a @ref GLFW_INVALID_VALUE error but do not
+ *  make this function return `GLFW_FALSE`.
  *
  *  @thread_safety This function must only be called from the main thread.
  *
@@ -5840,6 +6425,48 @@ GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun callback);
  */
 GLFWAPI int glfwUpdateGamepadMappings(const char* string);
 
+/*! @brief Adds the SDL_GameControllerDB gamepad mappings in a memory buffer.
+ *
+ *  This function parses the specified number of bytes of ASCII encoded
+ *  SDL_GameControllerDB text and updates the internal list with any gamepad
+ *  mappings it finds, like @ref glfwUpdateGamepadMappings.  It is intended for
+ *  loading large mapping databases, for example the contents of a memory-mapped
+ *  `gamecontrollerdb.txt` file.  The text does not need to be null-terminated
+ *  and is parsed in place.
+ *
+ *  See @ref gamepad_mapping for a description of the format.
+ *
+ *  If there is already a gamepad mapping for a given GUID in the internal list,
+ *  it will be replaced by the one from the buffer.  If a line of the buffer has
+ *  the same GUID as an earlier line of the same buffer, the later line is
+ *  rejected.
+ *
+ *  Invalid and rejected lines do not prevent the remaining lines from being
+ *  added.  Instead of one error per line, a single @ref GLFW_INVALID_VALUE
+ *  error is emitted after all lines have been parsed, listing the numbers of
+ *  the first rejected lines and how many there were in total.
+ *
+ *  @param[in] data The buffer containing the gamepad mappings.
+ *  @param[in] size The size, in bytes, of the buffer.
+ *  @return `GLFW_TRUE` if every mapping line was added, or `GLFW_FALSE` if any
+ *  line was rejected or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE and @ref GLFW_OUT_OF_MEMORY.
+ *
+ *  @pointer_lifetime The buffer is not referenced after this function returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref gamepad
+ *  @sa @ref glfwUpdateGamepadMappings
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI int glfwUpdateGamepadMappingsFromMemory(const char* data, size_t size);
+
 /*! @brief Returns the human-readable gamepad name for the specified joystick.
  *
  *  This function returns the human-readable name of the gamepad from the
@@ -5975,6 +6602,134 @@ GLFWAPI void glfwSetClipboardString(GLFWwindow* window, const char* string);
  */
 GLFWAPI const char* glfwGetClipboardString(GLFWwindow* window);
 
+/*! @brief Requests the contents of the clipboard without waiting for them.
+ *
+ *  This function requests the contents of the system clipboard as a UTF-8
+ *  encoded string and returns immediately.  The specified callback is called
+ *  with the string by one of the [event processing](@ref events) functions
+ *  once it has arrived, or with `NULL` if the clipboard is empty, if its
+ *  contents cannot be converted or if the request times out.  Unlike @ref
+ *  glfwGetClipboardString, this function never blocks waiting for another
+ *  application that owns the clipboard.
+ *
+ *  Each window can have one pending request.  Requesting the clipboard again
+ *  before the callback has been called replaces the callback and restarts the
+ *  timeout of the pending request.  If the window is destroyed before the
+ *  request completes, the callback is not called.
+ *
+ *  If the clipboard contents are available without waiting, for example
+ *  because this application owns the clipboard, the callback may be called
+ *  before this function returns.
+ *
+ *  @param[in] window The window making the request.
+ *  @param[in] callback The function to call with the clipboard contents.
+ *  @param[in] timeout The maximum time, in seconds, to wait for the contents,
+ *  or zero to wait indefinitely.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_FORMAT_UNAVAILABLE and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @win32 @macos The clipboard is read when this function is called
+ *  and the callback is called before this function returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard
+ *  @sa @ref glfwGetClipboardString
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwRequestClipboardString(GLFWwindow* window, GLFWclipboardfun callback, double timeout);
+
+/*! @brief Offers data of the specified MIME types on the clipboard.
+ *
+ *  This function takes ownership of the system clipboard and offers data of the
+ *  specified MIME types, like `image/png` or `application/json`, to other
+ *  applications.  The data is not provided up front.  Instead the specified
+ *  callback is called with the requested type each time another application
+ *  asks for the clipboard contents, and the data it returns is sent without
+ *  being copied.
+ *
+ *  The clipboard contents are replaced by the next call to this function or to
+ *  @ref glfwSetClipboardString.
+ *
+ *  @param[in] types The MIME types of the offered data.
+ *  @param[in] count The number of types in the array.
+ *  @param[in] callback The function providing the data of a requested type.
+ *
+ *  If the clipboard cannot be taken over, an error is generated and the
+ *  callback is not retained.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_INVALID_VALUE, @ref GLFW_OUT_OF_MEMORY and @ref GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @x11 Data larger than the maximum request size of the X server is
+ *  sent in chunks with the `INCR` mechanism, during event processing.
+ *
+ *  @remark @win32 Each MIME type is registered as a clipboard format of the
+ *  same name, except `text/plain;charset=utf-8`, which is offered as
+ *  `CF_UNICODETEXT`.  The data is rendered by the callback when another
+ *  application requests it, and for all types when the library is terminated.
+ *
+ *  @remark @macos Each MIME type is used as a pasteboard type of the same name,
+ *  except `text/plain;charset=utf-8`, which is offered as
+ *  `NSPasteboardTypeString`.  The data of all types is copied to the pasteboard
+ *  when the library is terminated.
+ *
+ *  @pointer_lifetime The specified types are copied before this function
+ *  returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwGetClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI void glfwSetClipboardData(const char* const* types, int count, GLFWclipboarddatafun callback);
+
+/*! @brief Returns the contents of the clipboard as the specified MIME type.
+ *
+ *  This function returns the contents of the system clipboard converted to the
+ *  specified MIME type, along with their size in bytes.  The data is not
+ *  null-terminated or otherwise interpreted.  If the clipboard is empty or if
+ *  its contents are not available as the specified type, `NULL` is returned and
+ *  a @ref GLFW_FORMAT_UNAVAILABLE error is generated.
+ *
+ *  @param[in] type The MIME type of the requested data.
+ *  @param[out] size Where to store the size, in bytes, of the returned data.
+ *  @return The contents of the clipboard, or `NULL` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_FORMAT_UNAVAILABLE, @ref GLFW_OUT_OF_MEMORY and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark @win32 The size of data provided by other applications may include
+ *  padding, as the size of clipboard memory objects is rounded up.
+ *
+ *  @pointer_lifetime The returned data is allocated and freed by GLFW.  You
+ *  should not free it yourself.  It is valid until the next call to this
+ *  function, or until the library is terminated.  If this application offers
+ *  the clipboard contents with @ref glfwSetClipboardData, the data returned by
+ *  its callback is returned directly.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref clipboard_data
+ *  @sa @ref glfwSetClipboardData
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup input
+ */
+GLFWAPI const void* glfwGetClipboardData(const char* type, size_t* size);
+
 /*! @brief Returns the GLFW time.
  *
  *  This function returns the current GLFW time, in seconds.  Unless the time
@@ -6283,7 +7038,13 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  *  GLFW_NO_CURRENT_CONTEXT and @ref GLFW_PLATFORM_ERROR.
  *
  *  @remark The address of a given function is not guaranteed to be the same
- *  between contexts.
+ *  between contexts.  The addresses retrieved for a context are remembered by
+ *  all contexts sharing objects with it, so retrieving them again is very
+ *  cheap.
+ *
+ *  @remark @win32 Addresses retrieved with WGL are only remembered by the
+ *  context they were retrieved for, as they may differ between contexts that
+ *  share objects.
  *
  *  @remark This function may return a non-`NULL` address despite the
  *  associated version or extension not being available.  Always check the
@@ -6296,6 +7057,7 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  *
  *  @sa @ref context_glext
  *  @sa @ref glfwExtensionSupported
+ *  @sa @ref glfwGetProcAddresses
  *
  *  @since Added in version 1.0.
  *
@@ -6303,6 +7065,56 @@ GLFWAPI int glfwExtensionSupported(const char* extension);
  */
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname);
 
+/*! @brief Returns the addresses of the specified functions for the current
+ *  context.
+ *
+ *  This function retrieves the addresses of the specified OpenGL or OpenGL ES
+ *  [core or extension functions](@ref context_glext) for the current context,
+ *  as if by calling @ref glfwGetProcAddress for each of them, and returns the
+ *  number of functions that were found.  The address of each function not
+ *  found is set to `NULL`.
+ *
+ *  The addresses retrieved for a context are remembered by it and by all
+ *  contexts sharing objects with it, so later queries for the same functions,
+ *  with this function or @ref glfwGetProcAddress, do not call the context
+ *  creation API again.
+ *
+ *  A context must be current on the calling thread.  Calling this function
+ *  without a current context will cause a @ref GLFW_NO_CURRENT_CONTEXT error
+ *  and set every address to `NULL`.
+ *
+ *  @param[in] procnames An array of ASCII encoded function names.
+ *  @param[in] count The number of elements in the arrays.
+ *  @param[out] procs Where to store the address of each function.
+ *  @return The number of functions found, or zero if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_NO_CURRENT_CONTEXT, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_PLATFORM_ERROR.
+ *
+ *  @remark This function may return non-`NULL` addresses despite the
+ *  associated version or extension not being available.  Always check the
+ *  context version or extension string first.
+ *
+ *  @remark @win32 Addresses retrieved with WGL are only remembered by the
+ *  context they were retrieved for, as they may differ between contexts that
+ *  share objects.
+ *
+ *  @pointer_lifetime The returned function pointers are valid until the
+ *  context is destroyed or the library is terminated.
+ *
+ *  @thread_safety This function may be called from any thread.
+ *
+ *  @sa @ref context_glext
+ *  @sa @ref glfwGetProcAddress
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup context
+ */
+GLFWAPI int glfwGetProcAddresses(const char* const* procnames, int count, GLFWglproc* procs);
+
 /*! @brief Returns whether the Vulkan loader and an ICD have been found.
  *
  *  This function returns whether the Vulkan loader and any minimally functional
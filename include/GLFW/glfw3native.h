@@ -62,6 +62,7 @@ extern "C" {
  *  * `GLFW_EXPOSE_NATIVE_COCOA`
  *  * `GLFW_EXPOSE_NATIVE_X11`
  *  * `GLFW_EXPOSE_NATIVE_WAYLAND`
+ *  * `GLFW_EXPOSE_NATIVE_NULL`
  *
  *  The available context API macros are:
  *  * `GLFW_EXPOSE_NATIVE_WGL`
@@ -444,6 +445,205 @@ GLFWAPI void glfwSetX11SelectionString(const char* string);
 GLFWAPI const char* glfwGetX11SelectionString(void);
 #endif
 
+#if defined(GLFW_EXPOSE_NATIVE_NULL)
+/*! @brief Queues synthetic input and window events on the null platform.
+ *
+ *  This function appends copies of the specified events to the injected event
+ *  queue of the null platform.  Injected events are passed to GLFW by @ref
+ *  glfwPollEvents, @ref glfwWaitEvents and @ref glfwWaitEventsTimeout as if
+ *  they had been received from a window system, updating the cached input
+ *  state and calling callbacks or [batching](@ref event_batch) them as usual.
+ *  This allows input handling to be driven and measured deterministically
+ *  without a display server.
+ *
+ *  The supported event types are @ref GLFW_EVENT_KEY, @ref GLFW_EVENT_CHAR,
+ *  @ref GLFW_EVENT_MOUSE_BUTTON, @ref GLFW_EVENT_CURSOR_POS, @ref
+ *  GLFW_EVENT_CURSOR_ENTER, @ref GLFW_EVENT_SCROLL, @ref GLFW_EVENT_WINDOW_POS,
+ *  @ref GLFW_EVENT_WINDOW_SIZE, @ref GLFW_EVENT_WINDOW_CLOSE and @ref
+ *  GLFW_EVENT_WINDOW_FOCUS.  Events returned by @ref glfwGetEventBatch can be
+ *  injected unmodified to replay a recorded event stream.
+ *
+ *  If `timed` is `GLFW_FALSE`, all events are delivered by the next event
+ *  processing call.  If `timed` is `GLFW_TRUE`, the `time` members of the
+ *  events are used to replay them with their original spacing, starting now.
+ *  Each event is then delivered by the first event processing call at or after
+ *  its time and @ref glfwWaitEvents wakes up when the next event is due.
+ *
+ *  If any event is invalid, no events are queued.  Injected events for
+ *  a window are discarded when it is destroyed.
+ *
+ *  @param[in] events The events to inject.
+ *  @param[in] count The number of events in the array.
+ *  @param[in] timed `GLFW_TRUE` to replay the events with their original
+ *  timing, or `GLFW_FALSE` to deliver them all at once.
+ *  @return `GLFW_TRUE` if successful, or `GLFW_FALSE` if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_PLATFORM_UNAVAILABLE, @ref GLFW_INVALID_ENUM, @ref GLFW_INVALID_VALUE
+ *  and @ref GLFW_OUT_OF_MEMORY.
+ *
+ *  @pointer_lifetime The events are copied before this function returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref event_batch
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI int glfwInjectNullEvents(const GLFWevent* events, int count, int timed);
+
+/*! @brief Drops a list of URIs on the specified window of the null platform.
+ *
+ *  This function passes a `text/uri-list` to the path drop callbacks of the
+ *  specified window as if it had been dropped on the window, parsing it the
+ *  same way as on X11 and Wayland.  The callbacks are called before this
+ *  function returns.
+ *
+ *  @param[in] window The window to drop the URIs on.
+ *  @param[in] uri_list The `text/uri-list` to drop.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_PLATFORM_UNAVAILABLE, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_OUT_OF_MEMORY.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref path_drop
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI void glfwInjectNullDrop(GLFWwindow* window, const char* uri_list);
+
+/*! @brief Connects a virtual joystick to the null platform.
+ *
+ *  This function connects a virtual joystick with the specified name, GUID and
+ *  number of axes, buttons and hats, calling the joystick callback as if it had
+ *  been plugged in.  Its axes start at zero, its buttons released and its hats
+ *  centered.  Use @ref glfwInjectNullJoystickState to change them.
+ *
+ *  If a gamepad mapping matches the GUID, the joystick is also a gamepad and
+ *  can be read with @ref glfwGetGamepadState.
+ *
+ *  @param[in] name The name of the joystick.
+ *  @param[in] guid The SDL compatible GUID of the joystick, as 32 hexadecimal
+ *  digits.
+ *  @param[in] axis_count The number of axes.
+ *  @param[in] button_count The number of buttons.
+ *  @param[in] hat_count The number of hats.
+ *  @return The joystick ID of the virtual joystick, or -1 if an
+ *  [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_PLATFORM_UNAVAILABLE, @ref GLFW_INVALID_VALUE and @ref
+ *  GLFW_OUT_OF_MEMORY.
+ *
+ *  @pointer_lifetime The specified strings are copied before this function
+ *  returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick
+ *  @sa @ref glfwInjectNullJoystickDisconnect
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI int glfwInjectNullJoystick(const char* name, const char* guid, int axis_count, int button_count, int hat_count);
+
+/*! @brief Sets the state of a virtual joystick of the null platform.
+ *
+ *  This function sets the axes, buttons and hats of a joystick connected with
+ *  @ref glfwInjectNullJoystick.  The new state is returned by the joystick and
+ *  gamepad functions from then on, without any event processing.
+ *
+ *  Any of the arrays may be `NULL` to leave those inputs unchanged.  Each array
+ *  must hold one element per axis, button or hat of the joystick.  If any
+ *  button or hat state is invalid, no state is changed.
+ *
+ *  @param[in] jid The joystick ID of the virtual joystick.
+ *  @param[in] axes The new axis values, or `NULL`.
+ *  @param[in] buttons The new button states, each `GLFW_PRESS` or
+ *  `GLFW_RELEASE`, or `NULL`.
+ *  @param[in] hats The new [hat states](@ref hat_state), or `NULL`.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_PLATFORM_UNAVAILABLE, @ref GLFW_INVALID_ENUM and @ref
+ *  GLFW_INVALID_VALUE.
+ *
+ *  @pointer_lifetime The specified arrays are copied before this function
+ *  returns.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick
+ *  @sa @ref glfwInjectNullJoystick
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI void glfwInjectNullJoystickState(int jid, const float* axes, const unsigned char* buttons, const unsigned char* hats);
+
+/*! @brief Disconnects a virtual joystick of the null platform.
+ *
+ *  This function disconnects a joystick connected with @ref
+ *  glfwInjectNullJoystick, calling the joystick callback as if it had been
+ *  unplugged.  Virtual joysticks still connected are disconnected by @ref
+ *  glfwTerminate.
+ *
+ *  @param[in] jid The joystick ID of the virtual joystick.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED, @ref
+ *  GLFW_PLATFORM_UNAVAILABLE and @ref GLFW_INVALID_VALUE.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *
+ *  @sa @ref joystick
+ *  @sa @ref glfwInjectNullJoystick
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI void glfwInjectNullJoystickDisconnect(int jid);
+
+/*! @brief Returns the gamma ramp last set on the specified monitor of the null
+ *  platform.
+ *
+ *  This function returns the gamma ramp held by the null platform itself for
+ *  the specified monitor, as opposed to the ramp remembered by GLFW and
+ *  returned by @ref glfwGetGammaRamp.  This allows tests to check which ramps
+ *  actually reached the platform.
+ *
+ *  @param[in] monitor The monitor to query.
+ *  @return The gamma ramp of the monitor, or `NULL` if its gamma ramp has not
+ *  yet been accessed or an [error](@ref error_handling) occurred.
+ *
+ *  @errors Possible errors include @ref GLFW_NOT_INITIALIZED and @ref
+ *  GLFW_PLATFORM_UNAVAILABLE.
+ *
+ *  @pointer_lifetime The returned structure and its arrays are allocated and
+ *  freed by GLFW.  You should not free them yourself.  They are valid until the
+ *  monitor is disconnected or the library is terminated.
+ *
+ *  @thread_safety This function must only be called from the main thread.
+ *  A gamma transition in progress for the monitor may be changing the ramp.
+ *
+ *  @sa @ref monitor_gamma
+ *
+ *  @since Added in version 3.5.
+ *
+ *  @ingroup native
+ */
+GLFWAPI const GLFWgammaramp* glfwGetNullGammaRamp(GLFWmonitor* monitor);
+#endif
+
 #if defined(GLFW_EXPOSE_NATIVE_GLX)
 /*! @brief Returns the `GLXContext` of the specified window.
  *
@@ -416,6 +416,7 @@ static GLFWbool initializeTIS(void)
     }
 
     _glfwPollMonitorsCocoa();
+    _glfwInputMonitorChange(NULL);
 }
 
 - (void)applicationWillFinishLaunching:(NSNotification *)notification
@@ -509,6 +510,10 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeCocoa,
         .setClipboardString = _glfwSetClipboardStringCocoa,
         .getClipboardString = _glfwGetClipboardStringCocoa,
+        .requestClipboardString = _glfwRequestClipboardStringCocoa,
+        .cancelClipboardRequest = _glfwCancelClipboardRequestCocoa,
+        .setClipboardData = _glfwSetClipboardDataCocoa,
+        .getClipboardData = _glfwGetClipboardDataCocoa,
         .initJoysticks = _glfwInitJoysticksCocoa,
         .terminateJoysticks = _glfwTerminateJoysticksCocoa,
         .pollJoystick = _glfwPollJoystickCocoa,
@@ -522,6 +527,7 @@ GLFWbool _glfwConnectCocoa(int platformID, _GLFWplatform* platform)
         .getVideoMode = _glfwGetVideoModeCocoa,
         .getGammaRamp = _glfwGetGammaRampCocoa,
         .setGammaRamp = _glfwSetGammaRampCocoa,
+        .flushGammaRamps = _glfwFlushGammaRampsCocoa,
         .createWindow = _glfwCreateWindowCocoa,
         .destroyWindow = _glfwDestroyWindowCocoa,
         .setWindowTitle = _glfwSetWindowTitleCocoa,
@@ -682,7 +688,13 @@ void _glfwTerminateCocoa(void)
     if (_glfw.ns.keyUpMonitor)
         [NSEvent removeMonitor:_glfw.ns.keyUpMonitor];
 
+    // The pasteboard keeps the data after the provider has gone away
+    _glfwPushClipboardDataCocoa();
+    [_glfw.ns.clipboardProvider release];
+    _glfw.ns.clipboardProvider = nil;
+
     _glfw_free(_glfw.ns.clipboardString);
+    _glfw_free(_glfw.ns.clipboardData);
 
     _glfwTerminateNSGL();
     _glfwTerminateEGL();
@@ -418,6 +418,8 @@ void _glfwSetVideoModeCocoa(_GLFWmonitor* monitor, const GLFWvidmode* desired)
         CGDisplayFadeReservationToken token = beginFadeReservation();
         CGDisplaySetDisplayMode(monitor->ns.displayID, native, NULL);
         endFadeReservation(token);
+
+        _glfwInputMonitorChange(monitor);
     }
 
     CFRelease(modes);
@@ -436,6 +438,8 @@ void _glfwRestoreVideoModeCocoa(_GLFWmonitor* monitor)
 
         CGDisplayModeRelease(monitor->ns.previousMode);
         monitor->ns.previousMode = NULL;
+
+        _glfwInputMonitorChange(monitor);
     }
 }
 
@@ -597,11 +601,13 @@ GLFWbool _glfwGetGammaRampCocoa(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     } // autoreleasepool
 }
 
-void _glfwSetGammaRampCocoa(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
+GLFWbool _glfwSetGammaRampCocoa(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     @autoreleasepool {
 
     CGGammaValue* values = _glfw_calloc(ramp->size * 3, sizeof(CGGammaValue));
+    if (!values)
+        return GLFW_FALSE;
 
     for (unsigned int i = 0;  i < ramp->size;  i++)
     {
@@ -610,17 +616,29 @@ void _glfwSetGammaRampCocoa(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
         values[i + ramp->size * 2] = ramp->blue[i] / 65535.f;
     }
 
-    CGSetDisplayTransferByTable(monitor->ns.displayID,
-                                ramp->size,
-                                values,
-                                values + ramp->size,
-                                values + ramp->size * 2);
+    const CGError error = CGSetDisplayTransferByTable(monitor->ns.displayID,
+                                                      ramp->size,
+                                                      values,
+                                                      values + ramp->size,
+                                                      values + ramp->size * 2);
 
     _glfw_free(values);
 
+    if (error != kCGErrorSuccess)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Cocoa: Failed to set gamma ramp");
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+
     } // autoreleasepool
 }
 
+void _glfwFlushGammaRampsCocoa(void)
+{
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
@@ -176,6 +176,12 @@ typedef struct _GLFWlibraryNS
     short int           keycodes[256];
     short int           scancodes[GLFW_KEY_LAST + 1];
     char*               clipboardString;
+    // The provider of the data offered with glfwSetClipboardData
+    id                  clipboardProvider;
+    // The pasteboard change count after the last glfwSetClipboardData
+    long                clipboardChangeCount;
+    // Clipboard data returned by the last glfwGetClipboardData
+    void*               clipboardData;
     CGPoint             cascadePoint;
     // Where to place the cursor when re-enabled
     double              restoreCursorPosX, restoreCursorPosY;
@@ -267,6 +273,10 @@ void _glfwDestroyCursorCocoa(_GLFWcursor* cursor);
 void _glfwSetCursorCocoa(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringCocoa(const char* string);
 const char* _glfwGetClipboardStringCocoa(void);
+void _glfwRequestClipboardStringCocoa(void);
+void _glfwCancelClipboardRequestCocoa(void);
+GLFWbool _glfwSetClipboardDataCocoa(void);
+const void* _glfwGetClipboardDataCocoa(const char* type, size_t* size);
 
 EGLenum _glfwGetEGLPlatformCocoa(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayCocoa(void);
@@ -283,13 +293,15 @@ void _glfwGetMonitorWorkareaCocoa(_GLFWmonitor* monitor, int* xpos, int* ypos, i
 GLFWvidmode* _glfwGetVideoModesCocoa(_GLFWmonitor* monitor, int* count);
 GLFWbool _glfwGetVideoModeCocoa(_GLFWmonitor* monitor, GLFWvidmode* mode);
 GLFWbool _glfwGetGammaRampCocoa(_GLFWmonitor* monitor, GLFWgammaramp* ramp);
-void _glfwSetGammaRampCocoa(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+GLFWbool _glfwSetGammaRampCocoa(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+void _glfwFlushGammaRampsCocoa(void);
 
 void _glfwPollMonitorsCocoa(void);
 void _glfwSetVideoModeCocoa(_GLFWmonitor* monitor, const GLFWvidmode* desired);
 void _glfwRestoreVideoModeCocoa(_GLFWmonitor* monitor);
 
 float _glfwTransformYCocoa(float y);
+void _glfwPushClipboardDataCocoa(void);
 
 void* _glfwLoadLocalVulkanLoaderCocoa(void);
 
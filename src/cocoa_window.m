@@ -747,6 +747,78 @@ static const NSRange kEmptyRange = { NSNotFound, 0 };
 @end
 
 
+// Returns the pasteboard type for the specified MIME type
+//
+static NSString* getPasteboardType(const char* type)
+{
+    if (strcmp(type, "text/plain;charset=utf-8") == 0)
+        return NSPasteboardTypeString;
+
+    return @(type);
+}
+
+// Returns whether the pasteboard still holds the data offered with
+// glfwSetClipboardData
+//
+static GLFWbool ownsClipboardData(void)
+{
+    return _glfw.clipboardData.callback &&
+           _glfw.ns.clipboardProvider &&
+           [[NSPasteboard generalPasteboard] changeCount] ==
+               _glfw.ns.clipboardChangeCount;
+}
+
+// Returns the data offered with glfwSetClipboardData for the specified
+// pasteboard type
+//
+static NSData* getClipboardData(NSString* type)
+{
+    for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+    {
+        const char* mimeType = _glfw.clipboardData.types[i];
+        if (![getPasteboardType(mimeType) isEqualToString:type])
+            continue;
+
+        size_t size = 0;
+        const void* data = _glfw.clipboardData.callback(mimeType, &size);
+        if (!data)
+            return nil;
+
+        return [NSData dataWithBytes:data length:size];
+    }
+
+    return nil;
+}
+
+
+//------------------------------------------------------------------------
+// Provider of the data offered with glfwSetClipboardData
+//------------------------------------------------------------------------
+
+@interface GLFWClipboardProvider : NSObject <NSPasteboardItemDataProvider>
+@end
+
+@implementation GLFWClipboardProvider
+
+- (void)pasteboard:(NSPasteboard*)pasteboard
+              item:(NSPasteboardItem*)item
+provideDataForType:(NSString*)type
+{
+    if (!ownsClipboardData())
+        return;
+
+    NSData* data = getClipboardData(type);
+    if (data)
+        [item setData:data forType:type];
+}
+
+- (void)pasteboardFinishedWithDataProvider:(NSPasteboard*)pasteboard
+{
+}
+
+@end
+
+
 //------------------------------------------------------------------------
 // GLFW window class
 //------------------------------------------------------------------------
@@ -912,6 +984,32 @@ float _glfwTransformYCocoa(float y)
     return CGDisplayBounds(CGMainDisplayID()).size.height - y - 1;
 }
 
+// Copies the data offered with glfwSetClipboardData to the pasteboard
+//
+void _glfwPushClipboardDataCocoa(void)
+{
+    @autoreleasepool {
+
+    if (!ownsClipboardData())
+        return;
+
+    NSPasteboardItem* item = [[[NSPasteboardItem alloc] init] autorelease];
+
+    for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+    {
+        NSString* type = getPasteboardType(_glfw.clipboardData.types[i]);
+        NSData* data = getClipboardData(type);
+        if (data)
+            [item setData:data forType:type];
+    }
+
+    NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+    [pasteboard clearContents];
+    [pasteboard writeObjects:@[item]];
+
+    } // autoreleasepool
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -1881,6 +1979,93 @@ const char* _glfwGetClipboardStringCocoa(void)
     } // autoreleasepool
 }
 
+void _glfwRequestClipboardStringCocoa(void)
+{
+    // The clipboard contents are available without waiting for their owner
+    _glfwInputClipboardString(_glfwGetClipboardStringCocoa());
+}
+
+void _glfwCancelClipboardRequestCocoa(void)
+{
+}
+
+GLFWbool _glfwSetClipboardDataCocoa(void)
+{
+    @autoreleasepool {
+
+    if (!_glfw.ns.clipboardProvider)
+        _glfw.ns.clipboardProvider = [[GLFWClipboardProvider alloc] init];
+
+    NSMutableArray* types = [NSMutableArray array];
+    for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+        [types addObject:getPasteboardType(_glfw.clipboardData.types[i])];
+
+    NSPasteboardItem* item = [[[NSPasteboardItem alloc] init] autorelease];
+    if (![item setDataProvider:_glfw.ns.clipboardProvider forTypes:types])
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Cocoa: Failed to set clipboard data provider");
+        return GLFW_FALSE;
+    }
+
+    NSPasteboard* pasteboard = [NSPasteboard generalPasteboard];
+    [pasteboard clearContents];
+
+    if (![pasteboard writeObjects:@[item]])
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Cocoa: Failed to write clipboard data to pasteboard");
+        return GLFW_FALSE;
+    }
+
+    _glfw.ns.clipboardChangeCount = [pasteboard changeCount];
+    return GLFW_TRUE;
+
+    } // autoreleasepool
+}
+
+const void* _glfwGetClipboardDataCocoa(const char* type, size_t* size)
+{
+    @autoreleasepool {
+
+    _glfw_free(_glfw.ns.clipboardData);
+    _glfw.ns.clipboardData = NULL;
+
+    if (ownsClipboardData() && _glfwClipboardDataOffered(type))
+    {
+        // The data is returned directly when the clipboard is ours
+        const void* data = _glfw.clipboardData.callback(type, size);
+        if (data)
+            return data;
+
+        *size = 0;
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Cocoa: Clipboard data is not available as %s", type);
+        return NULL;
+    }
+
+    NSData* object =
+        [[NSPasteboard generalPasteboard] dataForType:getPasteboardType(type)];
+    if (!object)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Cocoa: Clipboard data is not available as %s", type);
+        return NULL;
+    }
+
+    const size_t length = [object length];
+
+    _glfw.ns.clipboardData = _glfw_calloc(length ? length : 1, 1);
+    if (!_glfw.ns.clipboardData)
+        return NULL;
+
+    [object getBytes:_glfw.ns.clipboardData length:length];
+    *size = length;
+    return _glfw.ns.clipboardData;
+
+    } // autoreleasepool
+}
+
 EGLenum _glfwGetEGLPlatformCocoa(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
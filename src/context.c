@@ -30,10 +30,313 @@
 #include <assert.h>
 #include <stdio.h>
 #include <string.h>
-#include <limits.h>
 #include <stdio.h>
 
 
+// Returns the hash of an extension or entry point name
+//
+static uint32_t hashName(const char* name)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*name)
+        hash = (hash ^ (unsigned char) *name++) * 16777619u;
+
+    return hash;
+}
+
+// Returns the hash set slot of the specified extension name, either the one
+// holding it or the empty one where it would be inserted
+//
+static _GLFWextslot* findExtensionSlot(const _GLFWcontext* context,
+                                       const char* name,
+                                       uint32_t hash)
+{
+    int i = (int) (hash & (uint32_t) (context->extensionSlotCount - 1));
+
+    for (;;)
+    {
+        _GLFWextslot* slot = context->extensionSlots + i;
+        if (!slot->name || (slot->hash == hash && strcmp(slot->name, name) == 0))
+            return slot;
+
+        i = (i + 1) & (context->extensionSlotCount - 1);
+    }
+}
+
+// Copies the extension names in a space-separated extension string into the
+// name block and adds them to the hash set
+//
+static char* addExtensionString(_GLFWcontext* context,
+                                char* target,
+                                const char* extensions)
+{
+    while (*extensions)
+    {
+        const size_t length = strcspn(extensions, " ");
+        if (length)
+        {
+            memcpy(target, extensions, length);
+            target[length] = '\0';
+
+            const uint32_t hash = hashName(target);
+            _GLFWextslot* slot = findExtensionSlot(context, target, hash);
+            if (!slot->name)
+            {
+                slot->hash = hash;
+                slot->name = target;
+                target += length + 1;
+            }
+
+            extensions += length;
+        }
+        else
+            extensions++;
+    }
+
+    return target;
+}
+
+// Builds the hash set of the extensions supported by the current context, from
+// both the client API and the context creation API
+// Returns GLFW_FALSE if the extensions could not be retrieved, but GLFW_TRUE
+// without a hash set if it could not be allocated
+//
+static GLFWbool loadExtensionSet(_GLFWwindow* window)
+{
+    _GLFWcontext* context = &window->context;
+    const char* strings[2] = { NULL, NULL };
+    const char** names = NULL;
+    GLint nameCount = 0;
+    size_t size = 0;
+    int i, j, count = 0;
+
+    if (context->major >= 3)
+    {
+        context->GetIntegerv(GL_NUM_EXTENSIONS, &nameCount);
+        if (nameCount > 0)
+        {
+            names = _glfw_calloc(nameCount, sizeof(char*));
+            if (!names)
+                return GLFW_TRUE;
+        }
+
+        for (i = 0;  i < nameCount;  i++)
+        {
+            names[i] = (const char*) context->GetStringi(GL_EXTENSIONS, i);
+            if (!names[i])
+            {
+                _glfwInputError(GLFW_PLATFORM_ERROR,
+                                "Extension string retrieval is broken");
+                _glfw_free(names);
+                return GLFW_FALSE;
+            }
+
+            size += strlen(names[i]) + 1;
+            count++;
+        }
+    }
+    else
+    {
+        strings[0] = (const char*) context->GetString(GL_EXTENSIONS);
+        if (!strings[0])
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Extension string retrieval is broken");
+            return GLFW_FALSE;
+        }
+    }
+
+    strings[1] = context->getExtensionString();
+
+    // Every separator becomes a terminator, so this is enough for any string
+    for (i = 0;  i < 2;  i++)
+    {
+        if (!strings[i])
+            continue;
+
+        size += strlen(strings[i]) + 1;
+        count++;
+
+        for (j = 0;  strings[i][j];  j++)
+        {
+            if (strings[i][j] == ' ')
+                count++;
+        }
+    }
+
+    context->extensionSlotCount = 16;
+    while (context->extensionSlotCount < count * 2)
+        context->extensionSlotCount *= 2;
+
+    context->extensionSlots =
+        _glfw_calloc(context->extensionSlotCount, sizeof(_GLFWextslot));
+    context->extensionNames = _glfw_calloc(size + 1, 1);
+    if (!context->extensionSlots || !context->extensionNames)
+    {
+        _glfw_free(context->extensionSlots);
+        _glfw_free(context->extensionNames);
+        context->extensionSlots = NULL;
+        context->extensionNames = NULL;
+        _glfw_free(names);
+        return GLFW_TRUE;
+    }
+
+    char* target = context->extensionNames;
+
+    for (i = 0;  i < nameCount;  i++)
+        target = addExtensionString(context, target, names[i]);
+
+    for (i = 0;  i < 2;  i++)
+    {
+        if (strings[i])
+            target = addExtensionString(context, target, strings[i]);
+    }
+
+    _glfw_free(names);
+    return GLFW_TRUE;
+}
+
+// Searches the extension strings of the current context one name at a time,
+// for when the hash set could not be allocated
+//
+static GLFWbool searchExtensionStrings(_GLFWwindow* window, const char* extension)
+{
+    _GLFWcontext* context = &window->context;
+
+    if (context->major >= 3)
+    {
+        GLint i, count = 0;
+
+        context->GetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        for (i = 0;  i < count;  i++)
+        {
+            const char* name = (const char*) context->GetStringi(GL_EXTENSIONS, i);
+            if (name && strcmp(name, extension) == 0)
+                return GLFW_TRUE;
+        }
+    }
+    else
+    {
+        const char* extensions = (const char*) context->GetString(GL_EXTENSIONS);
+        if (extensions && _glfwStringInExtensionString(extension, extensions))
+            return GLFW_TRUE;
+    }
+
+    const char* extensions = context->getExtensionString();
+    return extensions && _glfwStringInExtensionString(extension, extensions);
+}
+
+// Returns the memo table slot of the specified entry point name, either the
+// one holding it or the empty one where it would be inserted
+//
+static _GLFWprocslot* findProcSlot(const _GLFWproctable* table,
+                                   const char* name,
+                                   uint32_t hash)
+{
+    int i = (int) (hash & (uint32_t) (table->slotCount - 1));
+
+    for (;;)
+    {
+        _GLFWprocslot* slot = table->slots + i;
+        if (!slot->name || (slot->hash == hash && strcmp(slot->name, name) == 0))
+            return slot;
+
+        i = (i + 1) & (table->slotCount - 1);
+    }
+}
+
+// Allocates an empty entry point memo table with a single reference
+//
+static _GLFWproctable* createProcTable(void)
+{
+    _GLFWproctable* table = _glfw_calloc(1, sizeof(_GLFWproctable));
+    if (!table)
+        return NULL;
+
+    // Loaders usually retrieve several hundred entry points for a context, so
+    // start with enough slots for a typical loader run without growing
+    table->slotCount = 2048;
+    table->slots = _glfw_calloc(table->slotCount, sizeof(_GLFWprocslot));
+    if (!table->slots)
+    {
+        _glfw_free(table);
+        return NULL;
+    }
+
+    if (!_glfwPlatformCreateMutex(&table->lock))
+    {
+        _glfw_free(table->slots);
+        _glfw_free(table);
+        return NULL;
+    }
+
+    table->references = 1;
+    return table;
+}
+
+// Doubles the number of slots of an entry point memo table
+//
+static GLFWbool growProcTable(_GLFWproctable* table)
+{
+    _GLFWprocslot* slots = table->slots;
+    const int slotCount = table->slotCount;
+
+    table->slots = _glfw_calloc(slotCount * 2, sizeof(_GLFWprocslot));
+    if (!table->slots)
+    {
+        table->slots = slots;
+        return GLFW_FALSE;
+    }
+
+    table->slotCount = slotCount * 2;
+
+    for (int i = 0;  i < slotCount;  i++)
+    {
+        if (slots[i].name)
+            *findProcSlot(table, slots[i].name, slots[i].hash) = slots[i];
+    }
+
+    _glfw_free(slots);
+    return GLFW_TRUE;
+}
+
+// Returns the address of the specified entry point for the specified context,
+// retrieving it only if it is not already in the memo table
+// The lock of the memo table must be held when calling this
+//
+static GLFWglproc getMemoizedProcAddress(_GLFWwindow* window, const char* name)
+{
+    _GLFWproctable* table = window->context.procs;
+    const uint32_t hash = hashName(name);
+    _GLFWprocslot* slot = findProcSlot(table, name, hash);
+    if (slot->name)
+        return slot->proc;
+
+    // Entry points that are not found are remembered as well, as loaders look
+    // for many functions of extensions the context does not support
+    const GLFWglproc proc = window->context.getProcAddress(name);
+
+    if ((table->count + 1) * 2 > table->slotCount)
+    {
+        if (!growProcTable(table))
+            return proc;
+
+        slot = findProcSlot(table, name, hash);
+    }
+
+    slot->name = _glfw_strdup(name);
+    if (!slot->name)
+        return proc;
+
+    slot->hash = hash;
+    slot->proc = proc;
+    table->count++;
+    return proc;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -178,166 +481,83 @@ GLFWbool _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig)
     return GLFW_TRUE;
 }
 
-// Chooses the framebuffer config that best matches the desired one
+// Allocates a framebuffer config cache with room for the specified number of
+// configs
 //
-const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
-                                         const _GLFWfbconfig* alternatives,
-                                         unsigned int count)
+_GLFWfbconfigcache* _glfwAllocFBConfigCache(int count)
 {
-    unsigned int i;
-    unsigned int missing, leastMissing = UINT_MAX;
-    unsigned int colorDiff, leastColorDiff = UINT_MAX;
-    unsigned int extraDiff, leastExtraDiff = UINT_MAX;
-    const _GLFWfbconfig* current;
-    const _GLFWfbconfig* closest = NULL;
+    _GLFWfbconfigcache* cache = _glfw_calloc(1, sizeof(_GLFWfbconfigcache));
+    if (!cache)
+        return NULL;
 
-    for (i = 0;  i < count;  i++)
+    if (count)
     {
-        current = alternatives + i;
-
-        if (desired->stereo > 0 && current->stereo == 0)
+        cache->configs = _glfw_calloc(count, sizeof(_GLFWfbconfig));
+        cache->types = _glfw_calloc(count, sizeof(int));
+        if (!cache->configs || !cache->types)
         {
-            // Stereo is a hard constraint
-            continue;
+            _glfwFreeFBConfigCache(cache);
+            return NULL;
         }
+    }
 
-        // Count number of missing buffers
-        {
-            missing = 0;
-
-            if (desired->alphaBits > 0 && current->alphaBits == 0)
-                missing++;
-
-            if (desired->depthBits > 0 && current->depthBits == 0)
-                missing++;
-
-            if (desired->stencilBits > 0 && current->stencilBits == 0)
-                missing++;
-
-            if (desired->auxBuffers > 0 &&
-                current->auxBuffers < desired->auxBuffers)
-            {
-                missing += desired->auxBuffers - current->auxBuffers;
-            }
+    return cache;
+}
 
-            if (desired->samples > 0 && current->samples == 0)
-            {
-                // Technically, several multisampling buffers could be
-                // involved, but that's a lower level implementation detail and
-                // not important to us here, so we count them as one
-                missing++;
-            }
+// Frees a framebuffer config cache
+//
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache)
+{
+    if (!cache)
+        return;
 
-            if (desired->transparent != current->transparent)
-                missing++;
-        }
+    _glfw_free(cache->configs);
+    _glfw_free(cache->types);
+    _glfw_free(cache);
+}
 
-        // These polynomials make many small channel size differences matter
-        // less than one large channel size difference
+// Looks for the native config previously chosen for the same hints and the
+// same context creation API specific key
+//
+GLFWbool _glfwFindFBConfigChoice(const _GLFWfbconfigcache* cache,
+                                 const _GLFWfbconfig* desired,
+                                 int key,
+                                 uintptr_t* handle)
+{
+    _GLFWfbconfig hints = *desired;
+    hints.handle = 0;
 
-        // Calculate color channel size difference value
+    for (int i = 0;  i < cache->choiceCount;  i++)
+    {
+        if (cache->choices[i].key == key &&
+            memcmp(&cache->choices[i].desired, &hints, sizeof(hints)) == 0)
         {
-            colorDiff = 0;
-
-            if (desired->redBits != GLFW_DONT_CARE)
-            {
-                colorDiff += (desired->redBits - current->redBits) *
-                             (desired->redBits - current->redBits);
-            }
-
-            if (desired->greenBits != GLFW_DONT_CARE)
-            {
-                colorDiff += (desired->greenBits - current->greenBits) *
-                             (desired->greenBits - current->greenBits);
-            }
-
-            if (desired->blueBits != GLFW_DONT_CARE)
-            {
-                colorDiff += (desired->blueBits - current->blueBits) *
-                             (desired->blueBits - current->blueBits);
-            }
+            *handle = cache->choices[i].handle;
+            return GLFW_TRUE;
         }
+    }
 
-        // Calculate non-color channel size difference value
-        {
-            extraDiff = 0;
-
-            if (desired->alphaBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->alphaBits - current->alphaBits) *
-                             (desired->alphaBits - current->alphaBits);
-            }
-
-            if (desired->depthBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->depthBits - current->depthBits) *
-                             (desired->depthBits - current->depthBits);
-            }
-
-            if (desired->stencilBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->stencilBits - current->stencilBits) *
-                             (desired->stencilBits - current->stencilBits);
-            }
-
-            if (desired->accumRedBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->accumRedBits - current->accumRedBits) *
-                             (desired->accumRedBits - current->accumRedBits);
-            }
-
-            if (desired->accumGreenBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->accumGreenBits - current->accumGreenBits) *
-                             (desired->accumGreenBits - current->accumGreenBits);
-            }
-
-            if (desired->accumBlueBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->accumBlueBits - current->accumBlueBits) *
-                             (desired->accumBlueBits - current->accumBlueBits);
-            }
-
-            if (desired->accumAlphaBits != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->accumAlphaBits - current->accumAlphaBits) *
-                             (desired->accumAlphaBits - current->accumAlphaBits);
-            }
-
-            if (desired->samples != GLFW_DONT_CARE)
-            {
-                extraDiff += (desired->samples - current->samples) *
-                             (desired->samples - current->samples);
-            }
-
-            if (desired->sRGB && !current->sRGB)
-                extraDiff++;
-        }
+    return GLFW_FALSE;
+}
 
-        // Figure out if the current one is better than the best one found so far
-        // Least number of missing buffers is the most important heuristic,
-        // then color buffer size match and lastly size match for other buffers
+// Remembers the native config chosen for the specified hints, replacing the
+// oldest choice if there is no room left
+//
+void _glfwAddFBConfigChoice(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int key,
+                            uintptr_t handle)
+{
+    const int index = cache->nextChoice;
 
-        if (missing < leastMissing)
-            closest = current;
-        else if (missing == leastMissing)
-        {
-            if ((colorDiff < leastColorDiff) ||
-                (colorDiff == leastColorDiff && extraDiff < leastExtraDiff))
-            {
-                closest = current;
-            }
-        }
+    cache->choices[index].desired = *desired;
+    cache->choices[index].desired.handle = 0;
+    cache->choices[index].key = key;
+    cache->choices[index].handle = handle;
 
-        if (current == closest)
-        {
-            leastMissing = missing;
-            leastColorDiff = colorDiff;
-            leastExtraDiff = extraDiff;
-        }
-    }
-
-    return closest;
+    cache->nextChoice = (index + 1) % _GLFW_FBCONFIG_CHOICE_COUNT;
+    if (cache->choiceCount < _GLFW_FBCONFIG_CHOICE_COUNT)
+        cache->choiceCount++;
 }
 
 // Retrieves the attributes of the current context
@@ -565,6 +785,27 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
             window->context.release = GLFW_RELEASE_BEHAVIOR_FLUSH;
     }
 
+    // All contexts of a share group use the same entry point memo table, so
+    // that loading entry points for another shared context is almost free
+    // NOTE: WGL entry points are only valid for contexts with the same pixel
+    //       format and driver, which sharing does not guarantee, so every WGL
+    //       context gets its own table
+    // NOTE: The table is created here and only referenced or released when
+    //       a context is created or destroyed, both of which happen only on the
+    //       main thread, so only the lookups themselves need locking
+    if (ctxconfig->share && ctxconfig->share->context.procs &&
+        !(_glfw.platform.platformID == GLFW_PLATFORM_WIN32 &&
+          ctxconfig->source == GLFW_NATIVE_CONTEXT_API))
+    {
+        window->context.procs = ctxconfig->share->context.procs;
+        window->context.procs->references++;
+    }
+    else
+    {
+        // Entry points are looked up without memoization if this fails
+        window->context.procs = createProcTable();
+    }
+
     // Clearing the front buffer to black to avoid garbage pixels left over from
     // previous uses of our bit of VRAM
     {
@@ -580,6 +821,28 @@ GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
     return GLFW_TRUE;
 }
 
+// Releases the entry point memo table reference of the specified context and
+// destroys the table if that was the last one
+//
+void _glfwReleaseProcTable(_GLFWwindow* window)
+{
+    _GLFWproctable* table = window->context.procs;
+    if (!table)
+        return;
+
+    if (--table->references == 0)
+    {
+        for (int i = 0;  i < table->slotCount;  i++)
+            _glfw_free(table->slots[i].name);
+
+        _glfwPlatformDestroyMutex(&table->lock);
+        _glfw_free(table->slots);
+        _glfw_free(table);
+    }
+
+    window->context.procs = NULL;
+}
+
 // Searches an extension string for the specified extension
 //
 GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions)
@@ -700,49 +963,19 @@ GLFWAPI int glfwExtensionSupported(const char* extension)
         return GLFW_FALSE;
     }
 
-    if (window->context.major >= 3)
-    {
-        int i;
-        GLint count;
-
-        // Check if extension is in the modern OpenGL extensions string list
-
-        window->context.GetIntegerv(GL_NUM_EXTENSIONS, &count);
-
-        for (i = 0;  i < count;  i++)
-        {
-            const char* en = (const char*)
-                window->context.GetStringi(GL_EXTENSIONS, i);
-            if (!en)
-            {
-                _glfwInputError(GLFW_PLATFORM_ERROR,
-                                "Extension string retrieval is broken");
-                return GLFW_FALSE;
-            }
-
-            if (strcmp(en, extension) == 0)
-                return GLFW_TRUE;
-        }
-    }
-    else
+    // The extensions of a context cannot change, so they are only retrieved
+    // and parsed on the first query
+    if (!window->context.extensionSlots)
     {
-        // Check if extension is in the old style OpenGL extensions string
-
-        const char* extensions = (const char*)
-            window->context.GetString(GL_EXTENSIONS);
-        if (!extensions)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "Extension string retrieval is broken");
+        if (!loadExtensionSet(window))
             return GLFW_FALSE;
-        }
 
-        if (_glfwStringInExtensionString(extension, extensions))
-            return GLFW_TRUE;
+        if (!window->context.extensionSlots)
+            return searchExtensionStrings(window, extension);
     }
 
-    // Check if extension is in the platform-specific string
-    return window->context.extensionSupported(extension);
+    const uint32_t hash = hashName(extension);
+    return findExtensionSlot(&window->context, extension, hash)->name != NULL;
 }
 
 GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
@@ -760,6 +993,66 @@ GLFWAPI GLFWglproc glfwGetProcAddress(const char* procname)
         return NULL;
     }
 
-    return window->context.getProcAddress(procname);
+    _GLFWproctable* table = window->context.procs;
+    if (!table)
+        return window->context.getProcAddress(procname);
+
+    _glfwPlatformLockMutex(&table->lock);
+    const GLFWglproc proc = getMemoizedProcAddress(window, procname);
+    _glfwPlatformUnlockMutex(&table->lock);
+
+    return proc;
+}
+
+GLFWAPI int glfwGetProcAddresses(const char* const* procnames,
+                                 int count,
+                                 GLFWglproc* procs)
+{
+    _GLFWwindow* window;
+    int i, found = 0;
+
+    assert(count == 0 || procnames != NULL);
+    assert(count == 0 || procs != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(0);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid entry point count %i", count);
+        return 0;
+    }
+
+    window = _glfwPlatformGetTls(&_glfw.contextSlot);
+    if (!window)
+    {
+        _glfwInputError(GLFW_NO_CURRENT_CONTEXT,
+                        "Cannot query entry points without a current OpenGL or OpenGL ES context");
+
+        for (i = 0;  i < count;  i++)
+            procs[i] = NULL;
+
+        return 0;
+    }
+
+    _GLFWproctable* table = window->context.procs;
+    if (table)
+        _glfwPlatformLockMutex(&table->lock);
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (table)
+            procs[i] = getMemoizedProcAddress(window, procnames[i]);
+        else
+            procs[i] = window->context.getProcAddress(procnames[i]);
+
+        if (procs[i])
+            found++;
+    }
+
+    if (table)
+        _glfwPlatformUnlockMutex(&table->lock);
+
+    return found;
 }
 
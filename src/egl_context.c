@@ -83,56 +83,42 @@ static int getEGLConfigAttrib(EGLConfig config, int attrib)
     return value;
 }
 
-// Return the EGLConfig most closely matching the specified hints
+// Translates the usable EGLConfigs of the display, which do not change for the
+// lifetime of the display
 //
-static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
-                                const _GLFWfbconfig* fbconfig,
-                                EGLConfig* result)
+static _GLFWfbconfigcache* loadEGLConfigs(void)
 {
     EGLConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int i, nativeCount, usableCount, apiBit, surfaceTypeBit;
-    GLFWbool wrongApiAvailable = GLFW_FALSE;
-
-    if (ctxconfig->client == GLFW_OPENGL_ES_API)
-    {
-        if (ctxconfig->major == 1)
-            apiBit = EGL_OPENGL_ES_BIT;
-        else
-            apiBit = EGL_OPENGL_ES2_BIT;
-    }
-    else
-        apiBit = EGL_OPENGL_BIT;
+    _GLFWfbconfigcache* cache;
+    int i, nativeCount, surfaceTypeBit;
 
     if (_glfw.egl.platform == EGL_PLATFORM_SURFACELESS_MESA)
         surfaceTypeBit = EGL_PBUFFER_BIT;
     else
         surfaceTypeBit = EGL_WINDOW_BIT;
 
-    if (fbconfig->stereo)
-    {
-        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
-        return GLFW_FALSE;
-    }
-
     eglGetConfigs(_glfw.egl.display, NULL, 0, &nativeCount);
     if (!nativeCount)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE, "EGL: No EGLConfigs returned");
-        return GLFW_FALSE;
+        return NULL;
     }
 
     nativeConfigs = _glfw_calloc(nativeCount, sizeof(EGLConfig));
-    eglGetConfigs(_glfw.egl.display, nativeConfigs, nativeCount, &nativeCount);
+    cache = _glfwAllocFBConfigCache(nativeCount);
+    if (!nativeConfigs || !cache)
+    {
+        _glfw_free(nativeConfigs);
+        _glfwFreeFBConfigCache(cache);
+        return NULL;
+    }
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    eglGetConfigs(_glfw.egl.display, nativeConfigs, nativeCount, &nativeCount);
 
     for (i = 0;  i < nativeCount;  i++)
     {
         const EGLConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGB(A) EGLConfigs
         if (getEGLConfigAttrib(n, EGL_COLOR_BUFFER_TYPE) != EGL_RGB_BUFFER)
@@ -151,25 +137,18 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
             if (!vi.visualid)
                 continue;
 
-            if (fbconfig->transparent)
+            int count;
+            XVisualInfo* vis =
+                XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
+            if (vis)
             {
-                int count;
-                XVisualInfo* vis =
-                    XGetVisualInfo(_glfw.x11.display, VisualIDMask, &vi, &count);
-                if (vis)
-                {
-                    u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
-                    XFree(vis);
-                }
+                u->transparent = _glfwIsVisualTransparentX11(vis[0].visual);
+                XFree(vis);
             }
         }
 #endif // _GLFW_X11
 
-        if (!(getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE) & apiBit))
-        {
-            wrongApiAvailable = GLFW_TRUE;
-            continue;
-        }
+        cache->types[cache->count] = getEGLConfigAttrib(n, EGL_RENDERABLE_TYPE);
 
         u->redBits = getEGLConfigAttrib(n, EGL_RED_SIZE);
         u->greenBits = getEGLConfigAttrib(n, EGL_GREEN_SIZE);
@@ -179,6 +158,71 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         u->depthBits = getEGLConfigAttrib(n, EGL_DEPTH_SIZE);
         u->stencilBits = getEGLConfigAttrib(n, EGL_STENCIL_SIZE);
 
+        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
+
+        u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    _glfw_free(nativeConfigs);
+    return cache;
+}
+
+// Return the EGLConfig most closely matching the specified hints
+//
+static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
+                                const _GLFWfbconfig* fbconfig,
+                                EGLConfig* result)
+{
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int i, usableCount, apiBit;
+    GLFWbool wrongApiAvailable = GLFW_FALSE;
+    uintptr_t handle;
+
+    if (ctxconfig->client == GLFW_OPENGL_ES_API)
+    {
+        if (ctxconfig->major == 1)
+            apiBit = EGL_OPENGL_ES_BIT;
+        else
+            apiBit = EGL_OPENGL_ES2_BIT;
+    }
+    else
+        apiBit = EGL_OPENGL_BIT;
+
+    if (fbconfig->stereo)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE, "EGL: Stereo rendering not supported");
+        return GLFW_FALSE;
+    }
+
+    if (!_glfw.egl.fbconfigs)
+    {
+        _glfw.egl.fbconfigs = loadEGLConfigs();
+        if (!_glfw.egl.fbconfigs)
+            return GLFW_FALSE;
+    }
+
+    if (_glfwFindFBConfigChoice(_glfw.egl.fbconfigs, fbconfig, apiBit, &handle))
+    {
+        *result = (EGLConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    usableConfigs = _glfw_calloc(_glfw.egl.fbconfigs->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (i = 0;  i < _glfw.egl.fbconfigs->count;  i++)
+    {
+        const _GLFWfbconfig* c = _glfw.egl.fbconfigs->configs + i;
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (!(_glfw.egl.fbconfigs->types[i] & apiBit))
+        {
+            wrongApiAvailable = GLFW_TRUE;
+            continue;
+        }
+
 #if defined(_GLFW_WAYLAND)
         if (_glfw.platform.platformID == GLFW_PLATFORM_WAYLAND)
         {
@@ -188,22 +232,28 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
             //       with an alpha channel to ensure the buffer is opaque
             if (!_glfw.egl.EXT_present_opaque)
             {
-                if (!fbconfig->transparent && u->alphaBits > 0)
+                if (!fbconfig->transparent && c->alphaBits > 0)
                     continue;
             }
         }
 #endif // _GLFW_WAYLAND
 
-        u->samples = getEGLConfigAttrib(n, EGL_SAMPLES);
-        u->doublebuffer = fbconfig->doublebuffer;
+        *u = *c;
 
-        u->handle = (uintptr_t) n;
+        // Transparency is only a criterion if it was requested
+        if (!fbconfig->transparent)
+            u->transparent = GLFW_FALSE;
+
+        u->doublebuffer = fbconfig->doublebuffer;
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(fbconfig, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (EGLConfig) closest->handle;
+        _glfwAddFBConfigChoice(_glfw.egl.fbconfigs, fbconfig, apiBit, closest->handle);
+    }
     else
     {
         if (wrongApiAvailable)
@@ -234,7 +284,6 @@ static GLFWbool chooseEGLConfig(const _GLFWctxconfig* ctxconfig,
         }
     }
 
-    _glfw_free(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
@@ -298,9 +347,14 @@ static void swapIntervalEGL(int interval)
     eglSwapInterval(_glfw.egl.display, interval);
 }
 
+static const char* getExtensionStringEGL(void)
+{
+    return eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
+}
+
 static int extensionSupportedEGL(const char* extension)
 {
-    const char* extensions = eglQueryString(_glfw.egl.display, EGL_EXTENSIONS);
+    const char* extensions = getExtensionStringEGL();
     if (extensions)
     {
         if (_glfwStringInExtensionString(extension, extensions))
@@ -549,6 +603,9 @@ GLFWbool _glfwInitEGL(void)
 //
 void _glfwTerminateEGL(void)
 {
+    _glfwFreeFBConfigCache(_glfw.egl.fbconfigs);
+    _glfw.egl.fbconfigs = NULL;
+
     if (_glfw.egl.display)
     {
         eglTerminate(_glfw.egl.display);
@@ -847,7 +904,7 @@ GLFWbool _glfwCreateContextEGL(_GLFWwindow* window,
     window->context.makeCurrent = makeContextCurrentEGL;
     window->context.swapBuffers = swapBuffersEGL;
     window->context.swapInterval = swapIntervalEGL;
-    window->context.extensionSupported = extensionSupportedEGL;
+    window->context.getExtensionString = getExtensionStringEGL;
     window->context.getProcAddress = getProcAddressEGL;
     window->context.destroy = destroyContextEGL;
 
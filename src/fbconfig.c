@@ -0,0 +1,535 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#include "fbconfig.h"
+#include "simd.h"
+
+#include <stddef.h>
+
+// The value of GLFW_DONT_CARE, as glfw3.h is not included here
+#define _GLFW_FB_DONT_CARE -1
+
+// The score of a config, where lower is better, and the index of the config
+//
+typedef struct _GLFWfbscore
+{
+    uint32_t    missing;
+    uint32_t    colorDiff;
+    uint32_t    extraDiff;
+    uint32_t    index;
+} _GLFWfbscore;
+
+// Returns the squared difference of two channel sizes, with the same result as
+// the signed arithmetic of the original scoring but without overflow
+//
+static uint32_t squareDiff(int32_t desired, int32_t current)
+{
+    const uint32_t diff = (uint32_t) desired - (uint32_t) current;
+    return diff * diff;
+}
+
+// Returns whether the first score is better than the second
+//
+// Least number of missing buffers is the most important heuristic, then color
+// buffer size match and lastly size match for other buffers, with the first of
+// several equally good configs being chosen
+//
+static int isBetterScore(const _GLFWfbscore* first, const _GLFWfbscore* second)
+{
+    if (first->missing != second->missing)
+        return first->missing < second->missing;
+    if (first->colorDiff != second->colorDiff)
+        return first->colorDiff < second->colorDiff;
+    if (first->extraDiff != second->extraDiff)
+        return first->extraDiff < second->extraDiff;
+
+    return first->index < second->index;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        Scalar kernel                         //////
+//////////////////////////////////////////////////////////////////////////
+
+// Scores a range of configs, replacing the best score with any better one
+//
+// The branches of the scalar kernel only depend on the desired config, so they
+// are cheaper than the masking of the vector kernels
+//
+static void scoreScalar(const _GLFWfbconfig* configs,
+                        const _GLFWfbconfig* desired,
+                        unsigned int first,
+                        unsigned int count,
+                        _GLFWfbscore* best)
+{
+    for (unsigned int i = first;  i < count;  i++)
+    {
+        const _GLFWfbconfig* current = configs + i;
+        _GLFWfbscore score = { 0, 0, 0, i };
+
+        // Stereo is a hard constraint
+        if (desired->stereo > 0 && current->stereo == 0)
+            continue;
+
+        // Count number of missing buffers, with several multisampling buffers
+        // counted as one
+        if (desired->alphaBits > 0 && current->alphaBits == 0)
+            score.missing++;
+        if (desired->depthBits > 0 && current->depthBits == 0)
+            score.missing++;
+        if (desired->stencilBits > 0 && current->stencilBits == 0)
+            score.missing++;
+        if (desired->auxBuffers > 0 && current->auxBuffers < desired->auxBuffers)
+            score.missing += (uint32_t) desired->auxBuffers - (uint32_t) current->auxBuffers;
+        if (desired->samples > 0 && current->samples == 0)
+            score.missing++;
+        if (desired->transparent != current->transparent)
+            score.missing++;
+
+        // These polynomials make many small channel size differences matter
+        // less than one large channel size difference
+        if (desired->redBits != _GLFW_FB_DONT_CARE)
+            score.colorDiff += squareDiff(desired->redBits, current->redBits);
+        if (desired->greenBits != _GLFW_FB_DONT_CARE)
+            score.colorDiff += squareDiff(desired->greenBits, current->greenBits);
+        if (desired->blueBits != _GLFW_FB_DONT_CARE)
+            score.colorDiff += squareDiff(desired->blueBits, current->blueBits);
+
+        if (desired->alphaBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->alphaBits, current->alphaBits);
+        if (desired->depthBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->depthBits, current->depthBits);
+        if (desired->stencilBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->stencilBits, current->stencilBits);
+        if (desired->accumRedBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->accumRedBits, current->accumRedBits);
+        if (desired->accumGreenBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->accumGreenBits, current->accumGreenBits);
+        if (desired->accumBlueBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->accumBlueBits, current->accumBlueBits);
+        if (desired->accumAlphaBits != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->accumAlphaBits, current->accumAlphaBits);
+        if (desired->samples != _GLFW_FB_DONT_CARE)
+            score.extraDiff += squareDiff(desired->samples, current->samples);
+        if (desired->sRGB && !current->sRGB)
+            score.extraDiff++;
+
+        if (isBetterScore(&score, best))
+            *best = score;
+    }
+}
+
+// Chooses a config one config at a time
+//
+// Every kernel starts from the worst possible score, which is never replaced by
+// a config with that score, just like in the original selection
+//
+static const _GLFWfbconfig* chooseScalar(const _GLFWfbconfig* desired,
+                                         const _GLFWfbconfig* alternatives,
+                                         unsigned int count)
+{
+    _GLFWfbscore best = { UINT32_MAX, UINT32_MAX, UINT32_MAX, 0 };
+
+    scoreScalar(alternatives, desired, 0, count, &best);
+
+    if (best.missing == UINT32_MAX &&
+        best.colorDiff == UINT32_MAX &&
+        best.extraDiff == UINT32_MAX)
+    {
+        return NULL;
+    }
+
+    return alternatives + best.index;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                         AVX2 kernel                          //////
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(_GLFW_SIMD_AVX2)
+
+// The number of configs scored at a time, small enough for the block to stay
+// on the stack
+#define _GLFW_FB_BLOCK_SIZE 64
+
+// Indices of the attributes of a block, in the order of the members of
+// _GLFWfbconfig
+enum
+{
+    _GLFW_FB_RED,
+    _GLFW_FB_GREEN,
+    _GLFW_FB_BLUE,
+    _GLFW_FB_ALPHA,
+    _GLFW_FB_DEPTH,
+    _GLFW_FB_STENCIL,
+    _GLFW_FB_ACCUM_RED,
+    _GLFW_FB_ACCUM_GREEN,
+    _GLFW_FB_ACCUM_BLUE,
+    _GLFW_FB_ACCUM_ALPHA,
+    _GLFW_FB_AUX,
+    _GLFW_FB_STEREO,
+    _GLFW_FB_SAMPLES,
+    _GLFW_FB_SRGB,
+    _GLFW_FB_DOUBLEBUFFER,
+    _GLFW_FB_TRANSPARENT,
+    _GLFW_FB_ATTRIB_COUNT
+};
+
+// The attributes are loaded four configs at a time as rows of sixteen ints,
+// which relies on them being the first members of _GLFWfbconfig
+typedef char _GLFWfblayoutcheck
+    [offsetof(_GLFWfbconfig, transparent) == _GLFW_FB_TRANSPARENT * sizeof(int) ? 1 : -1];
+
+// Attributes of a block of framebuffer configs, one array per attribute, so
+// that several configs are scored by the same vector operations
+//
+typedef struct _GLFWfbblock
+{
+    int32_t     attribs[_GLFW_FB_ATTRIB_COUNT][_GLFW_FB_BLOCK_SIZE];
+} _GLFWfbblock;
+
+// The desired attributes, with every condition of the scoring turned into
+// a mask of all zeroes or all ones
+//
+typedef struct _GLFWfbmasks
+{
+    int32_t     red, green, blue;
+    int32_t     alpha, depth, stencil;
+    int32_t     accumRed, accumGreen, accumBlue, accumAlpha;
+    int32_t     aux, samples, transparent;
+    uint32_t    useRed, useGreen, useBlue;
+    uint32_t    useAlpha, useDepth, useStencil;
+    uint32_t    useAccumRed, useAccumGreen, useAccumBlue, useAccumAlpha;
+    uint32_t    useSamples;
+    uint32_t    needAlpha, needDepth, needStencil, needAux, needSamples;
+    uint32_t    needStereo, needSRGB;
+} _GLFWfbmasks;
+
+// Returns a mask of all ones if the condition is true, otherwise all zeroes
+//
+static uint32_t maskIf(int condition)
+{
+    return 0u - (uint32_t) (condition != 0);
+}
+
+// Turns the desired attributes into masks
+//
+static void prepareMasks(_GLFWfbmasks* m, const _GLFWfbconfig* desired)
+{
+    m->red = desired->redBits;
+    m->green = desired->greenBits;
+    m->blue = desired->blueBits;
+    m->alpha = desired->alphaBits;
+    m->depth = desired->depthBits;
+    m->stencil = desired->stencilBits;
+    m->accumRed = desired->accumRedBits;
+    m->accumGreen = desired->accumGreenBits;
+    m->accumBlue = desired->accumBlueBits;
+    m->accumAlpha = desired->accumAlphaBits;
+    m->aux = desired->auxBuffers;
+    m->samples = desired->samples;
+    m->transparent = desired->transparent;
+
+    m->useRed = maskIf(desired->redBits != _GLFW_FB_DONT_CARE);
+    m->useGreen = maskIf(desired->greenBits != _GLFW_FB_DONT_CARE);
+    m->useBlue = maskIf(desired->blueBits != _GLFW_FB_DONT_CARE);
+    m->useAlpha = maskIf(desired->alphaBits != _GLFW_FB_DONT_CARE);
+    m->useDepth = maskIf(desired->depthBits != _GLFW_FB_DONT_CARE);
+    m->useStencil = maskIf(desired->stencilBits != _GLFW_FB_DONT_CARE);
+    m->useAccumRed = maskIf(desired->accumRedBits != _GLFW_FB_DONT_CARE);
+    m->useAccumGreen = maskIf(desired->accumGreenBits != _GLFW_FB_DONT_CARE);
+    m->useAccumBlue = maskIf(desired->accumBlueBits != _GLFW_FB_DONT_CARE);
+    m->useAccumAlpha = maskIf(desired->accumAlphaBits != _GLFW_FB_DONT_CARE);
+    m->useSamples = maskIf(desired->samples != _GLFW_FB_DONT_CARE);
+
+    m->needAlpha = maskIf(desired->alphaBits > 0);
+    m->needDepth = maskIf(desired->depthBits > 0);
+    m->needStencil = maskIf(desired->stencilBits > 0);
+    m->needAux = maskIf(desired->auxBuffers > 0);
+    m->needSamples = maskIf(desired->samples > 0);
+    m->needStereo = maskIf(desired->stereo > 0);
+    m->needSRGB = maskIf(desired->sRGB);
+}
+
+// Copies the attributes of a range of configs into a block, four configs at
+// a time, leaving any remaining configs to be scored by the scalar kernel
+//
+_GLFW_AVX2_FUNCTION
+static void loadBlock(_GLFWfbblock* block,
+                      const _GLFWfbconfig* configs,
+                      unsigned int count)
+{
+    // Transpose four configs at a time, four attributes at a time
+    for (unsigned int i = 0;  i + 4 <= count;  i += 4)
+    {
+        for (int j = 0;  j < _GLFW_FB_ATTRIB_COUNT;  j += 4)
+        {
+            const __m128i c0 = _mm_loadu_si128((const __m128i*) (&configs[i + 0].redBits + j));
+            const __m128i c1 = _mm_loadu_si128((const __m128i*) (&configs[i + 1].redBits + j));
+            const __m128i c2 = _mm_loadu_si128((const __m128i*) (&configs[i + 2].redBits + j));
+            const __m128i c3 = _mm_loadu_si128((const __m128i*) (&configs[i + 3].redBits + j));
+            const __m128i lo01 = _mm_unpacklo_epi32(c0, c1);
+            const __m128i lo23 = _mm_unpacklo_epi32(c2, c3);
+            const __m128i hi01 = _mm_unpackhi_epi32(c0, c1);
+            const __m128i hi23 = _mm_unpackhi_epi32(c2, c3);
+
+            _mm_storeu_si128((__m128i*) (block->attribs[j + 0] + i),
+                             _mm_unpacklo_epi64(lo01, lo23));
+            _mm_storeu_si128((__m128i*) (block->attribs[j + 1] + i),
+                             _mm_unpackhi_epi64(lo01, lo23));
+            _mm_storeu_si128((__m128i*) (block->attribs[j + 2] + i),
+                             _mm_unpacklo_epi64(hi01, hi23));
+            _mm_storeu_si128((__m128i*) (block->attribs[j + 3] + i),
+                             _mm_unpackhi_epi64(hi01, hi23));
+        }
+    }
+}
+
+// Replaces the best score with any better one of the best scores of the lanes
+// of a vector kernel
+//
+static void mergeLaneScores(const uint32_t* missing,
+                            const uint32_t* colorDiff,
+                            const uint32_t* extraDiff,
+                            const uint32_t* index,
+                            unsigned int count,
+                            _GLFWfbscore* best)
+{
+    for (unsigned int i = 0;  i < count;  i++)
+    {
+        const _GLFWfbscore score = { missing[i], colorDiff[i], extraDiff[i], index[i] };
+
+        if (isBetterScore(&score, best))
+            *best = score;
+    }
+}
+
+_GLFW_AVX2_FUNCTION
+static __m256i squareDiffAVX2(__m256i desired, __m256i current)
+{
+    const __m256i diff = _mm256_sub_epi32(desired, current);
+    return _mm256_mullo_epi32(diff, diff);
+}
+
+// Returns one where a needed buffer is absent, otherwise zero
+//
+_GLFW_AVX2_FUNCTION
+static __m256i countMissingAVX2(__m256i need, __m256i current)
+{
+    const __m256i absent = _mm256_cmpeq_epi32(current, _mm256_setzero_si256());
+    return _mm256_and_si256(_mm256_and_si256(need, absent), _mm256_set1_epi32(1));
+}
+
+// Returns all ones where the first unsigned value is less than the second
+//
+_GLFW_AVX2_FUNCTION
+static __m256i lessAVX2(__m256i first, __m256i second)
+{
+    const __m256i bias = _mm256_set1_epi32((int) 0x80000000);
+    return _mm256_cmpgt_epi32(_mm256_xor_si256(second, bias),
+                              _mm256_xor_si256(first, bias));
+}
+
+_GLFW_AVX2_FUNCTION
+static void scoreAVX2(const _GLFWfbblock* b,
+                      const _GLFWfbconfig* configs,
+                      const _GLFWfbconfig* desired,
+                      const _GLFWfbmasks* masks,
+                      unsigned int first,
+                      unsigned int count,
+                      _GLFWfbscore* best)
+{
+    const _GLFWfbmasks m = *masks;
+    const int32_t (*a)[_GLFW_FB_BLOCK_SIZE] = b->attribs;
+    unsigned int i = first;
+
+    __m256i bestMissing = _mm256_set1_epi32(-1);
+    __m256i bestColorDiff = _mm256_set1_epi32(-1);
+    __m256i bestExtraDiff = _mm256_set1_epi32(-1);
+    __m256i bestIndex = _mm256_setzero_si256();
+    __m256i index = _mm256_add_epi32(_mm256_set1_epi32((int) first),
+                                     _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+
+#define _GLFW_LOAD(attrib) _mm256_loadu_si256((const __m256i*) (a[attrib] + i))
+#define _GLFW_SET(value) _mm256_set1_epi32((int) (value))
+#define _GLFW_DIFF(use, desired, attrib) \
+    _mm256_and_si256(_GLFW_SET(use), squareDiffAVX2(_GLFW_SET(desired), _GLFW_LOAD(attrib)))
+
+    for (;  i + 8 <= count;  i += 8)
+    {
+        const __m256i aux = _GLFW_LOAD(_GLFW_FB_AUX);
+        const __m256i lessAux = _mm256_cmpgt_epi32(_GLFW_SET(m.aux), aux);
+        const __m256i transparent =
+            _mm256_cmpeq_epi32(_GLFW_LOAD(_GLFW_FB_TRANSPARENT), _GLFW_SET(m.transparent));
+
+        __m256i missing = countMissingAVX2(_GLFW_SET(m.needAlpha), _GLFW_LOAD(_GLFW_FB_ALPHA));
+        missing = _mm256_add_epi32(missing, countMissingAVX2(_GLFW_SET(m.needDepth),
+                                                             _GLFW_LOAD(_GLFW_FB_DEPTH)));
+        missing = _mm256_add_epi32(missing, countMissingAVX2(_GLFW_SET(m.needStencil),
+                                                             _GLFW_LOAD(_GLFW_FB_STENCIL)));
+        missing = _mm256_add_epi32(missing, countMissingAVX2(_GLFW_SET(m.needSamples),
+                                                             _GLFW_LOAD(_GLFW_FB_SAMPLES)));
+        missing = _mm256_add_epi32(missing,
+                                   _mm256_and_si256(_mm256_and_si256(_GLFW_SET(m.needAux), lessAux),
+                                                    _mm256_sub_epi32(_GLFW_SET(m.aux), aux)));
+        missing = _mm256_add_epi32(missing,
+                                   _mm256_andnot_si256(transparent, _mm256_set1_epi32(1)));
+
+        __m256i colorDiff = _GLFW_DIFF(m.useRed, m.red, _GLFW_FB_RED);
+        colorDiff = _mm256_add_epi32(colorDiff, _GLFW_DIFF(m.useGreen, m.green, _GLFW_FB_GREEN));
+        colorDiff = _mm256_add_epi32(colorDiff, _GLFW_DIFF(m.useBlue, m.blue, _GLFW_FB_BLUE));
+
+        __m256i extraDiff = _GLFW_DIFF(m.useAlpha, m.alpha, _GLFW_FB_ALPHA);
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useDepth, m.depth, _GLFW_FB_DEPTH));
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useStencil, m.stencil, _GLFW_FB_STENCIL));
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useAccumRed, m.accumRed, _GLFW_FB_ACCUM_RED));
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useAccumGreen, m.accumGreen, _GLFW_FB_ACCUM_GREEN));
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useAccumBlue, m.accumBlue, _GLFW_FB_ACCUM_BLUE));
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useAccumAlpha, m.accumAlpha, _GLFW_FB_ACCUM_ALPHA));
+        extraDiff = _mm256_add_epi32(extraDiff, _GLFW_DIFF(m.useSamples, m.samples, _GLFW_FB_SAMPLES));
+        extraDiff = _mm256_add_epi32(extraDiff, countMissingAVX2(_GLFW_SET(m.needSRGB),
+                                                                 _GLFW_LOAD(_GLFW_FB_SRGB)));
+
+        const __m256i excluded =
+            _mm256_and_si256(_GLFW_SET(m.needStereo),
+                             _mm256_cmpeq_epi32(_GLFW_LOAD(_GLFW_FB_STEREO),
+                                                _mm256_setzero_si256()));
+
+        missing = _mm256_or_si256(missing, excluded);
+        colorDiff = _mm256_or_si256(colorDiff, excluded);
+        extraDiff = _mm256_or_si256(extraDiff, excluded);
+
+        const __m256i better =
+            _mm256_or_si256(lessAVX2(missing, bestMissing),
+                            _mm256_and_si256(_mm256_cmpeq_epi32(missing, bestMissing),
+                                             _mm256_or_si256(lessAVX2(colorDiff, bestColorDiff),
+                                                             _mm256_and_si256(_mm256_cmpeq_epi32(colorDiff, bestColorDiff),
+                                                                              lessAVX2(extraDiff, bestExtraDiff)))));
+
+        bestMissing = _mm256_blendv_epi8(bestMissing, missing, better);
+        bestColorDiff = _mm256_blendv_epi8(bestColorDiff, colorDiff, better);
+        bestExtraDiff = _mm256_blendv_epi8(bestExtraDiff, extraDiff, better);
+        bestIndex = _mm256_blendv_epi8(bestIndex, index, better);
+        index = _mm256_add_epi32(index, _mm256_set1_epi32(8));
+    }
+
+#undef _GLFW_DIFF
+#undef _GLFW_SET
+#undef _GLFW_LOAD
+
+    uint32_t lanes[4][8];
+    _mm256_storeu_si256((__m256i*) lanes[0], bestMissing);
+    _mm256_storeu_si256((__m256i*) lanes[1], bestColorDiff);
+    _mm256_storeu_si256((__m256i*) lanes[2], bestExtraDiff);
+    _mm256_storeu_si256((__m256i*) lanes[3], bestIndex);
+    mergeLaneScores(lanes[0], lanes[1], lanes[2], lanes[3], 8, best);
+
+    scoreScalar(configs, desired, i, count, best);
+}
+
+// Chooses a config one block at a time
+//
+_GLFW_AVX2_FUNCTION
+static const _GLFWfbconfig* chooseAVX2(const _GLFWfbconfig* desired,
+                                       const _GLFWfbconfig* alternatives,
+                                       unsigned int count)
+{
+    _GLFWfbblock block;
+    _GLFWfbmasks masks;
+    _GLFWfbscore best = { UINT32_MAX, UINT32_MAX, UINT32_MAX, 0 };
+    const _GLFWfbconfig* closest = NULL;
+
+    prepareMasks(&masks, desired);
+
+    for (unsigned int base = 0;  base < count;  base += _GLFW_FB_BLOCK_SIZE)
+    {
+        _GLFWfbscore candidate = { UINT32_MAX, UINT32_MAX, UINT32_MAX, 0 };
+        unsigned int size = count - base;
+        if (size > _GLFW_FB_BLOCK_SIZE)
+            size = _GLFW_FB_BLOCK_SIZE;
+
+        loadBlock(&block, alternatives + base, size);
+        scoreAVX2(&block, alternatives + base, desired, &masks, 0, size, &candidate);
+
+        candidate.index += base;
+
+        if (isBetterScore(&candidate, &best))
+        {
+            best = candidate;
+            closest = alternatives + best.index;
+        }
+    }
+
+    return closest;
+}
+
+#endif // _GLFW_SIMD_AVX2
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// The kernels in order of preference, with AVX2 last so that it can be left out
+// if the processor does not support it
+//
+static const _GLFWfbconfigchooser choosers[] =
+{
+    { "scalar", chooseScalar },
+#if defined(_GLFW_SIMD_AVX2)
+    { "AVX2", chooseAVX2 },
+#endif
+};
+
+// Returns the framebuffer config choosers supported by the processor, from the
+// scalar fallback to the fastest one
+//
+int _glfwGetFBConfigChoosers(const _GLFWfbconfigchooser** result)
+{
+    *result = choosers;
+    return _GLFW_SUPPORTED_KERNEL_COUNT(choosers);
+}
+
+// Chooses the framebuffer config that best matches the desired one
+//
+const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
+                                         const _GLFWfbconfig* alternatives,
+                                         unsigned int count)
+{
+    static const _GLFWfbconfigchooser* chooser = NULL;
+
+    if (!chooser)
+    {
+        const _GLFWfbconfigchooser* supported;
+        const int supportedCount = _glfwGetFBConfigChoosers(&supported);
+        chooser = supported + supportedCount - 1;
+    }
+
+    return chooser->choose(desired, alternatives, count);
+}
+
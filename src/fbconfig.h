@@ -0,0 +1,82 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#pragma once
+
+#include <stdint.h>
+
+// The framebuffer config module does not depend on the rest of GLFW, so that it
+// can be built into the framebuffer config test
+
+// Framebuffer configuration
+//
+// This describes buffers and their sizes.  It also contains
+// a platform-specific ID used to map back to the backend API object.
+//
+// It is used to pass framebuffer parameters from shared code to the platform
+// API and also to enumerate and select available framebuffer configs.
+//
+// The boolean members are ints, as GLFWbool is defined by internal.h.
+//
+typedef struct _GLFWfbconfig
+{
+    int         redBits;
+    int         greenBits;
+    int         blueBits;
+    int         alphaBits;
+    int         depthBits;
+    int         stencilBits;
+    int         accumRedBits;
+    int         accumGreenBits;
+    int         accumBlueBits;
+    int         accumAlphaBits;
+    int         auxBuffers;
+    int         stereo;
+    int         samples;
+    int         sRGB;
+    int         doublebuffer;
+    int         transparent;
+    uintptr_t   handle;
+} _GLFWfbconfig;
+
+// A framebuffer config chooser for one instruction set
+// All choosers make the same choice, only at different speeds
+//
+typedef struct _GLFWfbconfigchooser
+{
+    const char*     name;
+    const _GLFWfbconfig* (*choose)(const _GLFWfbconfig*,
+                                   const _GLFWfbconfig*,
+                                   unsigned int);
+} _GLFWfbconfigchooser;
+
+int _glfwGetFBConfigChoosers(const _GLFWfbconfigchooser** choosers);
+
+const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
+                                         const _GLFWfbconfig* alternatives,
+                                         unsigned int count);
+
@@ -47,15 +47,14 @@ static int getGLXFBConfigAttrib(GLXFBConfig fbconfig, int attrib)
     return value;
 }
 
-// Return the GLXFBConfig most closely matching the specified hints
+// Translates the usable GLXFBConfigs of the screen, which do not change for
+// the lifetime of the display connection
 //
-static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
-                                  GLXFBConfig* result)
+static _GLFWfbconfigcache* loadGLXFBConfigs(void)
 {
     GLXFBConfig* nativeConfigs;
-    _GLFWfbconfig* usableConfigs;
-    const _GLFWfbconfig* closest;
-    int nativeCount, usableCount;
+    _GLFWfbconfigcache* cache;
+    int nativeCount;
     const char* vendor;
     GLFWbool trustWindowBit = GLFW_TRUE;
 
@@ -70,16 +69,20 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
     if (!nativeConfigs || !nativeCount)
     {
         _glfwInputError(GLFW_API_UNAVAILABLE, "GLX: No GLXFBConfigs returned");
-        return GLFW_FALSE;
+        return NULL;
     }
 
-    usableConfigs = _glfw_calloc(nativeCount, sizeof(_GLFWfbconfig));
-    usableCount = 0;
+    cache = _glfwAllocFBConfigCache(nativeCount);
+    if (!cache)
+    {
+        XFree(nativeConfigs);
+        return NULL;
+    }
 
     for (int i = 0;  i < nativeCount;  i++)
     {
         const GLXFBConfig n = nativeConfigs[i];
-        _GLFWfbconfig* u = usableConfigs + usableCount;
+        _GLFWfbconfig* u = cache->configs + cache->count;
 
         // Only consider RGBA GLXFBConfigs
         if (!(getGLXFBConfigAttrib(n, GLX_RENDER_TYPE) & GLX_RGBA_BIT))
@@ -92,17 +95,14 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
                 continue;
         }
 
-        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER) != desired->doublebuffer)
-            continue;
+        if (getGLXFBConfigAttrib(n, GLX_DOUBLEBUFFER))
+            u->doublebuffer = GLFW_TRUE;
 
-        if (desired->transparent)
+        XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
+        if (vi)
         {
-            XVisualInfo* vi = glXGetVisualFromFBConfig(_glfw.x11.display, n);
-            if (vi)
-            {
-                u->transparent = _glfwIsVisualTransparentX11(vi->visual);
-                XFree(vi);
-            }
+            u->transparent = _glfwIsVisualTransparentX11(vi->visual);
+            XFree(vi);
         }
 
         u->redBits = getGLXFBConfigAttrib(n, GLX_RED_SIZE);
@@ -130,14 +130,63 @@ static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
             u->sRGB = getGLXFBConfigAttrib(n, GLX_FRAMEBUFFER_SRGB_CAPABLE_ARB);
 
         u->handle = (uintptr_t) n;
+        cache->count++;
+    }
+
+    XFree(nativeConfigs);
+    return cache;
+}
+
+// Return the GLXFBConfig most closely matching the specified hints
+//
+static GLFWbool chooseGLXFBConfig(const _GLFWfbconfig* desired,
+                                  GLXFBConfig* result)
+{
+    _GLFWfbconfig* usableConfigs;
+    const _GLFWfbconfig* closest;
+    int usableCount;
+    uintptr_t handle;
+
+    if (!_glfw.glx.fbconfigs)
+    {
+        _glfw.glx.fbconfigs = loadGLXFBConfigs();
+        if (!_glfw.glx.fbconfigs)
+            return GLFW_FALSE;
+    }
+
+    if (_glfwFindFBConfigChoice(_glfw.glx.fbconfigs, desired, 0, &handle))
+    {
+        *result = (GLXFBConfig) handle;
+        return GLFW_TRUE;
+    }
+
+    usableConfigs = _glfw_calloc(_glfw.glx.fbconfigs->count, sizeof(_GLFWfbconfig));
+    usableCount = 0;
+
+    for (int i = 0;  i < _glfw.glx.fbconfigs->count;  i++)
+    {
+        const _GLFWfbconfig* c = _glfw.glx.fbconfigs->configs + i;
+        _GLFWfbconfig* u = usableConfigs + usableCount;
+
+        if (c->doublebuffer != desired->doublebuffer)
+            continue;
+
+        *u = *c;
+
+        // Transparency is only a criterion if it was requested
+        if (!desired->transparent)
+            u->transparent = GLFW_FALSE;
+
         usableCount++;
     }
 
     closest = _glfwChooseFBConfig(desired, usableConfigs, usableCount);
     if (closest)
+    {
         *result = (GLXFBConfig) closest->handle;
+        _glfwAddFBConfigChoice(_glfw.glx.fbconfigs, desired, 0, closest->handle);
+    }
 
-    XFree(nativeConfigs);
     _glfw_free(usableConfigs);
 
     return closest != NULL;
@@ -207,10 +256,14 @@ static void swapIntervalGLX(int interval)
     }
 }
 
+static const char* getExtensionStringGLX(void)
+{
+    return glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
+}
+
 static int extensionSupportedGLX(const char* extension)
 {
-    const char* extensions =
-        glXQueryExtensionsString(_glfw.x11.display, _glfw.x11.screen);
+    const char* extensions = getExtensionStringGLX();
     if (extensions)
     {
         if (_glfwStringInExtensionString(extension, extensions))
@@ -433,6 +486,9 @@ void _glfwTerminateGLX(void)
     // NOTE: This function must not call any X11 functions, as it is called
     //       after XCloseDisplay (see _glfwTerminateX11 for details)
 
+    _glfwFreeFBConfigCache(_glfw.glx.fbconfigs);
+    _glfw.glx.fbconfigs = NULL;
+
     if (_glfw.glx.handle)
     {
         _glfwPlatformFreeModule(_glfw.glx.handle);
@@ -629,7 +685,7 @@ GLFWbool _glfwCreateContextGLX(_GLFWwindow* window,
     window->context.makeCurrent = makeContextCurrentGLX;
     window->context.swapBuffers = swapBuffersGLX;
     window->context.swapInterval = swapIntervalGLX;
-    window->context.extensionSupported = extensionSupportedGLX;
+    window->context.getExtensionString = getExtensionStringGLX;
     window->context.getProcAddress = getProcAddressGLX;
     window->context.destroy = destroyContextGLX;
 
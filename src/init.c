@@ -32,6 +32,11 @@
 #include <stdio.h>
 #include <stdarg.h>
 #include <assert.h>
+#include <ctype.h>
+
+#if defined(_GLFW_X11) || defined(_GLFW_WAYLAND)
+#include <unistd.h>
+#endif
 
 
 // NOTE: The global variables below comprise all mutable global data in GLFW
@@ -52,6 +57,8 @@ static _GLFWinitconfig _glfwInitHints =
     .hatButtons = GLFW_TRUE,
     .angleType = GLFW_ANGLE_PLATFORM_TYPE_NONE,
     .platformID = GLFW_ANY_PLATFORM,
+    .cursorCacheLimit = 0,
+    .preloadCursors = GLFW_FALSE,
     .vulkanLoader = NULL,
     .ns =
     {
@@ -97,11 +104,18 @@ static void terminate(void)
 
     memset(&_glfw.callbacks, 0, sizeof(_glfw.callbacks));
 
+    if (_glfw.recording.file)
+        glfwStopInputRecording();
+
+    _glfwTerminateWindowPools();
+
     while (_glfw.windowListHead)
         glfwDestroyWindow((GLFWwindow*) _glfw.windowListHead);
 
     while (_glfw.cursorListHead)
-        glfwDestroyCursor((GLFWcursor*) _glfw.cursorListHead);
+        _glfwDestroyCursor(_glfw.cursorListHead);
+
+    _glfwTerminateGammaTransitions();
 
     for (i = 0;  i < _glfw.monitorCount;  i++)
     {
@@ -115,14 +129,29 @@ static void terminate(void)
     _glfw.monitors = NULL;
     _glfw.monitorCount = 0;
 
+    _glfw_free(_glfw.gamma.log2);
+    _glfw_free(_glfw.gamma.values);
+    memset(&_glfw.gamma, 0, sizeof(_glfw.gamma));
+
     _glfw_free(_glfw.mappings);
     _glfw.mappings = NULL;
     _glfw.mappingCount = 0;
+    _glfw.mappingCapacity = 0;
+
+    _glfw_free(_glfw.mappingSlots);
+    _glfw.mappingSlots = NULL;
+    _glfw.mappingSlotCount = 0;
+
+    _glfw_free(_glfw.batch.events);
+    memset(&_glfw.batch, 0, sizeof(_glfw.batch));
 
     _glfwTerminateVulkan();
     _glfw.platform.terminateJoysticks();
     _glfw.platform.terminate();
 
+    // The clipboard data may be served to a clipboard manager on termination
+    _glfwFreeClipboardData();
+
     _glfw.initialized = GLFW_FALSE;
 
     while (_glfw.errorListHead)
@@ -175,56 +204,177 @@ size_t _glfwEncodeUTF8(char* s, uint32_t codepoint)
     return count;
 }
 
-// Splits and translates a text/uri-list into separate file paths
-// NOTE: This function destroys the provided string
+// Returns whether the host of a file URI refers to the local machine
 //
-char** _glfwParseUriList(char* text, int* count)
+static GLFWbool isLocalUriHost(const char* host, size_t length, const char* hostname)
 {
-    const char* prefix = "file://";
-    char** paths = NULL;
-    char* line;
+    const char* names[] = { "localhost", hostname };
 
-    *count = 0;
+    // An empty host is the most common form of a local file URI
+    if (length == 0)
+        return GLFW_TRUE;
 
-    while ((line = strtok(text, "\r\n")))
+    for (size_t i = 0;  i < sizeof(names) / sizeof(names[0]);  i++)
     {
-        char* path;
+        size_t j;
+
+        if (strlen(names[i]) != length)
+            continue;
+
+        for (j = 0;  j < length;  j++)
+        {
+            if (tolower((unsigned char) host[j]) != tolower((unsigned char) names[i][j]))
+                break;
+        }
 
-        text = NULL;
+        if (j == length)
+            return GLFW_TRUE;
+    }
 
-        if (line[0] == '#')
+    return GLFW_FALSE;
+}
+
+// Finds the next path in a text/uri-list, skipping empty lines, comments and
+// files on other hosts, and returns the text after it or NULL if there is none
+//
+static const char* findUriPath(const char* text, const char* hostname,
+                               const char** path, size_t* length)
+{
+    const char* prefix = "file://";
+    const size_t prefixLength = strlen(prefix);
+
+    while (*text)
+    {
+        const char* line = text;
+        const size_t lineLength = strcspn(line, "\r\n");
+
+        text = line + lineLength;
+        text += strspn(text, "\r\n");
+
+        if (lineLength == 0 || line[0] == '#')
             continue;
 
-        if (strncmp(line, prefix, strlen(prefix)) == 0)
+        if (lineLength >= prefixLength && strncmp(line, prefix, prefixLength) == 0)
         {
-            line += strlen(prefix);
-            // TODO: Validate hostname
-            while (*line != '/')
-                line++;
+            const char* host = line + prefixLength;
+            const char* slash = memchr(host, '/', lineLength - prefixLength);
+
+            if (!slash || !isLocalUriHost(host, slash - host, hostname))
+                continue;
+
+            *path = slash;
+            *length = line + lineLength - slash;
+        }
+        else
+        {
+            *path = line;
+            *length = lineLength;
         }
 
-        (*count)++;
+        return text;
+    }
+
+    return NULL;
+}
 
-        path = _glfw_calloc(strlen(line) + 1, 1);
-        paths = _glfw_realloc(paths, *count * sizeof(char*));
-        paths[*count - 1] = path;
+// Returns the value of a hexadecimal digit
+//
+static int hexDigitValue(char digit)
+{
+    if (digit >= '0' && digit <= '9')
+        return digit - '0';
+    else if (digit >= 'a' && digit <= 'f')
+        return digit - 'a' + 10;
+    else if (digit >= 'A' && digit <= 'F')
+        return digit - 'A' + 10;
+    else
+        return -1;
+}
 
-        while (*line)
+// Copies a URI path and decodes its percent-encoded octets, returning the end
+// of the null-terminated result
+//
+static char* decodeUriPath(char* target, const char* source, size_t length)
+{
+    for (size_t i = 0;  i < length;  i++)
+    {
+        if (source[i] == '%' && i + 2 < length)
         {
-            if (line[0] == '%' && line[1] && line[2])
+            const int high = hexDigitValue(source[i + 1]);
+            const int low = hexDigitValue(source[i + 2]);
+
+            if (high >= 0 && low >= 0)
             {
-                const char digits[3] = { line[1], line[2], '\0' };
-                *path = (char) strtol(digits, NULL, 16);
-                line += 2;
+                *target++ = (char) ((high << 4) | low);
+                i += 2;
+                continue;
             }
-            else
-                *path = *line;
-
-            path++;
-            line++;
         }
+
+        *target++ = source[i];
+    }
+
+    *target++ = '\0';
+    return target;
+}
+
+// Splits and translates up to the specified number of paths of a text/uri-list,
+// advancing the text past them and setting it to the end of the string when
+// no paths remain
+// The path array and the paths are allocated as a single block
+//
+char** _glfwParseUriList(const char** text, int maxCount, int* count)
+{
+    char hostname[256] = "";
+    const char* path;
+    const char* next;
+    const char* remaining = *text;
+    size_t length, size = 0;
+
+#if defined(_GLFW_X11) || defined(_GLFW_WAYLAND)
+    if (gethostname(hostname, sizeof(hostname) - 1) != 0)
+        hostname[0] = '\0';
+#endif
+
+    *count = 0;
+
+    while (*count < maxCount &&
+           (next = findUriPath(remaining, hostname, &path, &length)))
+    {
+        remaining = next;
+        size += length + 1;
+        (*count)++;
     }
 
+    // Check whether any paths remain so that the caller can tell the last
+    // chunk of paths apart from the others
+    if (!findUriPath(remaining, hostname, &path, &length))
+        remaining += strlen(remaining);
+
+    if (*count == 0)
+    {
+        *text = remaining;
+        return NULL;
+    }
+
+    char** paths = _glfw_calloc(*count * sizeof(char*) + size, 1);
+    if (!paths)
+    {
+        *count = 0;
+        return NULL;
+    }
+
+    char* target = (char*) (paths + *count);
+    next = *text;
+
+    for (int i = 0;  i < *count;  i++)
+    {
+        next = findUriPath(next, hostname, &path, &length);
+        paths[i] = target;
+        target = decodeUriPath(target, path, length);
+    }
+
+    *text = remaining;
     return paths;
 }
 
@@ -232,7 +382,8 @@ char* _glfw_strdup(const char* source)
 {
     const size_t length = strlen(source);
     char* result = _glfw_calloc(length + 1, 1);
-    strcpy(result, source);
+    if (result)
+        strcpy(result, source);
     return result;
 }
 
@@ -418,8 +569,6 @@ GLFWAPI int glfwInit(void)
 
     _glfwPlatformSetTls(&_glfw.errorSlot, &_glfwMainThreadError);
 
-    _glfwInitGamepadMappings();
-
     _glfwPlatformInitTimer();
     _glfw.timer.offset = _glfwPlatformGetTimerValue();
 
@@ -451,6 +600,21 @@ GLFWAPI void glfwInitHint(int hint, int value)
         case GLFW_PLATFORM:
             _glfwInitHints.platformID = value;
             return;
+        case GLFW_CURSOR_CACHE_LIMIT:
+        {
+            if (value < 0)
+            {
+                _glfwInputError(GLFW_INVALID_VALUE,
+                                "Invalid cursor cache limit %i", value);
+                return;
+            }
+
+            _glfwInitHints.cursorCacheLimit = value;
+            return;
+        }
+        case GLFW_PRELOAD_STANDARD_CURSORS:
+            _glfwInitHints.preloadCursors = value;
+            return;
         case GLFW_COCOA_CHDIR_RESOURCES:
             _glfwInitHints.ns.chdir = value;
             return;
@@ -29,7 +29,10 @@
 #include "mappings.h"
 
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
 #include <float.h>
+#include <limits.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -42,12 +45,18 @@
 #define _GLFW_JOYSTICK_BUTTON   2
 #define _GLFW_JOYSTICK_HATBIT   3
 
-#define GLFW_MOD_MASK (GLFW_MOD_SHIFT | \
-                       GLFW_MOD_CONTROL | \
-                       GLFW_MOD_ALT | \
-                       GLFW_MOD_SUPER | \
-                       GLFW_MOD_CAPS_LOCK | \
-                       GLFW_MOD_NUM_LOCK)
+// Results of parsing a gamepad mapping
+#define _GLFW_MAPPING_VALID     0
+#define _GLFW_MAPPING_IGNORED   1
+#define _GLFW_MAPPING_INVALID   2
+#define _GLFW_MAPPING_DUPLICATE 3
+
+// Input recording format
+#define _GLFW_RECORD_MAGIC      "GLFWREC"
+#define _GLFW_RECORD_VERSION    1
+#define _GLFW_RECORD_HEADER     8
+#define _GLFW_RECORD_BUFFER     65536
+#define _GLFW_RECORD_MAX_EVENT  64
 
 // Initializes the platform joystick API if it has not been already
 //
@@ -65,21 +74,201 @@ static GLFWbool initJoysticks(void)
     return _glfw.joysticksInitialized = GLFW_TRUE;
 }
 
-// Finds a mapping based on joystick GUID
+// Converts a hexadecimal joystick GUID string to its binary form
+//
+static GLFWbool parseGUID(uint8_t key[16], const char* guid)
+{
+    int i;
+
+    for (i = 0;  i < 32;  i++)
+    {
+        const char c = guid[i];
+        uint8_t nibble;
+
+        if (c >= '0' && c <= '9')
+            nibble = (uint8_t) (c - '0');
+        else if (c >= 'a' && c <= 'f')
+            nibble = (uint8_t) (c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+            nibble = (uint8_t) (c - 'A' + 10);
+        else
+            return GLFW_FALSE;
+
+        if (i & 1)
+            key[i / 2] |= nibble;
+        else
+            key[i / 2] = (uint8_t) (nibble << 4);
+    }
+
+    return guid[32] == '\0';
+}
+
+// Returns the hash table slot index to start probing at for a binary GUID
+//
+static int hashGUID(const uint8_t key[16])
+{
+    uint64_t a, b;
+    memcpy(&a, key, sizeof(a));
+    memcpy(&b, key + 8, sizeof(b));
+
+    // Most of a GUID is vendor and product IDs surrounded by zeroes, so mix
+    // all of it into the bits used for the slot index
+    uint64_t hash = a * 0x9e3779b97f4a7c15ull ^ b * 0xc2b2ae3d27d4eb4full;
+    hash ^= hash >> 29;
+    hash *= 0xbf58476d1ce4e5b9ull;
+    hash ^= hash >> 32;
+
+    return (int) (hash & (uint64_t) (_glfw.mappingSlotCount - 1));
+}
+
+// Returns the hash table slot of the specified binary GUID, either the one
+// holding its mapping or the empty one where it would be inserted
+//
+static _GLFWmapslot* findMappingSlot(const uint8_t key[16])
+{
+    int i = hashGUID(key);
+
+    for (;;)
+    {
+        _GLFWmapslot* slot = _glfw.mappingSlots + i;
+        if (!slot->index || memcmp(slot->guid, key, 16) == 0)
+            return slot;
+
+        i = (i + 1) & (_glfw.mappingSlotCount - 1);
+    }
+}
+
+// Resizes the mapping hash table and reinserts all mappings
 //
-static _GLFWmapping* findMapping(const char* guid)
+static GLFWbool resizeMappingSlots(int count)
 {
     int i;
+    _GLFWmapslot* slots = _glfw_calloc(count, sizeof(_GLFWmapslot));
+    if (!slots)
+        return GLFW_FALSE;
+
+    _glfw_free(_glfw.mappingSlots);
+    _glfw.mappingSlots = slots;
+    _glfw.mappingSlotCount = count;
 
     for (i = 0;  i < _glfw.mappingCount;  i++)
     {
-        if (strcmp(_glfw.mappings[i].guid, guid) == 0)
-            return _glfw.mappings + i;
+        uint8_t key[16];
+        parseGUID(key, _glfw.mappings[i].guid);
+
+        _GLFWmapslot* slot = findMappingSlot(key);
+        memcpy(slot->guid, key, sizeof(key));
+        slot->index = i + 1;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Finds a built-in mapping with a binary search of the sorted default table
+//
+static const _GLFWmapping* findDefaultMapping(const char* guid)
+{
+    // The default table is empty unless a joystick backend is built
+#if defined(_GLFW_WIN32) || defined(_GLFW_COCOA) || defined(GLFW_BUILD_LINUX_JOYSTICK)
+    size_t first = 0;
+    size_t last = sizeof(_glfwDefaultMappings) / sizeof(_GLFWmapping);
+
+    while (first < last)
+    {
+        const size_t middle = first + (last - first) / 2;
+        const int result = strcmp(_glfwDefaultMappings[middle].guid, guid);
+        if (result == 0)
+            return _glfwDefaultMappings + middle;
+        else if (result < 0)
+            first = middle + 1;
+        else
+            last = middle;
     }
+#endif
 
     return NULL;
 }
 
+// Finds a mapping based on joystick GUID
+// Mappings added at run-time take precedence over the built-in ones
+//
+static const _GLFWmapping* findMapping(const char* guid)
+{
+    uint8_t key[16];
+
+    if (_glfw.mappingCount && parseGUID(key, guid))
+    {
+        const _GLFWmapslot* slot = findMappingSlot(key);
+        if (slot->index)
+            return _glfw.mappings + slot->index - 1;
+    }
+
+    return findDefaultMapping(guid);
+}
+
+// Makes room for the specified number of additional mappings
+//
+static GLFWbool reserveMappings(int count)
+{
+    const int required = _glfw.mappingCount + count;
+
+    if (required > _glfw.mappingCapacity)
+    {
+        const int capacity = _glfw_max(required, _glfw.mappingCapacity * 2);
+        _GLFWmapping* mappings =
+            _glfw_realloc(_glfw.mappings, sizeof(_GLFWmapping) * capacity);
+        if (!mappings)
+            return GLFW_FALSE;
+
+        _glfw.mappings = mappings;
+        _glfw.mappingCapacity = capacity;
+    }
+
+    // Keep the table at most half full so that probe sequences stay short
+    if (required * 2 > _glfw.mappingSlotCount)
+    {
+        int slotCount = _glfw_max(_glfw.mappingSlotCount, 256);
+        while (required * 2 > slotCount)
+            slotCount *= 2;
+
+        if (!resizeMappingSlots(slotCount))
+            return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Adds a mapping or, if one with the same GUID already exists, replaces it
+// Returns GLFW_FALSE without replacing if the existing mapping was added with
+// the same non-zero serial number
+// There must be room for one more mapping, see reserveMappings
+//
+static GLFWbool addMapping(const _GLFWmapping* mapping, unsigned int serial)
+{
+    uint8_t key[16];
+
+    if (!parseGUID(key, mapping->guid))
+        return GLFW_TRUE;
+
+    _GLFWmapslot* slot = findMappingSlot(key);
+    if (slot->index)
+    {
+        if (serial && slot->serial == serial)
+            return GLFW_FALSE;
+
+        _glfw.mappings[slot->index - 1] = *mapping;
+        slot->serial = serial;
+        return GLFW_TRUE;
+    }
+
+    _glfw.mappings[_glfw.mappingCount++] = *mapping;
+
+    memcpy(slot->guid, key, sizeof(key));
+    slot->index = _glfw.mappingCount;
+    slot->serial = serial;
+    return GLFW_TRUE;
+}
+
 // Checks whether a gamepad mapping element is present in the hardware
 //
 static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
@@ -97,9 +286,9 @@ static GLFWbool isValidElementForJoystick(const _GLFWmapelement* e,
 
 // Finds a mapping based on joystick GUID and verifies element indices
 //
-static _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
+static const _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
 {
-    _GLFWmapping* mapping = findMapping(js->guid);
+    const _GLFWmapping* mapping = findMapping(js->guid);
     if (mapping)
     {
         int i;
@@ -120,11 +309,44 @@ static _GLFWmapping* findValidMapping(const _GLFWjoystick* js)
     return mapping;
 }
 
-// Parses an SDL_GameControllerDB line and adds it to the mapping list
+// Parses an unsigned decimal number like strtoul without reading past the end
+// of the line
+//
+static unsigned long parseNumber(const char** c, const char* end)
+{
+    const char* p = *c;
+    unsigned long value = 0;
+    GLFWbool negative = GLFW_FALSE;
+
+    while (p < end && isspace((unsigned char) *p))
+        p++;
+
+    if (p < end && (*p == '+' || *p == '-'))
+    {
+        negative = (*p == '-');
+        p++;
+    }
+
+    if (p == end || *p < '0' || *p > '9')
+        return 0;
+
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+        value = value * 10 + (unsigned long) (*p - '0');
+        p++;
+    }
+
+    *c = p;
+    return negative ? 0 - value : value;
+}
+
+// Parses an SDL_GameControllerDB line of the specified length
+// The line does not need to be null-terminated and is never copied
 //
-static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
+static int parseMapping(_GLFWmapping* mapping, const char* string, size_t size)
 {
     const char* c = string;
+    const char* const end = string + size;
     size_t i, length;
     struct
     {
@@ -156,36 +378,48 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
         { "righty",        mapping->axes + GLFW_GAMEPAD_AXIS_RIGHT_Y }
     };
 
-    length = strcspn(c, ",");
-    if (length != 32 || c[length] != ',')
+    for (length = 0;  c + length < end && c[length] != ',';  length++)
+        ;
+
+    if (length != 32 || c + length == end)
+        return _GLFW_MAPPING_INVALID;
+
+    for (i = 0;  i < length;  i++)
     {
-        _glfwInputError(GLFW_INVALID_VALUE, NULL);
-        return GLFW_FALSE;
+        if (!isxdigit((unsigned char) c[i]))
+            return _GLFW_MAPPING_INVALID;
     }
 
     memcpy(mapping->guid, c, length);
     c += length + 1;
 
-    length = strcspn(c, ",");
-    if (length >= sizeof(mapping->name) || c[length] != ',')
-    {
-        _glfwInputError(GLFW_INVALID_VALUE, NULL);
-        return GLFW_FALSE;
-    }
+    for (length = 0;  c + length < end && c[length] != ',';  length++)
+        ;
+
+    if (length >= sizeof(mapping->name) || c + length == end)
+        return _GLFW_MAPPING_INVALID;
 
     memcpy(mapping->name, c, length);
     c += length + 1;
 
-    while (*c)
+    while (c < end)
     {
         // TODO: Implement output modifiers
         if (*c == '+' || *c == '-')
-            return GLFW_FALSE;
+            return _GLFW_MAPPING_IGNORED;
+
+        for (length = 0;  c + length < end;  length++)
+        {
+            if (c[length] == ':' || c[length] == ',')
+                break;
+        }
+
+        if (c + length == end || c[length] != ':')
+            length = 0;
 
-        for (i = 0;  i < sizeof(fields) / sizeof(fields[0]);  i++)
+        for (i = 0;  length && i < sizeof(fields) / sizeof(fields[0]);  i++)
         {
-            length = strlen(fields[i].name);
-            if (strncmp(c, fields[i].name, length) != 0 || c[length] != ':')
+            if (strncmp(c, fields[i].name, length) != 0 || fields[i].name[length] != '\0')
                 continue;
 
             c += length + 1;
@@ -196,17 +430,20 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
                 int8_t minimum = -1;
                 int8_t maximum = 1;
 
-                if (*c == '+')
+                if (c < end && *c == '+')
                 {
                     minimum = 0;
                     c += 1;
                 }
-                else if (*c == '-')
+                else if (c < end && *c == '-')
                 {
                     maximum = 0;
                     c += 1;
                 }
 
+                if (c == end)
+                    break;
+
                 if (*c == 'a')
                     e->type = _GLFW_JOYSTICK_AXIS;
                 else if (*c == 'b')
@@ -216,21 +453,25 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
                 else
                     break;
 
+                c += 1;
+
                 if (e->type == _GLFW_JOYSTICK_HATBIT)
                 {
-                    const unsigned long hat = strtoul(c + 1, (char**) &c, 10);
-                    const unsigned long bit = strtoul(c + 1, (char**) &c, 10);
+                    const unsigned long hat = parseNumber(&c, end);
+                    if (c < end)
+                        c += 1;
+                    const unsigned long bit = parseNumber(&c, end);
                     e->index = (uint8_t) ((hat << 4) | bit);
                 }
                 else
-                    e->index = (uint8_t) strtoul(c + 1, (char**) &c, 10);
+                    e->index = (uint8_t) parseNumber(&c, end);
 
                 if (e->type == _GLFW_JOYSTICK_AXIS)
                 {
                     e->axisScale = 2 / (maximum - minimum);
                     e->axisOffset = -(maximum + minimum);
 
-                    if (*c == '~')
+                    if (c < end && *c == '~')
                     {
                         e->axisScale = -e->axisScale;
                         e->axisOffset = -e->axisOffset;
@@ -241,25 +482,614 @@ static GLFWbool parseMapping(_GLFWmapping* mapping, const char* string)
             {
                 const char* name = _glfw.platform.getMappingName();
                 length = strlen(name);
-                if (strncmp(c, name, length) != 0)
-                    return GLFW_FALSE;
+                if ((size_t) (end - c) < length || strncmp(c, name, length) != 0)
+                    return _GLFW_MAPPING_IGNORED;
             }
 
             break;
         }
 
-        c += strcspn(c, ",");
-        c += strspn(c, ",");
-    }
+        while (c < end && *c != ',')
+            c++;
+        while (c < end && *c == ',')
+            c++;
+    }
+
+    for (i = 0;  i < 32;  i++)
+    {
+        if (mapping->guid[i] >= 'A' && mapping->guid[i] <= 'F')
+            mapping->guid[i] += 'a' - 'A';
+    }
+
+    _glfw.platform.updateGamepadGUID(mapping->guid);
+    return _GLFW_MAPPING_VALID;
+}
+
+// Adds or updates the mappings in an SDL_GameControllerDB text
+// In bulk mode the mapping storage is sized up front, lines repeating a GUID
+// of an earlier line are rejected and all rejected lines are reported as
+// a single error
+//
+static GLFWbool updateMappings(const char* data, size_t size, GLFWbool bulk)
+{
+    int jid, line = 1, invalidCount = 0;
+    GLFWbool outOfMemory = GLFW_FALSE;
+    unsigned int serial = 0;
+    const char* c = data;
+    const char* const end = data + size;
+    char invalid[512] = "";
+    size_t invalidLength = 0;
+
+    if (bulk)
+    {
+        int lineCount = 1;
+
+        for (const char* n = data;  (n = memchr(n, '\n', end - n));  n++)
+            lineCount++;
+
+        if (!reserveMappings(lineCount))
+            return GLFW_FALSE;
+
+        // Serial zero means the mapping may be replaced without error
+        serial = ++_glfw.mappingSerial;
+        if (!serial)
+            serial = ++_glfw.mappingSerial;
+    }
+
+    while (c < end)
+    {
+        size_t length = 0;
+
+        while (c + length < end && c[length] != '\r' && c[length] != '\n')
+            length++;
+
+        if (length && isxdigit((unsigned char) *c))
+        {
+            _GLFWmapping mapping = {{0}};
+            int result = parseMapping(&mapping, c, length);
+
+            if (result == _GLFW_MAPPING_VALID)
+            {
+                if (!reserveMappings(1))
+                {
+                    outOfMemory = GLFW_TRUE;
+                    break;
+                }
+
+                if (!addMapping(&mapping, serial))
+                    result = _GLFW_MAPPING_DUPLICATE;
+            }
+
+            if (result == _GLFW_MAPPING_INVALID && !bulk)
+                _glfwInputError(GLFW_INVALID_VALUE, NULL);
+            else if (result == _GLFW_MAPPING_INVALID ||
+                     result == _GLFW_MAPPING_DUPLICATE)
+            {
+                // Report the first few lines and how many there were in total
+                if (invalidCount < 16)
+                {
+                    invalidLength += snprintf(invalid + invalidLength,
+                                              sizeof(invalid) - invalidLength,
+                                              "%s%i%s",
+                                              invalidCount ? ", " : "",
+                                              line,
+                                              result == _GLFW_MAPPING_DUPLICATE ?
+                                              " (duplicate)" : "");
+                    if (invalidLength >= sizeof(invalid))
+                        invalidLength = sizeof(invalid) - 1;
+                }
+
+                invalidCount++;
+            }
+        }
+
+        c += length;
+
+        if (c < end && *c == '\r')
+            c++;
+        if (c < end && *c == '\n')
+            c++;
+
+        line++;
+    }
+
+    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    {
+        _GLFWjoystick* js = _glfw.joysticks + jid;
+        if (js->connected)
+            js->mapping = findValidMapping(js);
+    }
+
+    // The allocator has already reported the error
+    if (outOfMemory)
+        return GLFW_FALSE;
+
+    if (invalidCount)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Rejected %i gamepad mapping lines: %s%s",
+                        invalidCount, invalid,
+                        invalidCount > 16 ? ", ..." : "");
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+
+// Returns a hash of the image and hotspot of a custom cursor
+//
+static uint64_t hashCursorImage(const GLFWimage* image, int xhot, int yhot)
+{
+    const uint64_t prime = 1099511628211ull;
+    const size_t count = (size_t) image->width * image->height;
+    const size_t step = count > 64 ? count / 64 : 1;
+    uint64_t hash = 14695981039346656037ull;
+    size_t i;
+
+    hash = (hash ^ (uint32_t) image->width) * prime;
+    hash = (hash ^ (uint32_t) image->height) * prime;
+    hash = (hash ^ (uint32_t) xhot) * prime;
+    hash = (hash ^ (uint32_t) yhot) * prime;
+
+    // Only a fixed sample of pixels is hashed so that the cost of a lookup does
+    // not grow with the image size, as every match is compared in full anyway
+    for (i = 0;  i < count;  i += step)
+    {
+        uint32_t pixel;
+        memcpy(&pixel, image->pixels + i * 4, sizeof(pixel));
+        hash = (hash ^ pixel) * prime;
+    }
+
+    return hash ^ (hash >> 32);
+}
+
+// Returns the cached custom cursor with the specified image and hotspot, if any
+//
+static _GLFWcursor* findCachedCursor(const GLFWimage* image,
+                                     int xhot, int yhot,
+                                     uint64_t hash)
+{
+    _GLFWcursor* cursor = _glfw.cursorBuckets[hash % _GLFW_CURSOR_BUCKET_COUNT];
+
+    for (;  cursor;  cursor = cursor->cache.next)
+    {
+        if (cursor->cache.hash == hash &&
+            cursor->cache.width == image->width &&
+            cursor->cache.height == image->height &&
+            cursor->cache.xhot == xhot &&
+            cursor->cache.yhot == yhot &&
+            memcmp(cursor->cache.pixels, image->pixels,
+                   (size_t) image->width * image->height * 4) == 0)
+        {
+            return cursor;
+        }
+    }
+
+    return NULL;
+}
+
+// Destroys the least recently released unused cached cursors until at most the
+// specified number remain
+//
+static void trimCursorCache(int limit)
+{
+    while (_glfw.unusedCursorCount > limit)
+    {
+        _GLFWcursor* cursor;
+        _GLFWcursor* oldest = NULL;
+
+        for (cursor = _glfw.cursorListHead;  cursor;  cursor = cursor->next)
+        {
+            if (!cursor->cache.pixels || cursor->cache.references)
+                continue;
+
+            if (!oldest || cursor->cache.released < oldest->cache.released)
+                oldest = cursor;
+        }
+
+        _glfwDestroyCursor(oldest);
+    }
+}
+
+// Reports the current virtual cursor position of the window
+//
+static void reportCursorPos(_GLFWwindow* window)
+{
+    const double xpos = window->virtualCursorPosX;
+    const double ypos = window->virtualCursorPosY;
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_CURSOR_POS);
+        if (event)
+        {
+            event->data.cursor.x = xpos;
+            event->data.cursor.y = ypos;
+        }
+    }
+    else if (window->callbacks.cursorPos)
+        window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
+}
+
+// A single decoded input recording event
+//
+typedef struct _GLFWrecordevent
+{
+    int             type;
+    uint64_t        id;
+    uint64_t        time;
+    int64_t         values[4];
+    double          x, y;
+} _GLFWrecordevent;
+
+// Returns the number of integer values stored for the specified event type
+// Events not listed here store two real values instead
+//
+static int getRecordValueCount(int type)
+{
+    switch (type)
+    {
+        case GLFW_EVENT_KEY:
+            return 4;
+        case GLFW_EVENT_CHAR:
+        case GLFW_EVENT_MOUSE_BUTTON:
+            return 3;
+        case GLFW_EVENT_WINDOW_POS:
+        case GLFW_EVENT_WINDOW_SIZE:
+        case GLFW_EVENT_FRAMEBUFFER_SIZE:
+            return 2;
+        case GLFW_EVENT_CURSOR_ENTER:
+        case GLFW_EVENT_WINDOW_FOCUS:
+        case GLFW_EVENT_WINDOW_ICONIFY:
+        case GLFW_EVENT_WINDOW_MAXIMIZE:
+            return 1;
+        case GLFW_EVENT_WINDOW_CLOSE:
+        case GLFW_EVENT_WINDOW_REFRESH:
+            return 0;
+        case GLFW_EVENT_CURSOR_POS:
+        case GLFW_EVENT_SCROLL:
+        case GLFW_EVENT_WINDOW_CONTENT_SCALE:
+            return -1;
+    }
+
+    return -2;
+}
+
+// Writes an unsigned LEB128 varint
+//
+static unsigned char* writeVarint(unsigned char* p, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *p++ = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+
+    *p++ = (unsigned char) value;
+    return p;
+}
+
+// Writes a zigzag encoded signed varint
+//
+static unsigned char* writeSignedVarint(unsigned char* p, int64_t value)
+{
+    return writeVarint(p, ((uint64_t) value << 1) ^ (uint64_t) (value >> 63));
+}
+
+// Writes a real value, as a varint in 1/256 units when that is exact and as
+// the raw IEEE 754 bits otherwise
+//
+static unsigned char* writeReal(unsigned char* p, double value)
+{
+    const double scaled = value * 256.0;
+
+    if (scaled >= -4503599627370496.0 && scaled <= 4503599627370496.0 &&
+        scaled == (double) (int64_t) scaled &&
+        !(value == 0.0 && signbit(value)))
+    {
+        const int64_t fixed = (int64_t) scaled;
+        return writeVarint(p, (((uint64_t) fixed << 1) ^ (uint64_t) (fixed >> 63)) << 1);
+    }
+    else
+    {
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+
+        *p++ = 1;
+        for (int i = 0;  i < 8;  i++)
+            *p++ = (unsigned char) (bits >> (i * 8));
+
+        return p;
+    }
+}
+
+// Reads an unsigned LEB128 varint
+//
+static GLFWbool readVarint(const unsigned char** p,
+                           const unsigned char* end,
+                           uint64_t* value)
+{
+    int shift = 0;
+
+    *value = 0;
+
+    while (*p < end && shift < 64)
+    {
+        const unsigned char byte = *(*p)++;
+        *value |= (uint64_t) (byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return GLFW_TRUE;
+
+        shift += 7;
+    }
+
+    return GLFW_FALSE;
+}
+
+// Reads a zigzag encoded signed varint
+//
+static GLFWbool readSignedVarint(const unsigned char** p,
+                                 const unsigned char* end,
+                                 int64_t* value)
+{
+    uint64_t bits;
+    if (!readVarint(p, end, &bits))
+        return GLFW_FALSE;
+
+    *value = (int64_t) (bits >> 1) ^ -(int64_t) (bits & 1);
+    return GLFW_TRUE;
+}
+
+// Reads a real value written by writeReal
+//
+static GLFWbool readReal(const unsigned char** p,
+                         const unsigned char* end,
+                         double* value)
+{
+    uint64_t bits;
+
+    if (*p < end && **p == 1)
+    {
+        if (end - *p < 9)
+            return GLFW_FALSE;
+
+        bits = 0;
+        for (int i = 0;  i < 8;  i++)
+            bits |= (uint64_t) (*p)[i + 1] << (i * 8);
+
+        memcpy(value, &bits, sizeof(bits));
+        *p += 9;
+        return GLFW_TRUE;
+    }
+
+    if (!readVarint(p, end, &bits))
+        return GLFW_FALSE;
+
+    bits >>= 1;
+    *value = (double) ((int64_t) (bits >> 1) ^ -(int64_t) (bits & 1)) / 256.0;
+    return GLFW_TRUE;
+}
+
+// Reads and validates the next event of an input recording
+//
+static GLFWbool readRecordEvent(const unsigned char** p,
+                                const unsigned char* end,
+                                _GLFWrecordevent* event)
+{
+    uint64_t type, delta;
+
+    if (!readVarint(p, end, &type) || type > 0xff ||
+        !readVarint(p, end, &event->id) ||
+        !readVarint(p, end, &delta))
+    {
+        return GLFW_FALSE;
+    }
+
+    event->type = GLFW_EVENT_KEY - 1 + (int) type;
+    event->time += delta;
+
+    const int count = getRecordValueCount(event->type);
+    if (count == -2)
+        return GLFW_FALSE;
+
+    if (count == -1)
+    {
+        if (!readReal(p, end, &event->x) || !readReal(p, end, &event->y))
+            return GLFW_FALSE;
+
+        if (!(event->x > -FLT_MAX && event->x < FLT_MAX &&
+              event->y > -FLT_MAX && event->y < FLT_MAX))
+        {
+            return GLFW_FALSE;
+        }
+
+        if (event->type == GLFW_EVENT_WINDOW_CONTENT_SCALE)
+            return event->x > 0.0 && event->y > 0.0;
+
+        return GLFW_TRUE;
+    }
+
+    for (int i = 0;  i < count;  i++)
+    {
+        if (!readSignedVarint(p, end, event->values + i))
+            return GLFW_FALSE;
+        if (event->values[i] < INT_MIN || event->values[i] > INT_MAX)
+            return GLFW_FALSE;
+    }
+
+    const int64_t* v = event->values;
+
+    switch (event->type)
+    {
+        case GLFW_EVENT_KEY:
+            return (v[0] == GLFW_KEY_UNKNOWN || (v[0] >= 0 && v[0] <= GLFW_KEY_LAST)) &&
+                   (v[2] == GLFW_PRESS || v[2] == GLFW_RELEASE) &&
+                   v[3] == (v[3] & GLFW_MOD_MASK);
+        case GLFW_EVENT_CHAR:
+            return v[1] == (v[1] & GLFW_MOD_MASK) &&
+                   (v[2] == GLFW_TRUE || v[2] == GLFW_FALSE);
+        case GLFW_EVENT_MOUSE_BUTTON:
+            return v[0] >= 0 &&
+                   (v[1] == GLFW_PRESS || v[1] == GLFW_RELEASE) &&
+                   v[2] == (v[2] & GLFW_MOD_MASK);
+        case GLFW_EVENT_WINDOW_SIZE:
+        case GLFW_EVENT_FRAMEBUFFER_SIZE:
+            return v[0] >= 0 && v[1] >= 0;
+        case GLFW_EVENT_CURSOR_ENTER:
+        case GLFW_EVENT_WINDOW_FOCUS:
+        case GLFW_EVENT_WINDOW_ICONIFY:
+        case GLFW_EVENT_WINDOW_MAXIMIZE:
+            return v[0] == GLFW_TRUE || v[0] == GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+// Passes a decoded recording event to the matching event API function
+//
+static void replayRecordEvent(_GLFWwindow* window, const _GLFWrecordevent* event)
+{
+    const int64_t* v = event->values;
+
+    switch (event->type)
+    {
+        case GLFW_EVENT_KEY:
+            _glfwInputKey(window, (int) v[0], (int) v[1], (int) v[2], (int) v[3]);
+            break;
+        case GLFW_EVENT_CHAR:
+            _glfwInputChar(window, (uint32_t) v[0], (int) v[1], (GLFWbool) v[2]);
+            break;
+        case GLFW_EVENT_MOUSE_BUTTON:
+            _glfwInputMouseClick(window, (int) v[0], (int) v[1], (int) v[2]);
+            break;
+        case GLFW_EVENT_CURSOR_POS:
+            _glfwInputCursorPos(window, event->x, event->y);
+            break;
+        case GLFW_EVENT_CURSOR_ENTER:
+            _glfwInputCursorEnter(window, (GLFWbool) v[0]);
+            break;
+        case GLFW_EVENT_SCROLL:
+            _glfwInputScroll(window, event->x, event->y);
+            break;
+        case GLFW_EVENT_WINDOW_POS:
+            _glfwInputWindowPos(window, (int) v[0], (int) v[1]);
+            break;
+        case GLFW_EVENT_WINDOW_SIZE:
+            _glfwInputWindowSize(window, (int) v[0], (int) v[1]);
+            break;
+        case GLFW_EVENT_WINDOW_CLOSE:
+            _glfwInputWindowCloseRequest(window);
+            break;
+        case GLFW_EVENT_WINDOW_REFRESH:
+            _glfwInputWindowDamage(window);
+            break;
+        case GLFW_EVENT_WINDOW_FOCUS:
+            _glfwInputWindowFocus(window, (GLFWbool) v[0]);
+            break;
+        case GLFW_EVENT_WINDOW_ICONIFY:
+            _glfwInputWindowIconify(window, (GLFWbool) v[0]);
+            break;
+        case GLFW_EVENT_WINDOW_MAXIMIZE:
+            _glfwInputWindowMaximize(window, (GLFWbool) v[0]);
+            break;
+        case GLFW_EVENT_FRAMEBUFFER_SIZE:
+            _glfwInputFramebufferSize(window, (int) v[0], (int) v[1]);
+            break;
+        case GLFW_EVENT_WINDOW_CONTENT_SCALE:
+            _glfwInputWindowContentScale(window, (float) event->x, (float) event->y);
+            break;
+    }
+}
+
+// Opens an input recording file with a UTF-8 encoded path
+//
+static FILE* openRecordingFile(const char* path, const char* mode)
+{
+#if defined(_GLFW_WIN32)
+    // The C library expects paths in the current code page on Windows
+    FILE* file = NULL;
+    WCHAR* widePath = _glfwCreateWideStringFromUTF8Win32(path);
+    WCHAR* wideMode = _glfwCreateWideStringFromUTF8Win32(mode);
+
+    if (widePath && wideMode)
+        file = _wfopen(widePath, wideMode);
+    else
+        errno = EINVAL;
+
+    _glfw_free(widePath);
+    _glfw_free(wideMode);
+    return file;
+#else
+    return fopen(path, mode);
+#endif
+}
+
+// Closes the input recording file without writing the buffered part
+//
+static void closeRecording(void)
+{
+    fclose(_glfw.recording.file);
+    _glfw_free(_glfw.recording.buffer);
+
+    _glfw.recording.file = NULL;
+    _glfw.recording.buffer = NULL;
+    _glfw.recording.size = 0;
+}
+
+// Writes the buffered part of the input recording to its file, ending the
+// recording if that fails
+//
+static GLFWbool flushRecording(void)
+{
+    if (fwrite(_glfw.recording.buffer, 1, _glfw.recording.size,
+               _glfw.recording.file) != _glfw.recording.size)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to write input recording: %s",
+                        strerror(errno));
+        closeRecording();
+        return GLFW_FALSE;
+    }
+
+    _glfw.recording.size = 0;
+    return GLFW_TRUE;
+}
+
+// Finishes the input recording, if any, and closes its file
+//
+static void finishRecording(void)
+{
+    if (_glfw.recording.file && flushRecording())
+        closeRecording();
+}
 
-    for (i = 0;  i < 32;  i++)
+// Writes the common header of a recording event and returns where to write
+// its values, or NULL if the recording failed
+//
+static unsigned char* beginRecordEvent(_GLFWwindow* window, int type)
+{
+    if (_glfw.recording.size + _GLFW_RECORD_MAX_EVENT > _GLFW_RECORD_BUFFER)
     {
-        if (mapping->guid[i] >= 'A' && mapping->guid[i] <= 'F')
-            mapping->guid[i] += 'a' - 'A';
+        if (!flushRecording())
+            return NULL;
     }
 
-    _glfw.platform.updateGamepadGUID(mapping->guid);
-    return GLFW_TRUE;
+    if (!window->recordId)
+        window->recordId = ++_glfw.recording.windowCount;
+
+    // The timestamp is stored as microseconds since the previous event
+    const uint64_t frequency = _glfw.recording.frequency;
+    const uint64_t ticks = _glfwPlatformGetTimerValue() - _glfw.recording.start;
+    const uint64_t time = ticks / frequency * 1000000 +
+                          ticks % frequency * 1000000 / frequency;
+
+    unsigned char* p = _glfw.recording.buffer + _glfw.recording.size;
+    *p++ = (unsigned char) (type - GLFW_EVENT_KEY + 1);
+    p = writeVarint(p, (uint64_t) window->recordId - 1);
+    p = writeVarint(p, time - _glfw.recording.time);
+    _glfw.recording.time = time;
+    return p;
 }
 
 
@@ -277,6 +1107,11 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
     assert(action == GLFW_PRESS || action == GLFW_RELEASE);
     assert(mods == (mods & GLFW_MOD_MASK));
 
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_KEY, key, scancode, action, mods);
+
+    _glfwFlushCursorPos(window);
+
     if (key >= 0 && key <= GLFW_KEY_LAST)
     {
         GLFWbool repeated = GLFW_FALSE;
@@ -299,7 +1134,18 @@ void _glfwInputKey(_GLFWwindow* window, int key, int scancode, int action, int m
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
-    if (window->callbacks.key)
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_KEY);
+        if (event)
+        {
+            event->data.key.key = key;
+            event->data.key.scancode = scancode;
+            event->data.key.action = action;
+            event->data.key.mods = mods;
+        }
+    }
+    else if (window->callbacks.key)
         window->callbacks.key((GLFWwindow*) window, key, scancode, action, mods);
 }
 
@@ -312,12 +1158,32 @@ void _glfwInputChar(_GLFWwindow* window, uint32_t codepoint, int mods, GLFWbool
     assert(mods == (mods & GLFW_MOD_MASK));
     assert(plain == GLFW_TRUE || plain == GLFW_FALSE);
 
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_CHAR, (int) codepoint, mods, plain, 0);
+
+    _glfwFlushCursorPos(window);
+
     if (codepoint < 32 || (codepoint > 126 && codepoint < 160))
         return;
 
     if (!window->lockKeyMods)
         mods &= ~(GLFW_MOD_CAPS_LOCK | GLFW_MOD_NUM_LOCK);
 
+    if (window->batchEvents)
+    {
+        if (plain)
+        {
+            GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_CHAR);
+            if (event)
+            {
+                event->data.character.codepoint = codepoint;
+                event->data.character.mods = mods;
+            }
+        }
+
+        return;
+    }
+
     if (window->callbacks.charmods)
         window->callbacks.charmods((GLFWwindow*) window, codepoint, mods);
 
@@ -338,7 +1204,21 @@ void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset)
     assert(yoffset > -FLT_MAX);
     assert(yoffset < FLT_MAX);
 
-    if (window->callbacks.scroll)
+    if (_glfw.recording.file)
+        _glfwRecordEventf(window, GLFW_EVENT_SCROLL, xoffset, yoffset);
+
+    _glfwFlushCursorPos(window);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_SCROLL);
+        if (event)
+        {
+            event->data.scroll.x = xoffset;
+            event->data.scroll.y = yoffset;
+        }
+    }
+    else if (window->callbacks.scroll)
         window->callbacks.scroll((GLFWwindow*) window, xoffset, yoffset);
 }
 
@@ -351,6 +1231,11 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
     assert(action == GLFW_PRESS || action == GLFW_RELEASE);
     assert(mods == (mods & GLFW_MOD_MASK));
 
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_MOUSE_BUTTON, button, action, mods, 0);
+
+    _glfwFlushCursorPos(window);
+
     if (button < 0 || (!window->disableMouseButtonLimit && button > GLFW_MOUSE_BUTTON_LAST))
         return;
 
@@ -365,7 +1250,17 @@ void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods)
             window->mouseButtons[button] = (char) action;
     }
 
-    if (window->callbacks.mouseButton)
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_MOUSE_BUTTON);
+        if (event)
+        {
+            event->data.button.button = button;
+            event->data.button.action = action;
+            event->data.button.mods = mods;
+        }
+    }
+    else if (window->callbacks.mouseButton)
         window->callbacks.mouseButton((GLFWwindow*) window, button, action, mods);
 }
 
@@ -380,14 +1275,35 @@ void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos)
     assert(ypos > -FLT_MAX);
     assert(ypos < FLT_MAX);
 
+    if (_glfw.recording.file)
+        _glfwRecordEventf(window, GLFW_EVENT_CURSOR_POS, xpos, ypos);
+
     if (window->virtualCursorPosX == xpos && window->virtualCursorPosY == ypos)
         return;
 
     window->virtualCursorPosX = xpos;
     window->virtualCursorPosY = ypos;
 
-    if (window->callbacks.cursorPos)
-        window->callbacks.cursorPos((GLFWwindow*) window, xpos, ypos);
+    if (window->coalesceCursorMotion)
+    {
+        window->cursorMotionPending = GLFW_TRUE;
+        return;
+    }
+
+    reportCursorPos(window);
+}
+
+// Reports any cursor motion held back by cursor motion coalescing
+//
+void _glfwFlushCursorPos(_GLFWwindow* window)
+{
+    assert(window != NULL);
+
+    if (window->cursorMotionPending)
+    {
+        window->cursorMotionPending = GLFW_FALSE;
+        reportCursorPos(window);
+    }
 }
 
 // Notifies shared code of a cursor enter/leave event
@@ -397,10 +1313,97 @@ void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered)
     assert(window != NULL);
     assert(entered == GLFW_TRUE || entered == GLFW_FALSE);
 
-    if (window->callbacks.cursorEnter)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_CURSOR_ENTER, entered, 0, 0, 0);
+
+    _glfwFlushCursorPos(window);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_CURSOR_ENTER);
+        if (event)
+            event->data.state = entered;
+    }
+    else if (window->callbacks.cursorEnter)
         window->callbacks.cursorEnter((GLFWwindow*) window, entered);
 }
 
+// Appends an event for the specified window to the event batch
+//
+GLFWevent* _glfwInputEvent(_GLFWwindow* window, int type)
+{
+    GLFWevent* event;
+
+    assert(window != NULL);
+    assert(window->batchEvents);
+
+    if (_glfw.batch.count == _glfw.batch.capacity)
+    {
+        const int capacity = _glfw_max(_glfw.batch.capacity * 2, 256);
+        GLFWevent* events = _glfw_realloc(_glfw.batch.events,
+                                          capacity * sizeof(GLFWevent));
+        if (!events)
+            return NULL;
+
+        _glfw.batch.events = events;
+        _glfw.batch.capacity = capacity;
+    }
+
+    event = _glfw.batch.events + _glfw.batch.count++;
+    memset(event, 0, sizeof(GLFWevent));
+    event->type = type;
+    event->window = (GLFWwindow*) window;
+
+    if (_glfw.recording.replaying)
+        event->time = _glfw.recording.replayTime;
+    else
+    {
+        event->time = (double) (_glfwPlatformGetTimerValue() - _glfw.timer.offset) /
+            _glfwPlatformGetTimerFrequency();
+    }
+
+    return event;
+}
+
+// Appends an event with integer values to the input recording
+//
+void _glfwRecordEvent(_GLFWwindow* window, int type, int a, int b, int c, int d)
+{
+    const int values[4] = { a, b, c, d };
+    const int count = getRecordValueCount(type);
+
+    assert(window != NULL);
+    assert(_glfw.recording.file != NULL);
+    assert(count >= 0);
+
+    unsigned char* p = beginRecordEvent(window, type);
+    if (!p)
+        return;
+
+    for (int i = 0;  i < count;  i++)
+        p = writeSignedVarint(p, values[i]);
+
+    _glfw.recording.size = p - _glfw.recording.buffer;
+}
+
+// Appends an event with real values to the input recording
+//
+void _glfwRecordEventf(_GLFWwindow* window, int type, double x, double y)
+{
+    assert(window != NULL);
+    assert(_glfw.recording.file != NULL);
+    assert(getRecordValueCount(type) == -1);
+
+    unsigned char* p = beginRecordEvent(window, type);
+    if (!p)
+        return;
+
+    p = writeReal(p, x);
+    p = writeReal(p, y);
+
+    _glfw.recording.size = p - _glfw.recording.buffer;
+}
+
 // Notifies shared code of files or directories dropped on a window
 //
 void _glfwInputDrop(_GLFWwindow* window, int count, const char** paths)
@@ -409,10 +1412,95 @@ void _glfwInputDrop(_GLFWwindow* window, int count, const char** paths)
     assert(count > 0);
     assert(paths != NULL);
 
+    _glfwFlushCursorPos(window);
+
+    if (window->callbacks.dropStream)
+        window->callbacks.dropStream((GLFWwindow*) window, count, paths, GLFW_TRUE);
+
     if (window->callbacks.drop)
         window->callbacks.drop((GLFWwindow*) window, count, paths);
 }
 
+// Notifies shared code that files or directories were dropped on a window as
+// a text/uri-list, passing the paths to the drop stream callback in chunks as
+// they are parsed
+//
+void _glfwInputDropUriList(_GLFWwindow* window, const char* text)
+{
+    int count;
+    char** paths;
+
+    assert(window != NULL);
+    assert(text != NULL);
+
+    _glfwFlushCursorPos(window);
+
+    if (window->callbacks.dropStream)
+    {
+        const char* remaining = text;
+
+        while (*remaining)
+        {
+            paths = _glfwParseUriList(&remaining, _GLFW_DROP_CHUNK_SIZE, &count);
+            if (!paths)
+                break;
+
+            window->callbacks.dropStream((GLFWwindow*) window,
+                                         count, (const char**) paths,
+                                         *remaining == '\0');
+            _glfw_free(paths);
+        }
+    }
+
+    if (window->callbacks.drop)
+    {
+        paths = _glfwParseUriList(&text, INT_MAX, &count);
+        if (paths)
+        {
+            window->callbacks.drop((GLFWwindow*) window, count, (const char**) paths);
+            _glfw_free(paths);
+        }
+    }
+}
+
+// Notifies shared code that the clipboard contents requested with
+// glfwRequestClipboardString have arrived or could not be retrieved
+//
+void _glfwInputClipboardString(const char* string)
+{
+    _GLFWwindow* window;
+
+    _glfw.clipboardRequestActive = GLFW_FALSE;
+
+    // The string may belong to the platform clipboard state, which the
+    // callbacks can replace
+    char* copy = string ? _glfw_strdup(string) : NULL;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+        window->clipboardRequest.completed = (window->clipboardRequest.callback != NULL);
+
+    // The callbacks may make new requests and create or destroy windows, so
+    // the window list is searched again after each one
+    for (;;)
+    {
+        for (window = _glfw.windowListHead;  window;  window = window->next)
+        {
+            if (window->clipboardRequest.completed)
+                break;
+        }
+
+        if (!window)
+            break;
+
+        const GLFWclipboardfun callback = window->clipboardRequest.callback;
+        window->clipboardRequest.callback = NULL;
+        window->clipboardRequest.completed = GLFW_FALSE;
+        callback((GLFWwindow*) window, copy);
+    }
+
+    _glfw_free(copy);
+}
+
 // Notifies shared code of a joystick connection or disconnection
 //
 void _glfwInputJoystick(_GLFWjoystick* js, int event)
@@ -483,75 +1571,236 @@ void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value)
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
 
-// Adds the built-in set of gamepad mappings
+// Returns an available joystick object with arrays and name allocated
 //
-void _glfwInitGamepadMappings(void)
+_GLFWjoystick* _glfwAllocJoystick(const char* name,
+                                  const char* guid,
+                                  int axisCount,
+                                  int buttonCount,
+                                  int hatCount)
 {
-    size_t i;
-    const size_t count = sizeof(_glfwDefaultMappings) / sizeof(char*);
-    _glfw.mappings = _glfw_calloc(count, sizeof(_GLFWmapping));
+    int jid;
+    _GLFWjoystick* js;
+
+    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    {
+        if (!_glfw.joysticks[jid].allocated)
+            break;
+    }
+
+    if (jid > GLFW_JOYSTICK_LAST)
+        return NULL;
+
+    js = _glfw.joysticks + jid;
+    js->allocated   = GLFW_TRUE;
+    js->axes        = _glfw_calloc(axisCount, sizeof(float));
+    js->buttons     = _glfw_calloc(buttonCount + (size_t) hatCount * 4, 1);
+    js->hats        = _glfw_calloc(hatCount, 1);
+    js->axisCount   = axisCount;
+    js->buttonCount = buttonCount;
+    js->hatCount    = hatCount;
+
+    strncpy(js->name, name, sizeof(js->name) - 1);
+    strncpy(js->guid, guid, sizeof(js->guid) - 1);
+    js->mapping = findValidMapping(js);
+
+    return js;
+}
+
+// Frees arrays and name and flags the joystick object as unused
+//
+void _glfwFreeJoystick(_GLFWjoystick* js)
+{
+    _glfw_free(js->axes);
+    _glfw_free(js->buttons);
+    _glfw_free(js->hats);
+    memset(js, 0, sizeof(_GLFWjoystick));
+}
+
+// Center the cursor in the content area of the specified window
+//
+void _glfwCenterCursorInContentArea(_GLFWwindow* window)
+{
+    int width, height;
+
+    _glfw.platform.getWindowSize(window, &width, &height);
+    _glfw.platform.setCursorPos(window, width / 2.0, height / 2.0);
+}
+
+// Destroys the specified cursor regardless of whether it is still referenced
+//
+void _glfwDestroyCursor(_GLFWcursor* cursor)
+{
+    // Make sure the cursor is not being used by any window
+    {
+        _GLFWwindow* window;
+
+        for (window = _glfw.windowListHead;  window;  window = window->next)
+        {
+            if (window->cursor == cursor)
+                glfwSetCursor((GLFWwindow*) window, NULL);
+        }
+    }
+
+    _glfw.platform.destroyCursor(cursor);
+
+    // Unlink cursor from global linked list
+    {
+        _GLFWcursor** prev = &_glfw.cursorListHead;
+
+        while (*prev != cursor)
+            prev = &((*prev)->next);
+
+        *prev = cursor->next;
+    }
+
+    // Unlink cursor from its cache bucket
+    if (cursor->cache.pixels)
+    {
+        _GLFWcursor** prev =
+            _glfw.cursorBuckets + cursor->cache.hash % _GLFW_CURSOR_BUCKET_COUNT;
+
+        while (*prev != cursor)
+            prev = &((*prev)->cache.next);
+
+        *prev = cursor->cache.next;
+
+        if (!cursor->cache.references)
+            _glfw.unusedCursorCount--;
+    }
+
+    _glfw_free(cursor->cache.pixels);
+    _glfw_free(cursor);
+}
+
+// Starts loading the standard cursor images on a background thread, if
+// requested by the application
+//
+GLFWbool _glfwStartCursorPreload(void (*function)(void*))
+{
+    if (!_glfw.hints.init.preloadCursors)
+        return GLFW_FALSE;
+
+    _glfw.cursorPreload.running =
+        _glfwPlatformCreateThread(&_glfw.cursorPreload.thread, function, NULL);
+    return _glfw.cursorPreload.running;
+}
+
+// Waits for the standard cursor images to finish loading, if they are being
+// loaded in the background
+//
+void _glfwFinishCursorPreload(void)
+{
+    if (!_glfw.cursorPreload.running)
+        return;
+
+    _glfwPlatformJoinThread(&_glfw.cursorPreload.thread);
+    _glfw.cursorPreload.running = GLFW_FALSE;
+}
+
+// Returns the time in seconds until the first pending clipboard request times
+// out, or a negative value if no pending request has a timeout
+//
+double _glfwGetClipboardRequestTimeout(void)
+{
+    _GLFWwindow* window;
+    uint64_t deadline = 0;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        const uint64_t d = window->clipboardRequest.deadline;
+        if (window->clipboardRequest.callback && d && (!deadline || d < deadline))
+            deadline = d;
+    }
 
-    for (i = 0;  i < count;  i++)
+    if (!deadline)
+        return -1.0;
+
+    const uint64_t now = _glfwPlatformGetTimerValue();
+    if (deadline <= now)
+        return 0.0;
+
+    return (double) (deadline - now) / _glfwPlatformGetTimerFrequency();
+}
+
+// Reports the clipboard requests that have timed out and stops retrieving the
+// clipboard if there are no pending requests left
+//
+void _glfwUpdateClipboardRequests(void)
+{
+    _GLFWwindow* window;
+
+    if (!_glfw.clipboardRequestActive)
+        return;
+
+    for (;;)
     {
-        if (parseMapping(&_glfw.mappings[_glfw.mappingCount], _glfwDefaultMappings[i]))
-            _glfw.mappingCount++;
+        const uint64_t now = _glfwPlatformGetTimerValue();
+
+        for (window = _glfw.windowListHead;  window;  window = window->next)
+        {
+            const uint64_t deadline = window->clipboardRequest.deadline;
+            if (window->clipboardRequest.callback && deadline && deadline <= now)
+                break;
+        }
+
+        if (!window)
+            break;
+
+        const GLFWclipboardfun callback = window->clipboardRequest.callback;
+        window->clipboardRequest.callback = NULL;
+        callback((GLFWwindow*) window, NULL);
     }
+
+    _glfwCancelClipboardRequest(NULL);
 }
 
-// Returns an available joystick object with arrays and name allocated
+// Drops the pending clipboard request of the specified window, if any, and
+// stops retrieving the clipboard if there are no pending requests left
 //
-_GLFWjoystick* _glfwAllocJoystick(const char* name,
-                                  const char* guid,
-                                  int axisCount,
-                                  int buttonCount,
-                                  int hatCount)
+void _glfwCancelClipboardRequest(_GLFWwindow* window)
 {
-    int jid;
-    _GLFWjoystick* js;
+    if (window)
+        window->clipboardRequest.callback = NULL;
 
-    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    if (!_glfw.clipboardRequestActive)
+        return;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
     {
-        if (!_glfw.joysticks[jid].allocated)
-            break;
+        if (window->clipboardRequest.callback)
+            return;
     }
 
-    if (jid > GLFW_JOYSTICK_LAST)
-        return NULL;
-
-    js = _glfw.joysticks + jid;
-    js->allocated   = GLFW_TRUE;
-    js->axes        = _glfw_calloc(axisCount, sizeof(float));
-    js->buttons     = _glfw_calloc(buttonCount + (size_t) hatCount * 4, 1);
-    js->hats        = _glfw_calloc(hatCount, 1);
-    js->axisCount   = axisCount;
-    js->buttonCount = buttonCount;
-    js->hatCount    = hatCount;
-
-    strncpy(js->name, name, sizeof(js->name) - 1);
-    strncpy(js->guid, guid, sizeof(js->guid) - 1);
-    js->mapping = findValidMapping(js);
-
-    return js;
+    _glfw.platform.cancelClipboardRequest();
+    _glfw.clipboardRequestActive = GLFW_FALSE;
 }
 
-// Frees arrays and name and flags the joystick object as unused
+// Returns whether the specified MIME type is offered with glfwSetClipboardData
 //
-void _glfwFreeJoystick(_GLFWjoystick* js)
+GLFWbool _glfwClipboardDataOffered(const char* type)
 {
-    _glfw_free(js->axes);
-    _glfw_free(js->buttons);
-    _glfw_free(js->hats);
-    memset(js, 0, sizeof(_GLFWjoystick));
+    if (!_glfw.clipboardData.callback)
+        return GLFW_FALSE;
+
+    for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+    {
+        if (strcmp(_glfw.clipboardData.types[i], type) == 0)
+            return GLFW_TRUE;
+    }
+
+    return GLFW_FALSE;
 }
 
-// Center the cursor in the content area of the specified window
+// Frees the clipboard contents offered with glfwSetClipboardData
 //
-void _glfwCenterCursorInContentArea(_GLFWwindow* window)
+void _glfwFreeClipboardData(void)
 {
-    int width, height;
+    for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+        _glfw_free(_glfw.clipboardData.types[i]);
 
-    _glfw.platform.getWindowSize(window, &width, &height);
-    _glfw.platform.setCursorPos(window, width / 2.0, height / 2.0);
+    _glfw_free(_glfw.clipboardData.types);
+    memset(&_glfw.clipboardData, 0, sizeof(_glfw.clipboardData));
 }
 
 
@@ -580,6 +1829,10 @@ GLFWAPI int glfwGetInputMode(GLFWwindow* handle, int mode)
             return window->rawMouseMotion;
         case GLFW_UNLIMITED_MOUSE_BUTTONS:
             return window->disableMouseButtonLimit;
+        case GLFW_EVENT_BATCH:
+            return window->batchEvents;
+        case GLFW_COALESCE_CURSOR_MOTION:
+            return window->coalesceCursorMotion;
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode 0x%08X", mode);
@@ -693,6 +1946,23 @@ GLFWAPI void glfwSetInputMode(GLFWwindow* handle, int mode, int value)
             window->disableMouseButtonLimit = value ? GLFW_TRUE : GLFW_FALSE;
             return;
         }
+
+        case GLFW_EVENT_BATCH:
+        {
+            window->batchEvents = value ? GLFW_TRUE : GLFW_FALSE;
+            return;
+        }
+
+        case GLFW_COALESCE_CURSOR_MOTION:
+        {
+            value = value ? GLFW_TRUE : GLFW_FALSE;
+            if (window->coalesceCursorMotion == value)
+                return;
+
+            window->coalesceCursorMotion = value;
+            _glfwFlushCursorPos(window);
+            return;
+        }
     }
 
     _glfwInputError(GLFW_INVALID_ENUM, "Invalid input mode 0x%08X", mode);
@@ -846,6 +2116,7 @@ GLFWAPI void glfwSetCursorPos(GLFWwindow* handle, double xpos, double ypos)
 GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot)
 {
     _GLFWcursor* cursor;
+    uint64_t hash = 0;
 
     assert(image != NULL);
     assert(image->pixels != NULL);
@@ -858,16 +2129,52 @@ GLFWAPI GLFWcursor* glfwCreateCursor(const GLFWimage* image, int xhot, int yhot)
         return NULL;
     }
 
+    if (_glfw.hints.init.cursorCacheLimit > 0)
+    {
+        hash = hashCursorImage(image, xhot, yhot);
+
+        cursor = findCachedCursor(image, xhot, yhot, hash);
+        if (cursor)
+        {
+            if (cursor->cache.references++ == 0)
+                _glfw.unusedCursorCount--;
+
+            return (GLFWcursor*) cursor;
+        }
+    }
+
     cursor = _glfw_calloc(1, sizeof(_GLFWcursor));
     cursor->next = _glfw.cursorListHead;
     _glfw.cursorListHead = cursor;
 
     if (!_glfw.platform.createCursor(cursor, image, xhot, yhot))
     {
-        glfwDestroyCursor((GLFWcursor*) cursor);
+        _glfwDestroyCursor(cursor);
         return NULL;
     }
 
+    if (_glfw.hints.init.cursorCacheLimit > 0)
+    {
+        const size_t size = (size_t) image->width * image->height * 4;
+
+        // The cursor is simply left uncached if the image cannot be copied
+        cursor->cache.pixels = _glfw_calloc(size, 1);
+        if (cursor->cache.pixels)
+        {
+            memcpy(cursor->cache.pixels, image->pixels, size);
+            cursor->cache.hash = hash;
+            cursor->cache.width = image->width;
+            cursor->cache.height = image->height;
+            cursor->cache.xhot = xhot;
+            cursor->cache.yhot = yhot;
+            cursor->cache.references = 1;
+
+            const size_t bucket = hash % _GLFW_CURSOR_BUCKET_COUNT;
+            cursor->cache.next = _glfw.cursorBuckets[bucket];
+            _glfw.cursorBuckets[bucket] = cursor;
+        }
+    }
+
     return (GLFWcursor*) cursor;
 }
 
@@ -898,7 +2205,7 @@ GLFWAPI GLFWcursor* glfwCreateStandardCursor(int shape)
 
     if (!_glfw.platform.createStandardCursor(cursor, shape))
     {
-        glfwDestroyCursor((GLFWcursor*) cursor);
+        _glfwDestroyCursor(cursor);
         return NULL;
     }
 
@@ -914,7 +2221,19 @@ GLFWAPI void glfwDestroyCursor(GLFWcursor* handle)
     if (cursor == NULL)
         return;
 
-    // Make sure the cursor is not being used by any window
+    if (!cursor->cache.pixels)
+    {
+        _glfwDestroyCursor(cursor);
+        return;
+    }
+
+    assert(cursor->cache.references > 0);
+
+    if (--cursor->cache.references > 0)
+        return;
+
+    // Keep the unused cursor in the cache but make sure it is not being used by
+    // any window, as if it had been destroyed
     {
         _GLFWwindow* window;
 
@@ -925,19 +2244,15 @@ GLFWAPI void glfwDestroyCursor(GLFWcursor* handle)
         }
     }
 
-    _glfw.platform.destroyCursor(cursor);
-
-    // Unlink cursor from global linked list
-    {
-        _GLFWcursor** prev = &_glfw.cursorListHead;
-
-        while (*prev != cursor)
-            prev = &((*prev)->next);
-
-        *prev = cursor->next;
-    }
+    cursor->cache.released = ++_glfw.cursorSerial;
+    _glfw.unusedCursorCount++;
+    trimCursorCache(_glfw.hints.init.cursorCacheLimit);
+}
 
-    _glfw_free(cursor);
+GLFWAPI void glfwPurgeCursorCache(void)
+{
+    _GLFW_REQUIRE_INIT();
+    trimCursorCache(0);
 }
 
 GLFWAPI void glfwSetCursor(GLFWwindow* windowHandle, GLFWcursor* cursorHandle)
@@ -1045,6 +2360,176 @@ GLFWAPI GLFWdropfun glfwSetDropCallback(GLFWwindow* handle, GLFWdropfun cbfun)
     return cbfun;
 }
 
+GLFWAPI GLFWdropstreamfun glfwSetDropStreamCallback(GLFWwindow* handle,
+                                                    GLFWdropstreamfun cbfun)
+{
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+
+    _GLFW_SWAP(GLFWdropstreamfun, window->callbacks.dropStream, cbfun);
+    return cbfun;
+}
+
+GLFWAPI int glfwStartInputRecording(const char* path)
+{
+    assert(path != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    finishRecording();
+
+    FILE* file = openRecordingFile(path, "wb");
+    if (!file)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to create input recording %s: %s",
+                        path, strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    unsigned char* buffer = _glfw_calloc(_GLFW_RECORD_BUFFER, 1);
+    if (!buffer)
+    {
+        fclose(file);
+        return GLFW_FALSE;
+    }
+
+    // The recording is buffered here, so stdio buffering would only add a copy
+    setvbuf(file, NULL, _IONBF, 0);
+
+    memcpy(buffer, _GLFW_RECORD_MAGIC, _GLFW_RECORD_HEADER - 1);
+    buffer[_GLFW_RECORD_HEADER - 1] = _GLFW_RECORD_VERSION;
+
+    _glfw.recording.file = file;
+    _glfw.recording.buffer = buffer;
+    _glfw.recording.size = _GLFW_RECORD_HEADER;
+    _glfw.recording.start = _glfwPlatformGetTimerValue();
+    _glfw.recording.frequency = _glfwPlatformGetTimerFrequency();
+    _glfw.recording.time = 0;
+    _glfw.recording.windowCount = 0;
+
+    for (_GLFWwindow* window = _glfw.windowListHead;  window;  window = window->next)
+        window->recordId = 0;
+
+    return GLFW_TRUE;
+}
+
+GLFWAPI void glfwStopInputRecording(void)
+{
+    _GLFW_REQUIRE_INIT();
+    finishRecording();
+}
+
+GLFWAPI int glfwReplayInputRecording(const char* path, GLFWwindow** windows, int count)
+{
+    assert(path != NULL);
+    assert(count >= 0);
+    assert(windows != NULL || count == 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid window count %i", count);
+        return GLFW_FALSE;
+    }
+
+    FILE* file = openRecordingFile(path, "rb");
+    if (!file)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to open input recording %s: %s",
+                        path, strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0)
+        size = ftell(file);
+
+    if (size < 0 || fseek(file, 0, SEEK_SET) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to read input recording %s: %s",
+                        path, strerror(errno));
+        fclose(file);
+        return GLFW_FALSE;
+    }
+
+    unsigned char* data = _glfw_calloc((size_t) size + 1, 1);
+    if (!data)
+    {
+        fclose(file);
+        return GLFW_FALSE;
+    }
+
+    if (fread(data, 1, (size_t) size, file) != (size_t) size)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Failed to read input recording %s: %s",
+                        path, strerror(errno));
+        _glfw_free(data);
+        fclose(file);
+        return GLFW_FALSE;
+    }
+
+    fclose(file);
+
+    const unsigned char* start = data + _GLFW_RECORD_HEADER;
+    const unsigned char* end = data + size;
+    const unsigned char* p;
+    _GLFWrecordevent event = {0};
+
+    if (size < _GLFW_RECORD_HEADER ||
+        memcmp(data, _GLFW_RECORD_MAGIC, _GLFW_RECORD_HEADER - 1) != 0 ||
+        data[_GLFW_RECORD_HEADER - 1] != _GLFW_RECORD_VERSION)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "%s is not a supported input recording", path);
+        _glfw_free(data);
+        return GLFW_FALSE;
+    }
+
+    // Validate the whole recording before replaying any of it
+    for (p = start;  p < end;  )
+    {
+        if (!readRecordEvent(&p, end, &event))
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Invalid event at offset %li of input recording %s",
+                            (long) (p - data), path);
+            _glfw_free(data);
+            return GLFW_FALSE;
+        }
+    }
+
+    const GLFWbool replaying = _glfw.recording.replaying;
+    const double replayTime = _glfw.recording.replayTime;
+
+    _glfw.recording.replaying = GLFW_TRUE;
+
+    memset(&event, 0, sizeof(event));
+
+    for (p = start;  p < end;  )
+    {
+        readRecordEvent(&p, end, &event);
+
+        if (event.id >= (uint64_t) count || !windows[event.id])
+            continue;
+
+        _glfw.recording.replayTime = event.time / 1e6;
+        replayRecordEvent((_GLFWwindow*) windows[event.id], &event);
+    }
+
+    _glfw.recording.replaying = replaying;
+    _glfw.recording.replayTime = replayTime;
+
+    _glfw_free(data);
+    return GLFW_TRUE;
+}
+
 GLFWAPI int glfwJoystickPresent(int jid)
 {
     _GLFWjoystick* js;
@@ -1271,62 +2756,22 @@ GLFWAPI GLFWjoystickfun glfwSetJoystickCallback(GLFWjoystickfun cbfun)
 
 GLFWAPI int glfwUpdateGamepadMappings(const char* string)
 {
-    int jid;
-    const char* c = string;
-
     assert(string != NULL);
 
     _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
 
-    while (*c)
-    {
-        if ((*c >= '0' && *c <= '9') ||
-            (*c >= 'a' && *c <= 'f') ||
-            (*c >= 'A' && *c <= 'F'))
-        {
-            char line[1024];
-
-            const size_t length = strcspn(c, "\r\n");
-            if (length < sizeof(line))
-            {
-                _GLFWmapping mapping = {{0}};
-
-                memcpy(line, c, length);
-                line[length] = '\0';
-
-                if (parseMapping(&mapping, line))
-                {
-                    _GLFWmapping* previous = findMapping(mapping.guid);
-                    if (previous)
-                        *previous = mapping;
-                    else
-                    {
-                        _glfw.mappingCount++;
-                        _glfw.mappings =
-                            _glfw_realloc(_glfw.mappings,
-                                          sizeof(_GLFWmapping) * _glfw.mappingCount);
-                        _glfw.mappings[_glfw.mappingCount - 1] = mapping;
-                    }
-                }
-            }
+    // Invalid lines are reported as errors but only running out of memory is
+    // a failure
+    return updateMappings(string, strlen(string), GLFW_FALSE);
+}
 
-            c += length;
-        }
-        else
-        {
-            c += strcspn(c, "\r\n");
-            c += strspn(c, "\r\n");
-        }
-    }
+GLFWAPI int glfwUpdateGamepadMappingsFromMemory(const char* data, size_t size)
+{
+    assert(data != NULL || size == 0);
 
-    for (jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
-    {
-        _GLFWjoystick* js = _glfw.joysticks + jid;
-        if (js->connected)
-            js->mapping = findValidMapping(js);
-    }
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
 
-    return GLFW_TRUE;
+    return updateMappings(data, size, GLFW_TRUE);
 }
 
 GLFWAPI int glfwJoystickIsGamepad(int jid)
@@ -1479,6 +2924,7 @@ GLFWAPI void glfwSetClipboardString(GLFWwindow* handle, const char* string)
     assert(string != NULL);
 
     _GLFW_REQUIRE_INIT();
+    _glfwFreeClipboardData();
     _glfw.platform.setClipboardString(string);
 }
 
@@ -1488,6 +2934,105 @@ GLFWAPI const char* glfwGetClipboardString(GLFWwindow* handle)
     return _glfw.platform.getClipboardString();
 }
 
+GLFWAPI void glfwRequestClipboardString(GLFWwindow* handle,
+                                        GLFWclipboardfun callback,
+                                        double timeout)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(callback != NULL);
+    assert(timeout == timeout);
+    assert(timeout >= 0.0);
+    assert(timeout <= DBL_MAX);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (timeout != timeout || timeout < 0.0 || timeout > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid time %f", timeout);
+        return;
+    }
+
+    window->clipboardRequest.callback = callback;
+    window->clipboardRequest.deadline = 0;
+
+    if (timeout > 0.0)
+    {
+        const uint64_t now = _glfwPlatformGetTimerValue();
+        const double ticks = timeout * _glfwPlatformGetTimerFrequency();
+
+        // Timeouts beyond the range of the timer never expire
+        if (ticks < (double) (UINT64_MAX - now))
+            window->clipboardRequest.deadline = now + (uint64_t) ticks;
+    }
+
+    if (!_glfw.clipboardRequestActive)
+    {
+        _glfw.clipboardRequestActive = GLFW_TRUE;
+        _glfw.platform.requestClipboardString();
+    }
+}
+
+GLFWAPI void glfwSetClipboardData(const char* const* types,
+                                  int count,
+                                  GLFWclipboarddatafun callback)
+{
+    assert(types != NULL);
+    assert(count > 0);
+    assert(callback != NULL);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (count <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid type count %i", count);
+        return;
+    }
+
+    char** copies = _glfw_calloc(count, sizeof(char*));
+    if (!copies)
+        return;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        assert(types[i] != NULL);
+
+        if (types[i])
+            copies[i] = _glfw_strdup(types[i]);
+        else
+            _glfwInputError(GLFW_INVALID_VALUE, "Invalid clipboard type NULL");
+
+        if (!copies[i])
+        {
+            for (int j = 0;  j < i;  j++)
+                _glfw_free(copies[j]);
+
+            _glfw_free(copies);
+            return;
+        }
+    }
+
+    _glfwFreeClipboardData();
+    _glfw.clipboardData.callback = callback;
+    _glfw.clipboardData.types = copies;
+    _glfw.clipboardData.typeCount = count;
+
+    // The callback must not be called for data the platform never took over
+    if (!_glfw.platform.setClipboardData())
+        _glfwFreeClipboardData();
+}
+
+GLFWAPI const void* glfwGetClipboardData(const char* type, size_t* size)
+{
+    assert(type != NULL);
+    assert(size != NULL);
+
+    *size = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+    return _glfw.platform.getClipboardData(type, size);
+}
+
 GLFWAPI double glfwGetTime(void)
 {
     _GLFW_REQUIRE_INIT_OR_RETURN(0.0);
@@ -50,6 +50,7 @@
 #include "../include/GLFW/glfw3gui.h"
 
 #include <stdbool.h>
+#include <stdio.h>
 
 #define _GLFW_INSERT_FIRST      0
 #define _GLFW_INSERT_LAST       1
@@ -60,6 +61,17 @@
 #define _GLFW_POLL_ALL          (_GLFW_POLL_AXES | _GLFW_POLL_BUTTONS)
 
 #define _GLFW_MESSAGE_SIZE      1024
+#define _GLFW_DROP_CHUNK_SIZE   1024
+
+#define _GLFW_STANDARD_CURSOR_COUNT (GLFW_NOT_ALLOWED_CURSOR - GLFW_ARROW_CURSOR + 1)
+#define _GLFW_CURSOR_BUCKET_COUNT   64
+
+#define GLFW_MOD_MASK (GLFW_MOD_SHIFT | \
+                       GLFW_MOD_CONTROL | \
+                       GLFW_MOD_ALT | \
+                       GLFW_MOD_SUPER | \
+                       GLFW_MOD_CAPS_LOCK | \
+                       GLFW_MOD_NUM_LOCK)
 
 typedef int GLFWbool;
 typedef void (*GLFWproc)(void);
@@ -68,18 +80,26 @@ typedef struct _GLFWerror       _GLFWerror;
 typedef struct _GLFWinitconfig  _GLFWinitconfig;
 typedef struct _GLFWwndconfig   _GLFWwndconfig;
 typedef struct _GLFWctxconfig   _GLFWctxconfig;
-typedef struct _GLFWfbconfig    _GLFWfbconfig;
+typedef struct _GLFWfbconfigcache _GLFWfbconfigcache;
 typedef struct _GLFWcontext     _GLFWcontext;
+typedef struct _GLFWextslot     _GLFWextslot;
+typedef struct _GLFWprocslot    _GLFWprocslot;
+typedef struct _GLFWproctable   _GLFWproctable;
 typedef struct _GLFWwindow      _GLFWwindow;
+typedef struct _GLFWwindowpool  _GLFWwindowpool;
 typedef struct _GLFWplatform    _GLFWplatform;
 typedef struct _GLFWlibrary     _GLFWlibrary;
 typedef struct _GLFWmonitor     _GLFWmonitor;
 typedef struct _GLFWcursor      _GLFWcursor;
 typedef struct _GLFWmapelement  _GLFWmapelement;
 typedef struct _GLFWmapping     _GLFWmapping;
+typedef struct _GLFWmapslot     _GLFWmapslot;
+typedef struct _GLFWgammatransition _GLFWgammatransition;
 typedef struct _GLFWjoystick    _GLFWjoystick;
 typedef struct _GLFWtls         _GLFWtls;
 typedef struct _GLFWmutex       _GLFWmutex;
+typedef struct _GLFWcond        _GLFWcond;
+typedef struct _GLFWthread      _GLFWthread;
 
 #define GL_VERSION 0x1f02
 #define GL_NONE 0
@@ -332,7 +352,9 @@ typedef PFN_vkVoidFunction (APIENTRY * PFN_vkGetInstanceProcAddr)(VkInstance,con
 typedef VkResult (APIENTRY * PFN_vkEnumerateInstanceExtensionProperties)(const char*,uint32_t*,VkExtensionProperties*);
 #define vkGetInstanceProcAddr _glfw.vk.GetInstanceProcAddr
 
+#include "fbconfig.h"
 #include "platform.h"
+#include "pixel.h"
 
 #define GLFW_NATIVE_INCLUDE_NONE
 #include "../include/GLFW/glfw3native.h"
@@ -378,6 +400,8 @@ struct _GLFWinitconfig
     GLFWbool      hatButtons;
     int           angleType;
     int           platformID;
+    int           cursorCacheLimit;
+    GLFWbool      preloadCursors;
     PFN_vkGetInstanceProcAddr vulkanLoader;
     struct {
         GLFWbool  menubar;
@@ -456,33 +480,45 @@ struct _GLFWctxconfig
     } nsgl;
 };
 
-// Framebuffer configuration
+// The number of framebuffer config choices remembered per display
+//
+#define _GLFW_FBCONFIG_CHOICE_COUNT 8
+
+// Usable framebuffer configs of a context creation API display, translated
+// once, and the configs most recently chosen from them
 //
-// This describes buffers and their sizes.  It also contains
-// a platform-specific ID used to map back to the backend API object.
+struct _GLFWfbconfigcache
+{
+    _GLFWfbconfig*  configs;
+    // Context creation API specific type bits of each config
+    int*            types;
+    int             count;
+    struct {
+        _GLFWfbconfig   desired;
+        int             key;
+        uintptr_t       handle;
+    } choices[_GLFW_FBCONFIG_CHOICE_COUNT];
+    int             choiceCount;
+    int             nextChoice;
+};
+
+// Extension hash set slot
 //
-// It is used to pass framebuffer parameters from shared code to the platform
-// API and also to enumerate and select available framebuffer configs.
+struct _GLFWextslot
+{
+    uint32_t        hash;
+    // Name of the extension, or NULL if the slot is empty
+    const char*     name;
+};
+
+// Entry point memo table slot
 //
-struct _GLFWfbconfig
+struct _GLFWprocslot
 {
-    int         redBits;
-    int         greenBits;
-    int         blueBits;
-    int         alphaBits;
-    int         depthBits;
-    int         stencilBits;
-    int         accumRedBits;
-    int         accumGreenBits;
-    int         accumBlueBits;
-    int         accumAlphaBits;
-    int         auxBuffers;
-    GLFWbool    stereo;
-    int         samples;
-    GLFWbool    sRGB;
-    GLFWbool    doublebuffer;
-    GLFWbool    transparent;
-    uintptr_t   handle;
+    uint32_t        hash;
+    // Name of the entry point, or NULL if the slot is empty
+    char*           name;
+    GLFWglproc      proc;
 };
 
 // Context structure
@@ -504,10 +540,18 @@ struct _GLFWcontext
     void (*makeCurrent)(_GLFWwindow*);
     void (*swapBuffers)(_GLFWwindow*);
     void (*swapInterval)(int);
-    int (*extensionSupported)(const char*);
+    const char* (*getExtensionString)(void);
     GLFWglproc (*getProcAddress)(const char*);
     void (*destroy)(_GLFWwindow*);
 
+    // Hash set of all supported extensions, built by the first query
+    _GLFWextslot*       extensionSlots;
+    int                 extensionSlotCount;
+    char*               extensionNames;
+
+    // Entry points already retrieved by this context or its share group
+    _GLFWproctable*     procs;
+
     struct {
         EGLConfig       config;
         EGLContext      handle;
@@ -561,6 +605,19 @@ struct _GLFWwindow
     // Virtual cursor position when cursor is disabled
     double              virtualCursorPosX, virtualCursorPosY;
     GLFWbool            rawMouseMotion;
+    GLFWbool            batchEvents;
+    GLFWbool            coalesceCursorMotion;
+    GLFWbool            cursorMotionPending;
+    // One-based index of the window in the current input recording
+    int                 recordId;
+    // The pool the window is returned to when destroyed, if any
+    _GLFWwindowpool*    pool;
+    // Pending request made with glfwRequestClipboardString
+    struct {
+        GLFWclipboardfun callback;
+        uint64_t        deadline;
+        GLFWbool        completed;
+    } clipboardRequest;
 
     _GLFWcontext        context;
 
@@ -582,12 +639,38 @@ struct _GLFWwindow
         GLFWcharfun               character;
         GLFWcharmodsfun           charmods;
         GLFWdropfun               drop;
+        GLFWdropstreamfun         dropStream;
     } callbacks;
 
     // This is defined in platform.h
     GLFW_PLATFORM_WINDOW_STATE
 };
 
+// Hidden windows created ahead of time for a set of window hints
+//
+struct _GLFWwindowpool
+{
+    _GLFWwindowpool*    next;
+
+    // The hints of the pooled windows, without those applied at hand out
+    _GLFWfbconfig       fbconfig;
+    _GLFWctxconfig      ctxconfig;
+    _GLFWwndconfig      wndconfig;
+
+    // Idle windows waiting to be handed out
+    _GLFWwindow**       windows;
+    int                 count;
+    int                 size;
+};
+
+// Bits of the monitor properties cached by shared code
+//
+#define _GLFW_MONITOR_MODE      0x01
+#define _GLFW_MONITOR_POS       0x02
+#define _GLFW_MONITOR_WORKAREA  0x04
+#define _GLFW_MONITOR_SCALE     0x08
+#define _GLFW_MONITOR_GAMMA     0x10
+
 // Monitor structure
 //
 struct _GLFWmonitor
@@ -605,18 +688,55 @@ struct _GLFWmonitor
     int             modeCount;
     GLFWvidmode     currentMode;
 
+    // Properties cached until the platform reports that they may have changed,
+    // with the valid ones marked in a bit mask
+    int             cached;
+    int             xpos, ypos;
+    int             workareaX, workareaY, workareaWidth, workareaHeight;
+    float           xscale, yscale;
+
     GLFWgammaramp   originalRamp;
+    // The current gamma ramp, valid when marked as cached
     GLFWgammaramp   currentRamp;
+    // The gamma transition in progress, guarded by the gamma transition lock
+    _GLFWgammatransition* transition;
 
     // This is defined in platform.h
     GLFW_PLATFORM_MONITOR_STATE
 };
 
+// Gamma transition structure
+//
+struct _GLFWgammatransition
+{
+    _GLFWgammatransition* next;
+    _GLFWmonitor*   monitor;
+    GLFWgammaramp   start;
+    GLFWgammaramp   target;
+    // The ramp most recently set by the transition thread
+    GLFWgammaramp   ramp;
+    uint64_t        startTime;
+    uint64_t        duration;
+    // The time between steps, in timer ticks
+    uint64_t        interval;
+};
+
 // Cursor structure
 //
 struct _GLFWcursor
 {
     _GLFWcursor*    next;
+    // The image of a custom cursor, used to find it in the cursor cache
+    struct {
+        uint64_t        hash;
+        int             width, height;
+        int             xhot, yhot;
+        unsigned char*  pixels;
+        int             references;
+        uint64_t        released;
+        // The next cached cursor in the same hash bucket
+        _GLFWcursor*    next;
+    } cache;
     // This is defined in platform.h
     GLFW_PLATFORM_CURSOR_STATE
 };
@@ -641,6 +761,17 @@ struct _GLFWmapping
     _GLFWmapelement axes[6];
 };
 
+// Gamepad mapping hash table slot
+//
+struct _GLFWmapslot
+{
+    uint8_t         guid[16];
+    // One-based index into the mapping array, or zero if the slot is empty
+    int             index;
+    // Serial number of the bulk update that last set the mapping, if any
+    unsigned int    serial;
+};
+
 // Joystick structure
 //
 struct _GLFWjoystick
@@ -656,7 +787,7 @@ struct _GLFWjoystick
     char            name[128];
     void*           userPointer;
     char            guid[33];
-    _GLFWmapping*   mapping;
+    const _GLFWmapping* mapping;
 
     // This is defined in platform.h
     GLFW_PLATFORM_JOYSTICK_STATE
@@ -678,6 +809,36 @@ struct _GLFWmutex
     GLFW_PLATFORM_MUTEX_STATE
 };
 
+// Condition variable structure
+//
+struct _GLFWcond
+{
+    // This is defined in platform.h
+    GLFW_PLATFORM_COND_STATE
+};
+
+// Entry point memo table, shared by the contexts of a share group
+//
+struct _GLFWproctable
+{
+    int             references;
+    // Only serializes lookups made with the contexts using this table
+    _GLFWmutex      lock;
+    _GLFWprocslot*  slots;
+    int             slotCount;
+    int             count;
+};
+
+// Thread structure
+//
+struct _GLFWthread
+{
+    void            (*function)(void*);
+    void*           argument;
+    // This is defined in platform.h
+    GLFW_PLATFORM_THREAD_STATE
+};
+
 // Platform API structure
 //
 struct _GLFWplatform
@@ -700,6 +861,10 @@ struct _GLFWplatform
     int (*getKeyScancode)(int);
     void (*setClipboardString)(const char*);
     const char* (*getClipboardString)(void);
+    void (*requestClipboardString)(void);
+    void (*cancelClipboardRequest)(void);
+    GLFWbool (*setClipboardData)(void);
+    const void* (*getClipboardData)(const char*,size_t*);
     GLFWbool (*initJoysticks)(void);
     void (*terminateJoysticks)(void);
     GLFWbool (*pollJoystick)(_GLFWjoystick*,int);
@@ -713,7 +878,8 @@ struct _GLFWplatform
     GLFWvidmode* (*getVideoModes)(_GLFWmonitor*,int*);
     GLFWbool (*getVideoMode)(_GLFWmonitor*,GLFWvidmode*);
     GLFWbool (*getGammaRamp)(_GLFWmonitor*,GLFWgammaramp*);
-    void (*setGammaRamp)(_GLFWmonitor*,const GLFWgammaramp*);
+    GLFWbool (*setGammaRamp)(_GLFWmonitor*,const GLFWgammaramp*);
+    void (*flushGammaRamps)(void);
     // window
     GLFWbool (*createWindow)(_GLFWwindow*,const _GLFWwndconfig*,const _GLFWctxconfig*,const _GLFWfbconfig*);
     void (*destroyWindow)(_GLFWwindow*);
@@ -781,15 +947,81 @@ struct _GLFWlibrary
 
     _GLFWerror*         errorListHead;
     _GLFWcursor*        cursorListHead;
+    // Cached custom cursors, chained by the low bits of their image hash
+    _GLFWcursor*        cursorBuckets[_GLFW_CURSOR_BUCKET_COUNT];
+    // The number of cached cursors without references
+    int                 unusedCursorCount;
+    // Incremented each time a cached cursor becomes unused
+    uint64_t            cursorSerial;
+    // The thread loading the standard cursor images, if still running
+    struct {
+        _GLFWthread     thread;
+        GLFWbool        running;
+    } cursorPreload;
     _GLFWwindow*        windowListHead;
+    _GLFWwindowpool*    windowPoolListHead;
 
     _GLFWmonitor**      monitors;
     int                 monitorCount;
 
+    // The most recently generated gamma ramp, along with the logarithms of
+    // the intensities of ramps of that size
+    struct {
+        float*          log2;
+        unsigned short* values;
+        unsigned int    size;
+        float           exponent;
+    } gamma;
+
+    // The thread animating gamma transitions, started by the first transition
+    struct {
+        _GLFWthread     thread;
+        _GLFWmutex      lock;
+        _GLFWcond       cond;
+        GLFWbool        running;
+        GLFWbool        quit;
+        _GLFWgammatransition* head;
+    } gammaTransitions;
+
+    struct {
+        GLFWevent*      events;
+        int             count;
+        int             capacity;
+        // The number of leading events already available to the application
+        int             returned;
+    } batch;
+
+    struct {
+        FILE*           file;
+        unsigned char*  buffer;
+        size_t          size;
+        uint64_t        start;
+        uint64_t        frequency;
+        uint64_t        time;
+        int             windowCount;
+        GLFWbool        replaying;
+        double          replayTime;
+    } recording;
+
+    // Whether the platform is retrieving the clipboard for pending requests
+    GLFWbool            clipboardRequestActive;
+
+    // Clipboard contents offered with glfwSetClipboardData
+    struct {
+        GLFWclipboarddatafun callback;
+        char**          types;
+        int             typeCount;
+    } clipboardData;
+
     GLFWbool            joysticksInitialized;
     _GLFWjoystick       joysticks[GLFW_JOYSTICK_LAST + 1];
     _GLFWmapping*       mappings;
     int                 mappingCount;
+    int                 mappingCapacity;
+    // Open addressing hash table of mappings keyed by binary GUID
+    _GLFWmapslot*       mappingSlots;
+    int                 mappingSlotCount;
+    unsigned int        mappingSerial;
 
     _GLFWtls            errorSlot;
     _GLFWtls            contextSlot;
@@ -824,6 +1056,8 @@ struct _GLFWlibrary
         GLFWbool        ANGLE_platform_angle_metal;
         GLFWbool        MESA_platform_surfaceless;
 
+        _GLFWfbconfigcache* fbconfigs;
+
         void*           handle;
 
         PFN_eglGetConfigAttrib      GetConfigAttrib;
@@ -910,6 +1144,16 @@ void _glfwPlatformDestroyMutex(_GLFWmutex* mutex);
 void _glfwPlatformLockMutex(_GLFWmutex* mutex);
 void _glfwPlatformUnlockMutex(_GLFWmutex* mutex);
 
+GLFWbool _glfwPlatformCreateCond(_GLFWcond* cond);
+void _glfwPlatformDestroyCond(_GLFWcond* cond);
+GLFWbool _glfwPlatformWaitCond(_GLFWcond* cond, _GLFWmutex* mutex, double* timeout);
+void _glfwPlatformSignalCond(_GLFWcond* cond);
+
+GLFWbool _glfwPlatformCreateThread(_GLFWthread* thread,
+                                   void (*function)(void*),
+                                   void* argument);
+void _glfwPlatformJoinThread(_GLFWthread* thread);
+
 void* _glfwPlatformLoadModule(const char* path);
 void _glfwPlatformFreeModule(void* module);
 GLFWproc _glfwPlatformGetModuleSymbol(void* module, const char* name);
@@ -930,6 +1174,7 @@ void _glfwInputWindowMaximize(_GLFWwindow* window, GLFWbool maximized);
 void _glfwInputWindowDamage(_GLFWwindow* window);
 void _glfwInputWindowCloseRequest(_GLFWwindow* window);
 void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor);
+void _glfwTerminateWindowPools(void);
 
 void _glfwInputKey(_GLFWwindow* window,
                    int key, int scancode, int action, int mods);
@@ -938,15 +1183,23 @@ void _glfwInputChar(_GLFWwindow* window,
 void _glfwInputScroll(_GLFWwindow* window, double xoffset, double yoffset);
 void _glfwInputMouseClick(_GLFWwindow* window, int button, int action, int mods);
 void _glfwInputCursorPos(_GLFWwindow* window, double xpos, double ypos);
+void _glfwFlushCursorPos(_GLFWwindow* window);
 void _glfwInputCursorEnter(_GLFWwindow* window, GLFWbool entered);
 void _glfwInputDrop(_GLFWwindow* window, int count, const char** names);
+void _glfwInputDropUriList(_GLFWwindow* window, const char* text);
+void _glfwInputClipboardString(const char* string);
 void _glfwInputJoystick(_GLFWjoystick* js, int event);
 void _glfwInputJoystickAxis(_GLFWjoystick* js, int axis, float value);
 void _glfwInputJoystickButton(_GLFWjoystick* js, int button, char value);
 void _glfwInputJoystickHat(_GLFWjoystick* js, int hat, char value);
 
+GLFWevent* _glfwInputEvent(_GLFWwindow* window, int type);
+void _glfwRecordEvent(_GLFWwindow* window, int type, int a, int b, int c, int d);
+void _glfwRecordEventf(_GLFWwindow* window, int type, double x, double y);
+
 void _glfwInputMonitor(_GLFWmonitor* monitor, int action, int placement);
 void _glfwInputMonitorWindow(_GLFWmonitor* monitor, _GLFWwindow* window);
+void _glfwInputMonitorChange(_GLFWmonitor* monitor);
 
 #if defined(__GNUC__)
 void _glfwInputError(int code, const char* format, ...)
@@ -963,12 +1216,20 @@ void _glfwInputError(int code, const char* format, ...);
 GLFWbool _glfwSelectPlatform(int platformID, _GLFWplatform* platform);
 
 GLFWbool _glfwStringInExtensionString(const char* string, const char* extensions);
-const _GLFWfbconfig* _glfwChooseFBConfig(const _GLFWfbconfig* desired,
-                                         const _GLFWfbconfig* alternatives,
-                                         unsigned int count);
+_GLFWfbconfigcache* _glfwAllocFBConfigCache(int count);
+void _glfwFreeFBConfigCache(_GLFWfbconfigcache* cache);
+GLFWbool _glfwFindFBConfigChoice(const _GLFWfbconfigcache* cache,
+                                 const _GLFWfbconfig* desired,
+                                 int key,
+                                 uintptr_t* handle);
+void _glfwAddFBConfigChoice(_GLFWfbconfigcache* cache,
+                            const _GLFWfbconfig* desired,
+                            int key,
+                            uintptr_t handle);
 GLFWbool _glfwRefreshContextAttribs(_GLFWwindow* window,
                                     const _GLFWctxconfig* ctxconfig);
 GLFWbool _glfwIsValidContextConfig(const _GLFWctxconfig* ctxconfig);
+void _glfwReleaseProcTable(_GLFWwindow* window);
 
 const GLFWvidmode* _glfwChooseVideoMode(_GLFWmonitor* monitor,
                                         const GLFWvidmode* desired);
@@ -977,9 +1238,9 @@ _GLFWmonitor* _glfwAllocMonitor(const char* name, int widthMM, int heightMM);
 void _glfwFreeMonitor(_GLFWmonitor* monitor);
 void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size);
 void _glfwFreeGammaArrays(GLFWgammaramp* ramp);
+void _glfwTerminateGammaTransitions(void);
 void _glfwSplitBPP(int bpp, int* red, int* green, int* blue);
 
-void _glfwInitGamepadMappings(void);
 _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   const char* guid,
                                   int axisCount,
@@ -987,6 +1248,15 @@ _GLFWjoystick* _glfwAllocJoystick(const char* name,
                                   int hatCount);
 void _glfwFreeJoystick(_GLFWjoystick* js);
 void _glfwCenterCursorInContentArea(_GLFWwindow* window);
+void _glfwDestroyCursor(_GLFWcursor* cursor);
+GLFWbool _glfwStartCursorPreload(void (*function)(void*));
+void _glfwFinishCursorPreload(void);
+
+double _glfwGetClipboardRequestTimeout(void);
+void _glfwUpdateClipboardRequests(void);
+void _glfwCancelClipboardRequest(_GLFWwindow* window);
+GLFWbool _glfwClipboardDataOffered(const char* type);
+void _glfwFreeClipboardData(void);
 
 GLFWbool _glfwInitEGL(void);
 void _glfwTerminateEGL(void);
@@ -1011,7 +1281,7 @@ void _glfwTerminateVulkan(void);
 const char* _glfwGetVulkanResultString(VkResult result);
 
 size_t _glfwEncodeUTF8(char* s, uint32_t codepoint);
-char** _glfwParseUriList(char* text, int* count);
+char** _glfwParseUriList(const char** text, int maxCount, int* count);
 
 char* _glfw_strdup(const char* source);
 int _glfw_min(int a, int b);
@@ -32,6 +32,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/inotify.h>
+#include <sys/epoll.h>
 #include <fcntl.h>
 #include <errno.h>
 #include <dirent.h>
@@ -163,6 +164,20 @@ static GLFWbool openJoystickDevice(const char* path)
         return GLFW_FALSE;
     }
 
+    if (_glfw.linjs.epoll > 0)
+    {
+        struct epoll_event event = { .events = EPOLLIN, .data.fd = linjs.fd };
+
+        if (epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_ADD, linjs.fd, &event) < 0)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Linux: Failed to watch input device: %s",
+                            strerror(errno));
+            close(linjs.fd);
+            return GLFW_FALSE;
+        }
+    }
+
     char name[256] = "";
 
     if (ioctl(linjs.fd, EVIOCGNAME(sizeof(name)), name) < 0)
@@ -246,6 +261,10 @@ static GLFWbool openJoystickDevice(const char* path)
 static void closeJoystick(_GLFWjoystick* js)
 {
     _glfwInputJoystick(js, GLFW_DISCONNECTED);
+
+    if (_glfw.linjs.epoll > 0)
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_DEL, js->linjs.fd, NULL);
+
     close(js->linjs.fd);
     _glfwFreeJoystick(js);
 }
@@ -259,6 +278,62 @@ static int compareJoysticks(const void* fp, const void* sp)
     return strcmp(fj->linjs.path, sj->linjs.path);
 }
 
+// Apply an input event to the specified joystick
+//
+static void handleEvent(_GLFWjoystick* js, const struct input_event* e)
+{
+    if (e->type == EV_SYN)
+    {
+        if (e->code == SYN_DROPPED)
+            js->linjs.dropped = GLFW_TRUE;
+        else if (e->code == SYN_REPORT && js->linjs.dropped)
+        {
+            // The events since the last report were lost, so the axis state
+            // is queried from the device instead
+            js->linjs.dropped = GLFW_FALSE;
+            pollAbsState(js);
+        }
+    }
+
+    if (js->linjs.dropped)
+        return;
+
+    if (e->type == EV_KEY)
+        handleKeyEvent(js, e->code, e->value);
+    else if (e->type == EV_ABS)
+        handleAbsEvent(js, e->code, e->value);
+}
+
+// Read and apply all queued events of the specified joystick (non-blocking)
+//
+static void readJoystickEvents(_GLFWjoystick* js)
+{
+    struct input_event events[64];
+    const size_t capacity = sizeof(events) / sizeof(events[0]);
+
+    for (;;)
+    {
+        const ssize_t size = read(js->linjs.fd, events, sizeof(events));
+        if (size < 0)
+        {
+            // Reset the joystick slot if the device was disconnected
+            if (errno == ENODEV)
+                closeJoystick(js);
+
+            return;
+        }
+
+        const size_t count = (size_t) size / sizeof(events[0]);
+
+        for (size_t i = 0;  i < count;  i++)
+            handleEvent(js, events + i);
+
+        // A partial read means the queue has been emptied
+        if (count < capacity)
+            return;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -302,6 +377,48 @@ void _glfwDetectJoystickConnectionLinux(void)
     }
 }
 
+// Process device connection changes and read the queued events of every
+// joystick with pending input, all with a single wait
+//
+void _glfwPollJoysticksLinux(void)
+{
+    if (_glfw.linjs.epoll <= 0)
+    {
+        _glfwDetectJoystickConnectionLinux();
+        return;
+    }
+
+    struct epoll_event events[GLFW_JOYSTICK_LAST + 2];
+    const int count = epoll_wait(_glfw.linjs.epoll,
+                                 events,
+                                 sizeof(events) / sizeof(events[0]),
+                                 0);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const int fd = events[i].data.fd;
+
+        if (fd == _glfw.linjs.inotify)
+        {
+            _glfwDetectJoystickConnectionLinux();
+            continue;
+        }
+
+        // Earlier events of this batch may have closed or replaced the
+        // joystick, so it is looked up by descriptor
+        for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+        {
+            _GLFWjoystick* js = _glfw.joysticks + jid;
+
+            if (js->connected && js->linjs.fd == fd)
+            {
+                readJoystickEvents(js);
+                break;
+            }
+        }
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -324,6 +441,15 @@ GLFWbool _glfwInitJoysticksLinux(void)
 
     // Continue without device connection notifications if inotify fails
 
+    _glfw.linjs.epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (_glfw.linjs.epoll > 0 && _glfw.linjs.inotify > 0)
+    {
+        struct epoll_event event = { .events = EPOLLIN, .data.fd = _glfw.linjs.inotify };
+        epoll_ctl(_glfw.linjs.epoll, EPOLL_CTL_ADD, _glfw.linjs.inotify, &event);
+    }
+
+    // Continue reading each joystick separately if epoll fails
+
     _glfw.linjs.regexCompiled = (regcomp(&_glfw.linjs.regex, "^event[0-9]\\+$", 0) == 0);
     if (!_glfw.linjs.regexCompiled)
     {
@@ -379,47 +505,17 @@ void _glfwTerminateJoysticksLinux(void)
         close(_glfw.linjs.inotify);
     }
 
+    if (_glfw.linjs.epoll > 0)
+        close(_glfw.linjs.epoll);
+
     if (_glfw.linjs.regexCompiled)
         regfree(&_glfw.linjs.regex);
 }
 
 GLFWbool _glfwPollJoystickLinux(_GLFWjoystick* js, int mode)
 {
-    // Read all queued events (non-blocking)
-    for (;;)
-    {
-        struct input_event e;
-
-        errno = 0;
-        if (read(js->linjs.fd, &e, sizeof(e)) < 0)
-        {
-            // Reset the joystick slot if the device was disconnected
-            if (errno == ENODEV)
-                closeJoystick(js);
-
-            break;
-        }
-
-        if (e.type == EV_SYN)
-        {
-            if (e.code == SYN_DROPPED)
-                _glfw.linjs.dropped = GLFW_TRUE;
-            else if (e.code == SYN_REPORT)
-            {
-                _glfw.linjs.dropped = GLFW_FALSE;
-                pollAbsState(js);
-            }
-        }
-
-        if (_glfw.linjs.dropped)
-            continue;
-
-        if (e.type == EV_KEY)
-            handleKeyEvent(js, e.code, e.value);
-        else if (e.type == EV_ABS)
-            handleAbsEvent(js, e.code, e.value);
-    }
-
+    // Other devices and connection changes are left to event processing
+    readJoystickEvents(js);
     return js->connected;
 }
 
@@ -41,6 +41,7 @@ typedef struct _GLFWjoystickLinux
     int                     absMap[ABS_CNT];
     struct input_absinfo    absInfo[ABS_CNT];
     int                     hats[4][2];
+    GLFWbool                dropped;
 } _GLFWjoystickLinux;
 
 // Linux-specific joystick API data
@@ -49,12 +50,13 @@ typedef struct _GLFWlibraryLinux
 {
     int                     inotify;
     int                     watch;
+    int                     epoll;
     regex_t                 regex;
     GLFWbool                regexCompiled;
-    GLFWbool                dropped;
 } _GLFWlibraryLinux;
 
 void _glfwDetectJoystickConnectionLinux(void);
+void _glfwPollJoysticksLinux(void);
 
 GLFWbool _glfwInitJoysticksLinux(void);
 void _glfwTerminateJoysticksLinux(void);
@@ -34,6 +34,13 @@
 #include <stdlib.h>
 #include <limits.h>
 
+// SSE2 is part of the baseline of x86-64 and is used whenever the compiler
+// targets it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define _GLFW_GAMMA_SSE2
+ #include <emmintrin.h>
+#endif
+
 
 // Lexically compare video modes, used by qsort
 //
@@ -86,6 +93,426 @@ static GLFWbool refreshVideoModes(_GLFWmonitor* monitor)
 }
 
 
+// Calculates a single gamma ramp value the way glfwSetGamma always has
+//
+static unsigned short calculateGammaValue(unsigned int index,
+                                          unsigned int size,
+                                          float exponent)
+{
+    float value;
+
+    // Calculate intensity
+    value = index / (float) (size - 1);
+    // Apply gamma curve
+    value = powf(value, exponent) * 65535.f + 0.5f;
+    // Clamp to value range
+    value = fminf(value, 65535.f);
+
+    return (unsigned short) value;
+}
+
+#if defined(_GLFW_GAMMA_SSE2)
+
+// Raises two to the specified powers, which must be in the range [-126, 0]
+//
+static __m128 exp2SSE2(__m128 x)
+{
+    // Split the power into an integer and a fraction in [-0.5, 0.5]
+    const __m128i n = _mm_cvtps_epi32(x);
+    const __m128 f = _mm_sub_ps(x, _mm_cvtepi32_ps(n));
+
+    // The Taylor series of 2^f is accurate to the precision of a float over
+    // this range
+    __m128 p = _mm_set1_ps(1.540353e-4f);
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(1.333356e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(9.618129e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(5.550411e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(2.402265e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(6.931472e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(1.f));
+
+    // Scale by 2^n by building the exponent of a float directly
+    const __m128i bits = _mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(p, _mm_castsi128_ps(bits));
+}
+
+// Calculates four gamma ramp values at a time from the logarithms of their
+// intensities
+//
+static void calculateGammaValuesSSE2(unsigned short* values,
+                                     const float* log2,
+                                     unsigned int count,
+                                     float exponent)
+{
+    const __m128 e = _mm_set1_ps(exponent);
+    const __m128 lowest = _mm_set1_ps(-126.f);
+    const __m128 scale = _mm_set1_ps(65535.f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i bias = _mm_set1_epi32(32768);
+    const __m128i sign = _mm_set1_epi16((short) 0x8000);
+
+    for (unsigned int i = 0;  i + 4 <= count;  i += 4)
+    {
+        // Powers below the lowest yield values that round to zero anyway
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(log2 + i), e);
+        x = _mm_min_ps(_mm_max_ps(x, lowest), _mm_setzero_ps());
+
+        __m128 value = _mm_add_ps(_mm_mul_ps(exp2SSE2(x), scale), half);
+        value = _mm_min_ps(value, scale);
+
+        // SSE2 can only pack with signed saturation, so shift the values into
+        // the signed range and back
+        __m128i packed = _mm_sub_epi32(_mm_cvttps_epi32(value), bias);
+        packed = _mm_xor_si128(_mm_packs_epi32(packed, packed), sign);
+        _mm_storel_epi64((__m128i*) (values + i), packed);
+    }
+}
+
+#endif // _GLFW_GAMMA_SSE2
+
+// Returns a gamma ramp of the specified size and exponent, shared by all red,
+// green and blue channels
+//
+// The ramp is remembered until one with a different size or exponent is
+// requested, so setting the same gamma on several monitors generates it once
+// Returns NULL if the arrays could not be allocated
+//
+static const unsigned short* generateGammaRamp(unsigned int size, float exponent)
+{
+    unsigned int i;
+
+    if (_glfw.gamma.size != size)
+    {
+        _glfw_free(_glfw.gamma.log2);
+        _glfw_free(_glfw.gamma.values);
+
+        // The intensities and their logarithms only depend on the ramp size
+        _glfw.gamma.log2 = _glfw_calloc(size, sizeof(float));
+        _glfw.gamma.values = _glfw_calloc(size, sizeof(unsigned short));
+        if (!_glfw.gamma.log2 || !_glfw.gamma.values)
+        {
+            _glfw_free(_glfw.gamma.log2);
+            _glfw_free(_glfw.gamma.values);
+            memset(&_glfw.gamma, 0, sizeof(_glfw.gamma));
+            return NULL;
+        }
+
+        _glfw.gamma.size = size;
+
+        for (i = 1;  i < size;  i++)
+            _glfw.gamma.log2[i] = log2f(i / (float) (size - 1));
+    }
+    else if (_glfw.gamma.exponent == exponent)
+        return _glfw.gamma.values;
+
+    _glfw.gamma.exponent = exponent;
+
+    // The first value is zero intensity, which has no logarithm
+    i = 1;
+    _glfw.gamma.values[0] = calculateGammaValue(0, size, exponent);
+
+#if defined(_GLFW_GAMMA_SSE2)
+    // An infinite exponent would turn the logarithm of full intensity into NaN
+    if (size > 1 && exponent <= FLT_MAX)
+    {
+        calculateGammaValuesSSE2(_glfw.gamma.values + 1,
+                                 _glfw.gamma.log2 + 1,
+                                 size - 1,
+                                 exponent);
+        i += (size - 1) & ~3u;
+    }
+#endif
+
+    for (;  i < size;  i++)
+        _glfw.gamma.values[i] = calculateGammaValue(i, size, exponent);
+
+    return _glfw.gamma.values;
+}
+
+// Returns whether the specified gamma ramps have identical values
+//
+static GLFWbool compareGammaRamps(const GLFWgammaramp* first,
+                                  const GLFWgammaramp* second)
+{
+    const size_t size = first->size * sizeof(unsigned short);
+
+    return first->size == second->size &&
+           memcmp(first->red, second->red, size) == 0 &&
+           memcmp(first->green, second->green, size) == 0 &&
+           memcmp(first->blue, second->blue, size) == 0;
+}
+
+// Copies the values of a gamma ramp, reusing the arrays of the destination if
+// they have the right size
+//
+static void copyGammaRamp(GLFWgammaramp* dst, const GLFWgammaramp* src)
+{
+    const size_t size = src->size * sizeof(unsigned short);
+
+    if (dst == src)
+        return;
+
+    _glfwAllocGammaArrays(dst, src->size);
+    memcpy(dst->red, src->red, size);
+    memcpy(dst->green, src->green, size);
+    memcpy(dst->blue, src->blue, size);
+}
+
+static void freeGammaTransition(_GLFWgammatransition* transition)
+{
+    _glfwFreeGammaArrays(&transition->start);
+    _glfwFreeGammaArrays(&transition->target);
+    _glfwFreeGammaArrays(&transition->ramp);
+    _glfw_free(transition);
+}
+
+// Interpolates the ramp of a transition between its start and target ramps
+//
+static void interpolateGammaRamp(_GLFWgammatransition* transition, float progress)
+{
+    const GLFWgammaramp* start = &transition->start;
+    const GLFWgammaramp* target = &transition->target;
+    GLFWgammaramp* ramp = &transition->ramp;
+
+#define INTERPOLATE(channel, i) \
+    (unsigned short) (start->channel[i] + \
+                      (target->channel[i] - start->channel[i]) * progress + 0.5f)
+
+    for (unsigned int i = 0;  i < ramp->size;  i++)
+    {
+        ramp->red[i] = INTERPOLATE(red, i);
+        ramp->green[i] = INTERPOLATE(green, i);
+        ramp->blue[i] = INTERPOLATE(blue, i);
+    }
+
+#undef INTERPOLATE
+}
+
+// Steps every gamma transition in progress until told to quit, waiting for new
+// transitions when there are none
+//
+static void gammaTransitionThread(void* argument)
+{
+    _glfwPlatformLockMutex(&_glfw.gammaTransitions.lock);
+
+    while (!_glfw.gammaTransitions.quit)
+    {
+        if (!_glfw.gammaTransitions.head)
+        {
+            _glfwPlatformWaitCond(&_glfw.gammaTransitions.cond,
+                                  &_glfw.gammaTransitions.lock,
+                                  NULL);
+            continue;
+        }
+
+        const uint64_t now = _glfwPlatformGetTimerValue();
+        uint64_t interval = UINT64_MAX;
+        GLFWbool completed = GLFW_FALSE;
+        _GLFWgammatransition** prev = &_glfw.gammaTransitions.head;
+
+        while (*prev)
+        {
+            _GLFWgammatransition* transition = *prev;
+            const uint64_t elapsed = now - transition->startTime;
+
+            if (elapsed < transition->duration)
+            {
+                interpolateGammaRamp(transition,
+                                     (float) ((double) elapsed / transition->duration));
+                _glfw.platform.setGammaRamp(transition->monitor, &transition->ramp);
+
+                if (transition->interval < interval)
+                    interval = transition->interval;
+
+                prev = &transition->next;
+            }
+            else
+            {
+                _glfw.platform.setGammaRamp(transition->monitor, &transition->target);
+
+                *prev = transition->next;
+                transition->monitor->transition = NULL;
+                freeGammaTransition(transition);
+                completed = GLFW_TRUE;
+            }
+        }
+
+        // The ramps of every monitor are sent together once per step, as the
+        // main thread may be waiting for events and not sending any requests
+        _glfw.platform.flushGammaRamps();
+
+        // Wake up the main thread so the application can see that a monitor
+        // has reached its target ramp
+        if (completed)
+            _glfw.platform.postEmptyEvent();
+
+        if (_glfw.gammaTransitions.head)
+        {
+            double timeout = (double) interval / _glfwPlatformGetTimerFrequency();
+            _glfwPlatformWaitCond(&_glfw.gammaTransitions.cond,
+                                  &_glfw.gammaTransitions.lock,
+                                  &timeout);
+        }
+    }
+
+    _glfwPlatformUnlockMutex(&_glfw.gammaTransitions.lock);
+}
+
+// Starts the gamma transition thread, unless it is already running
+//
+static GLFWbool startGammaTransitionThread(void)
+{
+    if (_glfw.gammaTransitions.running)
+        return GLFW_TRUE;
+
+    if (!_glfwPlatformCreateMutex(&_glfw.gammaTransitions.lock))
+        return GLFW_FALSE;
+
+    if (!_glfwPlatformCreateCond(&_glfw.gammaTransitions.cond))
+    {
+        _glfwPlatformDestroyMutex(&_glfw.gammaTransitions.lock);
+        return GLFW_FALSE;
+    }
+
+    if (!_glfwPlatformCreateThread(&_glfw.gammaTransitions.thread,
+                                   gammaTransitionThread,
+                                   NULL))
+    {
+        _glfwPlatformDestroyCond(&_glfw.gammaTransitions.cond);
+        _glfwPlatformDestroyMutex(&_glfw.gammaTransitions.lock);
+        return GLFW_FALSE;
+    }
+
+    _glfw.gammaTransitions.running = GLFW_TRUE;
+    return GLFW_TRUE;
+}
+
+// Stops the gamma transition of the specified monitor, if any, leaving the
+// ramp it last set as the current ramp of the monitor
+//
+static void cancelGammaTransition(_GLFWmonitor* monitor)
+{
+    _GLFWgammatransition* transition;
+
+    if (!_glfw.gammaTransitions.running)
+        return;
+
+    _glfwPlatformLockMutex(&_glfw.gammaTransitions.lock);
+
+    transition = monitor->transition;
+    if (transition)
+    {
+        _GLFWgammatransition** prev = &_glfw.gammaTransitions.head;
+
+        while (*prev != transition)
+            prev = &((*prev)->next);
+
+        *prev = transition->next;
+        monitor->transition = NULL;
+    }
+
+    _glfwPlatformUnlockMutex(&_glfw.gammaTransitions.lock);
+
+    if (transition)
+    {
+        copyGammaRamp(&monitor->currentRamp, &transition->ramp);
+        monitor->cached |= _GLFW_MONITOR_GAMMA;
+        freeGammaTransition(transition);
+    }
+}
+
+// Makes the target ramp of the gamma transition of the specified monitor its
+// current ramp, returning whether there was a transition in progress
+//
+static GLFWbool getGammaTransitionTarget(_GLFWmonitor* monitor)
+{
+    GLFWbool found = GLFW_FALSE;
+
+    if (!_glfw.gammaTransitions.running)
+        return GLFW_FALSE;
+
+    _glfwPlatformLockMutex(&_glfw.gammaTransitions.lock);
+
+    if (monitor->transition)
+    {
+        copyGammaRamp(&monitor->currentRamp, &monitor->transition->target);
+        monitor->cached |= _GLFW_MONITOR_GAMMA;
+        found = GLFW_TRUE;
+    }
+
+    _glfwPlatformUnlockMutex(&_glfw.gammaTransitions.lock);
+    return found;
+}
+
+// Sets the gamma ramp of the specified monitor unless it is already current,
+// stopping any gamma transition of that monitor
+//
+static void setGammaRamp(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
+{
+    cancelGammaTransition(monitor);
+
+    if (!monitor->originalRamp.size)
+    {
+        if (!_glfw.platform.getGammaRamp(monitor, &monitor->originalRamp))
+            return;
+    }
+
+    if ((monitor->cached & _GLFW_MONITOR_GAMMA) &&
+        compareGammaRamps(&monitor->currentRamp, ramp))
+    {
+        return;
+    }
+
+    // The remembered ramp stays current if the platform rejected this one
+    if (!_glfw.platform.setGammaRamp(monitor, ramp))
+        return;
+
+    // NOTE: Platforms that require a specific ramp size reject other sizes, so
+    //       only ramps of the original size are known to have been set
+    if (ramp->size == monitor->originalRamp.size)
+    {
+        if (ramp != &monitor->currentRamp)
+            copyGammaRamp(&monitor->currentRamp, ramp);
+
+        monitor->cached |= _GLFW_MONITOR_GAMMA;
+    }
+    else
+        monitor->cached &= ~_GLFW_MONITOR_GAMMA;
+}
+
+// Generates a gamma ramp of the right size and sets it for the monitor
+//
+static void setGamma(_GLFWmonitor* monitor, float gamma)
+{
+    GLFWgammaramp ramp;
+
+    if (!monitor->originalRamp.size)
+    {
+        if (!_glfw.platform.getGammaRamp(monitor, &monitor->originalRamp))
+            return;
+    }
+
+    // NOTE: Some CRTCs report no gamma support with a ramp size of zero
+    if (monitor->originalRamp.size == 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid gamma ramp size 0");
+        return;
+    }
+
+    unsigned short* values = (unsigned short*)
+        generateGammaRamp(monitor->originalRamp.size, 1.f / gamma);
+    if (!values)
+        return;
+
+    ramp.red = values;
+    ramp.green = values;
+    ramp.blue = values;
+    ramp.size = monitor->originalRamp.size;
+
+    setGammaRamp(monitor, &ramp);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -161,6 +588,20 @@ void _glfwInputMonitorWindow(_GLFWmonitor* monitor, _GLFWwindow* window)
     monitor->window = window;
 }
 
+// Notifies shared code that the video mode, position, work area or content
+// scale of a monitor may have changed, or of every monitor if it is NULL
+//
+void _glfwInputMonitorChange(_GLFWmonitor* monitor)
+{
+    if (monitor)
+        monitor->cached = 0;
+    else
+    {
+        for (int i = 0;  i < _glfw.monitorCount;  i++)
+            _glfw.monitors[i]->cached = 0;
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -186,6 +627,8 @@ void _glfwFreeMonitor(_GLFWmonitor* monitor)
     if (monitor == NULL)
         return;
 
+    cancelGammaTransition(monitor);
+
     _glfw.platform.freeMonitor(monitor);
 
     _glfwFreeGammaArrays(&monitor->originalRamp);
@@ -195,10 +638,44 @@ void _glfwFreeMonitor(_GLFWmonitor* monitor)
     _glfw_free(monitor);
 }
 
-// Allocates red, green and blue value arrays of the specified size
+// Stops the gamma transition thread and discards any transitions in progress
+//
+void _glfwTerminateGammaTransitions(void)
+{
+    if (!_glfw.gammaTransitions.running)
+        return;
+
+    _glfwPlatformLockMutex(&_glfw.gammaTransitions.lock);
+    _glfw.gammaTransitions.quit = GLFW_TRUE;
+    _glfwPlatformSignalCond(&_glfw.gammaTransitions.cond);
+    _glfwPlatformUnlockMutex(&_glfw.gammaTransitions.lock);
+
+    _glfwPlatformJoinThread(&_glfw.gammaTransitions.thread);
+
+    while (_glfw.gammaTransitions.head)
+    {
+        _GLFWgammatransition* transition = _glfw.gammaTransitions.head;
+        _glfw.gammaTransitions.head = transition->next;
+        transition->monitor->transition = NULL;
+        freeGammaTransition(transition);
+    }
+
+    _glfwPlatformDestroyCond(&_glfw.gammaTransitions.cond);
+    _glfwPlatformDestroyMutex(&_glfw.gammaTransitions.lock);
+    memset(&_glfw.gammaTransitions, 0, sizeof(_glfw.gammaTransitions));
+}
+
+// Allocates red, green and blue value arrays of the specified size, replacing
+// any arrays of a different size
 //
 void _glfwAllocGammaArrays(GLFWgammaramp* ramp, unsigned int size)
 {
+    // Reuse the existing arrays if they already have the right size
+    if (ramp->red && ramp->size == size)
+        return;
+
+    _glfwFreeGammaArrays(ramp);
+
     ramp->red = _glfw_calloc(size, sizeof(unsigned short));
     ramp->green = _glfw_calloc(size, sizeof(unsigned short));
     ramp->blue = _glfw_calloc(size, sizeof(unsigned short));
@@ -335,7 +812,16 @@ GLFWAPI void glfwGetMonitorPos(GLFWmonitor* handle, int* xpos, int* ypos)
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     assert(monitor != NULL);
 
-    _glfw.platform.getMonitorPos(monitor, xpos, ypos);
+    if (!(monitor->cached & _GLFW_MONITOR_POS))
+    {
+        _glfw.platform.getMonitorPos(monitor, &monitor->xpos, &monitor->ypos);
+        monitor->cached |= _GLFW_MONITOR_POS;
+    }
+
+    if (xpos)
+        *xpos = monitor->xpos;
+    if (ypos)
+        *ypos = monitor->ypos;
 }
 
 GLFWAPI void glfwGetMonitorWorkarea(GLFWmonitor* handle,
@@ -356,7 +842,24 @@ GLFWAPI void glfwGetMonitorWorkarea(GLFWmonitor* handle,
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     assert(monitor != NULL);
 
-    _glfw.platform.getMonitorWorkarea(monitor, xpos, ypos, width, height);
+    if (!(monitor->cached & _GLFW_MONITOR_WORKAREA))
+    {
+        _glfw.platform.getMonitorWorkarea(monitor,
+                                          &monitor->workareaX,
+                                          &monitor->workareaY,
+                                          &monitor->workareaWidth,
+                                          &monitor->workareaHeight);
+        monitor->cached |= _GLFW_MONITOR_WORKAREA;
+    }
+
+    if (xpos)
+        *xpos = monitor->workareaX;
+    if (ypos)
+        *ypos = monitor->workareaY;
+    if (width)
+        *width = monitor->workareaWidth;
+    if (height)
+        *height = monitor->workareaHeight;
 }
 
 GLFWAPI void glfwGetMonitorPhysicalSize(GLFWmonitor* handle, int* widthMM, int* heightMM)
@@ -390,7 +893,18 @@ GLFWAPI void glfwGetMonitorContentScale(GLFWmonitor* handle,
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     assert(monitor != NULL);
 
-    _glfw.platform.getMonitorContentScale(monitor, xscale, yscale);
+    if (!(monitor->cached & _GLFW_MONITOR_SCALE))
+    {
+        _glfw.platform.getMonitorContentScale(monitor,
+                                              &monitor->xscale,
+                                              &monitor->yscale);
+        monitor->cached |= _GLFW_MONITOR_SCALE;
+    }
+
+    if (xscale)
+        *xscale = monitor->xscale;
+    if (yscale)
+        *yscale = monitor->yscale;
 }
 
 GLFWAPI const char* glfwGetMonitorName(GLFWmonitor* handle)
@@ -455,24 +969,26 @@ GLFWAPI const GLFWvidmode* glfwGetVideoMode(GLFWmonitor* handle)
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     assert(monitor != NULL);
 
-    if (!_glfw.platform.getVideoMode(monitor, &monitor->currentMode))
-        return NULL;
+    if (!(monitor->cached & _GLFW_MONITOR_MODE))
+    {
+        if (!_glfw.platform.getVideoMode(monitor, &monitor->currentMode))
+            return NULL;
+
+        monitor->cached |= _GLFW_MONITOR_MODE;
+    }
 
     return &monitor->currentMode;
 }
 
 GLFWAPI void glfwSetGamma(GLFWmonitor* handle, float gamma)
 {
-    unsigned int i;
-    unsigned short* values;
-    GLFWgammaramp ramp;
-    const GLFWgammaramp* original;
     assert(gamma > 0.f);
     assert(gamma <= FLT_MAX);
 
     _GLFW_REQUIRE_INIT();
 
-    assert(handle != NULL);
+    _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    assert(monitor != NULL);
 
     if (gamma != gamma || gamma <= 0.f || gamma > FLT_MAX)
     {
@@ -480,33 +996,39 @@ GLFWAPI void glfwSetGamma(GLFWmonitor* handle, float gamma)
         return;
     }
 
-    original = glfwGetGammaRamp(handle);
-    if (!original)
-        return;
+    setGamma(monitor, gamma);
+}
 
-    values = _glfw_calloc(original->size, sizeof(unsigned short));
+GLFWAPI void glfwSetMonitorsGamma(GLFWmonitor* const* handles, int count, float gamma)
+{
+    assert(count >= 0);
+    assert(count == 0 || handles != NULL);
+    assert(gamma > 0.f);
+    assert(gamma <= FLT_MAX);
 
-    for (i = 0;  i < original->size;  i++)
-    {
-        float value;
+    _GLFW_REQUIRE_INIT();
 
-        // Calculate intensity
-        value = i / (float) (original->size - 1);
-        // Apply gamma curve
-        value = powf(value, 1.f / gamma) * 65535.f + 0.5f;
-        // Clamp to value range
-        value = fminf(value, 65535.f);
+    if (count < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid monitor count %i", count);
+        return;
+    }
 
-        values[i] = (unsigned short) value;
+    if (gamma != gamma || gamma <= 0.f || gamma > FLT_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid gamma value %f", gamma);
+        return;
     }
 
-    ramp.red = values;
-    ramp.green = values;
-    ramp.blue = values;
-    ramp.size = original->size;
+    for (int i = 0;  i < count;  i++)
+    {
+        _GLFWmonitor* monitor = (_GLFWmonitor*) handles[i];
+        assert(monitor != NULL);
 
-    glfwSetGammaRamp(handle, &ramp);
-    _glfw_free(values);
+        setGamma(monitor, gamma);
+    }
+
+    _glfw.platform.flushGammaRamps();
 }
 
 GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* handle)
@@ -516,9 +1038,17 @@ GLFWAPI const GLFWgammaramp* glfwGetGammaRamp(GLFWmonitor* handle)
     _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
     assert(monitor != NULL);
 
-    _glfwFreeGammaArrays(&monitor->currentRamp);
-    if (!_glfw.platform.getGammaRamp(monitor, &monitor->currentRamp))
-        return NULL;
+    if (!(monitor->cached & _GLFW_MONITOR_GAMMA))
+    {
+        // The transition thread may be setting the ramp of this monitor
+        if (!getGammaTransitionTarget(monitor))
+        {
+            if (!_glfw.platform.getGammaRamp(monitor, &monitor->currentRamp))
+                return NULL;
+
+            monitor->cached |= _GLFW_MONITOR_GAMMA;
+        }
+    }
 
     return &monitor->currentRamp;
 }
@@ -544,12 +1074,120 @@ GLFWAPI void glfwSetGammaRamp(GLFWmonitor* handle, const GLFWgammaramp* ramp)
         return;
     }
 
+    setGammaRamp(monitor, ramp);
+}
+
+GLFWAPI void glfwStartGammaTransition(GLFWmonitor* handle,
+                                      const GLFWgammaramp* ramp,
+                                      double duration)
+{
+    assert(ramp != NULL);
+    assert(ramp->size > 0);
+    assert(ramp->red != NULL);
+    assert(ramp->green != NULL);
+    assert(ramp->blue != NULL);
+    assert(duration >= 0.0);
+    assert(duration <= DBL_MAX);
+
+    _GLFW_REQUIRE_INIT();
+
+    _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    assert(monitor != NULL);
+
+    if (ramp->size <= 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid gamma ramp size %i",
+                        ramp->size);
+        return;
+    }
+
+    if (duration != duration || duration < 0.0 || duration > DBL_MAX)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Invalid gamma transition duration %f",
+                        duration);
+        return;
+    }
+
+    // Continue from wherever an earlier transition got to
+    cancelGammaTransition(monitor);
+
     if (!monitor->originalRamp.size)
     {
         if (!_glfw.platform.getGammaRamp(monitor, &monitor->originalRamp))
             return;
     }
 
-    _glfw.platform.setGammaRamp(monitor, ramp);
+    const GLFWgammaramp* current = glfwGetGammaRamp(handle);
+    if (!current)
+        return;
+
+    if (current->size != ramp->size)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Gamma ramp size %i does not match current ramp size %i",
+                        ramp->size, current->size);
+        return;
+    }
+
+    const uint64_t frequency = _glfwPlatformGetTimerFrequency();
+    const uint64_t ticks = (uint64_t) (duration * frequency);
+    if (ticks == 0)
+    {
+        setGammaRamp(monitor, ramp);
+        return;
+    }
+
+    if (!startGammaTransitionThread())
+        return;
+
+    _GLFWgammatransition* transition = _glfw_calloc(1, sizeof(_GLFWgammatransition));
+    transition->monitor = monitor;
+    transition->startTime = _glfwPlatformGetTimerValue();
+    transition->duration = ticks;
+
+    // Step once per refresh of the monitor, as more often would not be seen
+    const GLFWvidmode* mode = glfwGetVideoMode(handle);
+    if (mode && mode->refreshRate > 0)
+        transition->interval = frequency / mode->refreshRate;
+    else
+        transition->interval = frequency / 60;
+
+    copyGammaRamp(&transition->start, current);
+    copyGammaRamp(&transition->target, ramp);
+    copyGammaRamp(&transition->ramp, current);
+
+    // The ramp being transitioned to is reported as the current one
+    copyGammaRamp(&monitor->currentRamp, ramp);
+    monitor->cached |= _GLFW_MONITOR_GAMMA;
+
+    _glfwPlatformLockMutex(&_glfw.gammaTransitions.lock);
+
+    transition->next = _glfw.gammaTransitions.head;
+    _glfw.gammaTransitions.head = transition;
+    monitor->transition = transition;
+    _glfwPlatformSignalCond(&_glfw.gammaTransitions.cond);
+
+    _glfwPlatformUnlockMutex(&_glfw.gammaTransitions.lock);
+}
+
+GLFWAPI int glfwGammaTransitionActive(GLFWmonitor* handle)
+{
+    int active = GLFW_FALSE;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    assert(monitor != NULL);
+
+    if (_glfw.gammaTransitions.running)
+    {
+        _glfwPlatformLockMutex(&_glfw.gammaTransitions.lock);
+        active = monitor->transition != NULL;
+        _glfwPlatformUnlockMutex(&_glfw.gammaTransitions.lock);
+    }
+
+    return active;
 }
 
@@ -90,10 +90,10 @@ static void swapIntervalNSGL(int interval)
     } // autoreleasepool
 }
 
-static int extensionSupportedNSGL(const char* extension)
+static const char* getExtensionStringNSGL(void)
 {
     // There are no NSGL extensions
-    return GLFW_FALSE;
+    return NULL;
 }
 
 static GLFWglproc getProcAddressNSGL(const char* procname)
@@ -345,7 +345,7 @@ GLFWbool _glfwCreateContextNSGL(_GLFWwindow* window,
     window->context.makeCurrent = makeContextCurrentNSGL;
     window->context.swapBuffers = swapBuffersNSGL;
     window->context.swapInterval = swapIntervalNSGL;
-    window->context.extensionSupported = extensionSupportedNSGL;
+    window->context.getExtensionString = getExtensionStringNSGL;
     window->context.getProcAddress = getProcAddressNSGL;
     window->context.destroy = destroyContextNSGL;
 
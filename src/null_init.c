@@ -55,6 +55,10 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeNull,
         .setClipboardString = _glfwSetClipboardStringNull,
         .getClipboardString = _glfwGetClipboardStringNull,
+        .requestClipboardString = _glfwRequestClipboardStringNull,
+        .cancelClipboardRequest = _glfwCancelClipboardRequestNull,
+        .setClipboardData = _glfwSetClipboardDataNull,
+        .getClipboardData = _glfwGetClipboardDataNull,
         .initJoysticks = _glfwInitJoysticksNull,
         .terminateJoysticks = _glfwTerminateJoysticksNull,
         .pollJoystick = _glfwPollJoystickNull,
@@ -68,6 +72,7 @@ GLFWbool _glfwConnectNull(int platformID, _GLFWplatform* platform)
         .getVideoMode = _glfwGetVideoModeNull,
         .getGammaRamp = _glfwGetGammaRampNull,
         .setGammaRamp = _glfwSetGammaRampNull,
+        .flushGammaRamps = _glfwFlushGammaRampsNull,
         .createWindow = _glfwCreateWindowNull,
         .destroyWindow = _glfwDestroyWindowNull,
         .setWindowTitle = _glfwSetWindowTitleNull,
@@ -251,12 +256,34 @@ int _glfwInitNull(void)
             _glfw.null.scancodes[_glfw.null.keycodes[scancode]] = scancode;
     }
 
+    _glfw.null.eventLock = _glfw_calloc(1, sizeof(_GLFWmutex));
+    _glfw.null.eventCond = _glfw_calloc(1, sizeof(_GLFWcond));
+
+    if (!_glfwPlatformCreateMutex(_glfw.null.eventLock) ||
+        !_glfwPlatformCreateCond(_glfw.null.eventCond))
+    {
+        return GLFW_FALSE;
+    }
+
     _glfwPollMonitorsNull();
     return GLFW_TRUE;
 }
 
 void _glfwTerminateNull(void)
 {
+    if (_glfw.null.eventCond)
+    {
+        _glfwPlatformDestroyCond(_glfw.null.eventCond);
+        _glfw_free(_glfw.null.eventCond);
+    }
+
+    if (_glfw.null.eventLock)
+    {
+        _glfwPlatformDestroyMutex(_glfw.null.eventLock);
+        _glfw_free(_glfw.null.eventLock);
+    }
+
+    _glfw_free(_glfw.null.injected.events);
     free(_glfw.null.clipboardString);
     _glfwTerminateOSMesa();
     _glfwTerminateEGL();
@@ -26,6 +26,9 @@
 
 #include "internal.h"
 
+#include <string.h>
+#include <assert.h>
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -38,11 +41,21 @@ GLFWbool _glfwInitJoysticksNull(void)
 
 void _glfwTerminateJoysticksNull(void)
 {
+    for (int jid = 0;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    {
+        _GLFWjoystick* js = _glfw.joysticks + jid;
+        if (js->connected)
+        {
+            _glfwInputJoystick(js, GLFW_DISCONNECTED);
+            _glfwFreeJoystick(js);
+        }
+    }
 }
 
 GLFWbool _glfwPollJoystickNull(_GLFWjoystick* js, int mode)
 {
-    return GLFW_FALSE;
+    // The state of injected joysticks is updated by glfwInjectNullJoystickState
+    return js->connected;
 }
 
 const char* _glfwGetMappingNameNull(void)
@@ -54,3 +67,163 @@ void _glfwUpdateGamepadGUIDNull(char* guid)
 {
 }
 
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW native API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI int glfwInjectNullJoystick(const char* name,
+                                   const char* guid,
+                                   int axisCount,
+                                   int buttonCount,
+                                   int hatCount)
+{
+    assert(name != NULL);
+    assert(guid != NULL);
+    assert(axisCount >= 0);
+    assert(buttonCount >= 0);
+    assert(hatCount >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(-1);
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "Null: Platform not initialized");
+        return -1;
+    }
+
+    if (strlen(guid) != 32 || strspn(guid, "0123456789abcdefABCDEF") != 32)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Null: Invalid joystick GUID %s", guid);
+        return -1;
+    }
+
+    if (axisCount < 0 || buttonCount < 0 || hatCount < 0)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE,
+                        "Null: Invalid joystick with %i axes, %i buttons and %i hats",
+                        axisCount, buttonCount, hatCount);
+        return -1;
+    }
+
+    _GLFWjoystick* js = _glfwAllocJoystick(name, guid,
+                                           axisCount, buttonCount, hatCount);
+    if (!js)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Null: No free joystick slot");
+        return -1;
+    }
+
+    if ((axisCount && !js->axes) ||
+        ((buttonCount || hatCount) && !js->buttons) ||
+        (hatCount && !js->hats))
+    {
+        _glfwFreeJoystick(js);
+        _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+        return -1;
+    }
+
+    _glfwInputJoystick(js, GLFW_CONNECTED);
+    return (int) (js - _glfw.joysticks);
+}
+
+GLFWAPI void glfwInjectNullJoystickState(int jid,
+                                         const float* axes,
+                                         const unsigned char* buttons,
+                                         const unsigned char* hats)
+{
+    assert(jid >= GLFW_JOYSTICK_1);
+    assert(jid <= GLFW_JOYSTICK_LAST);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "Null: Platform not initialized");
+        return;
+    }
+
+    if (jid < 0 || jid > GLFW_JOYSTICK_LAST || !_glfw.joysticks[jid].connected)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Null: Invalid joystick ID %i", jid);
+        return;
+    }
+
+    _GLFWjoystick* js = _glfw.joysticks + jid;
+
+    // Validate everything first so that no state is changed on failure
+    if (buttons)
+    {
+        for (int i = 0;  i < js->buttonCount;  i++)
+        {
+            if (buttons[i] != GLFW_PRESS && buttons[i] != GLFW_RELEASE)
+            {
+                _glfwInputError(GLFW_INVALID_ENUM,
+                                "Null: Invalid state %i of joystick button %i",
+                                buttons[i], i);
+                return;
+            }
+        }
+    }
+
+    if (hats)
+    {
+        for (int i = 0;  i < js->hatCount;  i++)
+        {
+            const int value = hats[i];
+
+            if ((value & 0xf0) ||
+                ((value & GLFW_HAT_LEFT) && (value & GLFW_HAT_RIGHT)) ||
+                ((value & GLFW_HAT_UP) && (value & GLFW_HAT_DOWN)))
+            {
+                _glfwInputError(GLFW_INVALID_ENUM,
+                                "Null: Invalid state %i of joystick hat %i",
+                                value, i);
+                return;
+            }
+        }
+    }
+
+    if (axes)
+    {
+        for (int i = 0;  i < js->axisCount;  i++)
+            _glfwInputJoystickAxis(js, i, axes[i]);
+    }
+
+    if (buttons)
+    {
+        for (int i = 0;  i < js->buttonCount;  i++)
+            _glfwInputJoystickButton(js, i, buttons[i]);
+    }
+
+    if (hats)
+    {
+        for (int i = 0;  i < js->hatCount;  i++)
+            _glfwInputJoystickHat(js, i, hats[i]);
+    }
+}
+
+GLFWAPI void glfwInjectNullJoystickDisconnect(int jid)
+{
+    assert(jid >= GLFW_JOYSTICK_1);
+    assert(jid <= GLFW_JOYSTICK_LAST);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "Null: Platform not initialized");
+        return;
+    }
+
+    if (jid < 0 || jid > GLFW_JOYSTICK_LAST || !_glfw.joysticks[jid].connected)
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Null: Invalid joystick ID %i", jid);
+        return;
+    }
+
+    _GLFWjoystick* js = _glfw.joysticks + jid;
+    _glfwInputJoystick(js, GLFW_DISCONNECTED);
+    _glfwFreeJoystick(js);
+}
+
@@ -30,6 +30,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <assert.h>
 
 // The the sole (fake) video mode of our (sole) fake monitor
 //
@@ -144,17 +145,46 @@ GLFWbool _glfwGetGammaRampNull(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     return GLFW_TRUE;
 }
 
-void _glfwSetGammaRampNull(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
+GLFWbool _glfwSetGammaRampNull(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     if (monitor->null.ramp.size != ramp->size)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Null: Gamma ramp size must match current ramp size");
-        return;
+        return GLFW_FALSE;
     }
 
     memcpy(monitor->null.ramp.red,   ramp->red,   sizeof(short) * ramp->size);
     memcpy(monitor->null.ramp.green, ramp->green, sizeof(short) * ramp->size);
     memcpy(monitor->null.ramp.blue,  ramp->blue,  sizeof(short) * ramp->size);
+    return GLFW_TRUE;
+}
+
+void _glfwFlushGammaRampsNull(void)
+{
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW native API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI const GLFWgammaramp* glfwGetNullGammaRamp(GLFWmonitor* handle)
+{
+    _GLFWmonitor* monitor = (_GLFWmonitor*) handle;
+    assert(monitor != NULL);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "Null: Platform not initialized");
+        return NULL;
+    }
+
+    if (!monitor->null.ramp.size)
+        return NULL;
+
+    return &monitor->null.ramp;
 }
 
@@ -199,9 +199,21 @@ typedef struct _GLFWlibraryNull
     int             xcursor;
     int             ycursor;
     char*           clipboardString;
+    GLFWbool        clipboardRequested;
     _GLFWwindow*    focusedWindow;
     uint16_t        keycodes[GLFW_NULL_SC_LAST + 1];
     uint8_t         scancodes[GLFW_KEY_LAST + 1];
+    // Guards eventPending, which may be set from any thread
+    _GLFWmutex*     eventLock;
+    _GLFWcond*      eventCond;
+    GLFWbool        eventPending;
+    // Injected events not yet delivered, see glfwInjectNullEvents
+    struct {
+        GLFWevent*  events;
+        int         head;
+        int         count;
+        int         capacity;
+    } injected;
 } _GLFWlibraryNull;
 
 void _glfwPollMonitorsNull(void);
@@ -217,7 +229,8 @@ void _glfwGetMonitorWorkareaNull(_GLFWmonitor* monitor, int* xpos, int* ypos, in
 GLFWvidmode* _glfwGetVideoModesNull(_GLFWmonitor* monitor, int* found);
 GLFWbool _glfwGetVideoModeNull(_GLFWmonitor* monitor, GLFWvidmode* mode);
 GLFWbool _glfwGetGammaRampNull(_GLFWmonitor* monitor, GLFWgammaramp* ramp);
-void _glfwSetGammaRampNull(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+GLFWbool _glfwSetGammaRampNull(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+void _glfwFlushGammaRampsNull(void);
 
 GLFWbool _glfwCreateWindowNull(_GLFWwindow* window, const _GLFWwndconfig* wndconfig, const _GLFWctxconfig* ctxconfig, const _GLFWfbconfig* fbconfig);
 void _glfwDestroyWindowNull(_GLFWwindow* window);
@@ -267,6 +280,10 @@ void _glfwDestroyCursorNull(_GLFWcursor* cursor);
 void _glfwSetCursorNull(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringNull(const char* string);
 const char* _glfwGetClipboardStringNull(void);
+void _glfwRequestClipboardStringNull(void);
+void _glfwCancelClipboardRequestNull(void);
+GLFWbool _glfwSetClipboardDataNull(void);
+const void* _glfwGetClipboardDataNull(const char* type, size_t* size);
 const char* _glfwGetScancodeNameNull(int scancode);
 int _glfwGetKeyScancodeNull(int key);
 
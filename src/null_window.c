@@ -29,6 +29,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <assert.h>
 
 static void applySizeLimits(_GLFWwindow* window, int* width, int* height)
 {
@@ -106,6 +107,180 @@ static int createNativeWindow(_GLFWwindow* window,
     return GLFW_TRUE;
 }
 
+// Returns the current time in seconds of the platform timer
+//
+static double getTimerSeconds(void)
+{
+    return (double) _glfwPlatformGetTimerValue() /
+        _glfwPlatformGetTimerFrequency();
+}
+
+// Returns whether the specified handle refers to an existing window
+//
+static GLFWbool isValidWindow(GLFWwindow* handle)
+{
+    for (_GLFWwindow* window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        if ((GLFWwindow*) window == handle)
+            return GLFW_TRUE;
+    }
+
+    return GLFW_FALSE;
+}
+
+// Removes any injected events for the specified window
+//
+static void removeInjectedEvents(_GLFWwindow* window)
+{
+    int i, count = _glfw.null.injected.head;
+
+    for (i = _glfw.null.injected.head;  i < _glfw.null.injected.count;  i++)
+    {
+        if (_glfw.null.injected.events[i].window != (GLFWwindow*) window)
+            _glfw.null.injected.events[count++] = _glfw.null.injected.events[i];
+    }
+
+    _glfw.null.injected.count = count;
+}
+
+// Passes an injected event to shared code as if it came from a window system
+//
+static void inputInjectedEvent(const GLFWevent* event)
+{
+    _GLFWwindow* window = (_GLFWwindow*) event->window;
+
+    switch (event->type)
+    {
+        case GLFW_EVENT_KEY:
+        {
+            int action = event->data.key.action;
+            if (action == GLFW_REPEAT)
+                action = GLFW_PRESS;
+
+            _glfwInputKey(window,
+                          event->data.key.key,
+                          event->data.key.scancode,
+                          action,
+                          event->data.key.mods);
+            break;
+        }
+
+        case GLFW_EVENT_CHAR:
+        {
+            const int mods = event->data.character.mods;
+            const int plain = !(mods & (GLFW_MOD_CONTROL | GLFW_MOD_ALT));
+            _glfwInputChar(window, event->data.character.codepoint, mods, plain);
+            break;
+        }
+
+        case GLFW_EVENT_MOUSE_BUTTON:
+            _glfwInputMouseClick(window,
+                                 event->data.button.button,
+                                 event->data.button.action,
+                                 event->data.button.mods);
+            break;
+
+        case GLFW_EVENT_CURSOR_POS:
+            _glfw.null.xcursor = window->null.xpos + (int) event->data.cursor.x;
+            _glfw.null.ycursor = window->null.ypos + (int) event->data.cursor.y;
+            _glfwInputCursorPos(window, event->data.cursor.x, event->data.cursor.y);
+            break;
+
+        case GLFW_EVENT_CURSOR_ENTER:
+            _glfwInputCursorEnter(window, event->data.state);
+            break;
+
+        case GLFW_EVENT_SCROLL:
+            _glfwInputScroll(window, event->data.scroll.x, event->data.scroll.y);
+            break;
+
+        case GLFW_EVENT_WINDOW_POS:
+            _glfwSetWindowPosNull(window, event->data.pos.x, event->data.pos.y);
+            break;
+
+        case GLFW_EVENT_WINDOW_SIZE:
+            _glfwSetWindowSizeNull(window,
+                                   event->data.size.width,
+                                   event->data.size.height);
+            break;
+
+        case GLFW_EVENT_WINDOW_CLOSE:
+            _glfwInputWindowCloseRequest(window);
+            break;
+
+        case GLFW_EVENT_WINDOW_FOCUS:
+        {
+            if (event->data.state)
+                _glfwFocusWindowNull(window);
+            else if (_glfw.null.focusedWindow == window)
+            {
+                _glfw.null.focusedWindow = NULL;
+                _glfwInputWindowFocus(window, GLFW_FALSE);
+            }
+
+            break;
+        }
+    }
+}
+
+// Passes all injected events that are due to shared code
+//
+static void processInjectedEvents(void)
+{
+    double time = 0.0;
+
+    while (_glfw.null.injected.head < _glfw.null.injected.count)
+    {
+        // The event is copied as the callbacks may inject or remove events
+        const GLFWevent event =
+            _glfw.null.injected.events[_glfw.null.injected.head];
+
+        if (event.time > 0.0)
+        {
+            if (time == 0.0)
+                time = getTimerSeconds();
+
+            if (event.time > time)
+                return;
+        }
+
+        _glfw.null.injected.head++;
+        inputInjectedEvent(&event);
+    }
+
+    _glfw.null.injected.head = 0;
+    _glfw.null.injected.count = 0;
+}
+
+// Waits until an empty event is posted, an injected event is due or the timeout
+// elapses
+//
+static void waitForEvent(double* timeout)
+{
+    if (_glfw.null.injected.head < _glfw.null.injected.count)
+    {
+        const GLFWevent* event =
+            _glfw.null.injected.events + _glfw.null.injected.head;
+        double delay = event->time - getTimerSeconds();
+
+        if (event->time == 0.0 || delay <= 0.0)
+            return;
+
+        if (!timeout || *timeout > delay)
+            timeout = &delay;
+    }
+
+    _glfwPlatformLockMutex(_glfw.null.eventLock);
+
+    while (!_glfw.null.eventPending)
+    {
+        if (!_glfwPlatformWaitCond(_glfw.null.eventCond, _glfw.null.eventLock, timeout))
+            break;
+    }
+
+    _glfwPlatformUnlockMutex(_glfw.null.eventLock);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
@@ -174,6 +349,8 @@ void _glfwDestroyWindowNull(_GLFWwindow* window)
     if (_glfw.null.focusedWindow == window)
         _glfw.null.focusedWindow = NULL;
 
+    removeInjectedEvents(window);
+
     if (window->context.destroy)
         window->context.destroy(window);
 }
@@ -487,18 +664,42 @@ GLFWbool _glfwWindowVisibleNull(_GLFWwindow* window)
 
 void _glfwPollEventsNull(void)
 {
+    _glfwPlatformLockMutex(_glfw.null.eventLock);
+    _glfw.null.eventPending = GLFW_FALSE;
+    _glfwPlatformUnlockMutex(_glfw.null.eventLock);
+
+    processInjectedEvents();
+
+    if (_glfw.null.clipboardRequested)
+    {
+        _glfw.null.clipboardRequested = GLFW_FALSE;
+        _glfwInputClipboardString(_glfw.null.clipboardString);
+    }
 }
 
 void _glfwWaitEventsNull(void)
 {
+    waitForEvent(NULL);
+    _glfwPollEventsNull();
 }
 
 void _glfwWaitEventsTimeoutNull(double timeout)
 {
+    waitForEvent(&timeout);
+    _glfwPollEventsNull();
 }
 
 void _glfwPostEmptyEventNull(void)
 {
+    _glfwPlatformLockMutex(_glfw.null.eventLock);
+
+    if (!_glfw.null.eventPending)
+    {
+        _glfw.null.eventPending = GLFW_TRUE;
+        _glfwPlatformSignalCond(_glfw.null.eventCond);
+    }
+
+    _glfwPlatformUnlockMutex(_glfw.null.eventLock);
 }
 
 void _glfwGetCursorPosNull(_GLFWwindow* window, double* xpos, double* ypos)
@@ -551,6 +752,47 @@ const char* _glfwGetClipboardStringNull(void)
     return _glfw.null.clipboardString;
 }
 
+void _glfwRequestClipboardStringNull(void)
+{
+    // The request completes during the next event processing, like it would
+    // with a clipboard owned by another application
+    _glfw.null.clipboardRequested = GLFW_TRUE;
+    _glfwPostEmptyEventNull();
+}
+
+void _glfwCancelClipboardRequestNull(void)
+{
+    _glfw.null.clipboardRequested = GLFW_FALSE;
+}
+
+GLFWbool _glfwSetClipboardDataNull(void)
+{
+    _glfw_free(_glfw.null.clipboardString);
+    _glfw.null.clipboardString = NULL;
+    return GLFW_TRUE;
+}
+
+const void* _glfwGetClipboardDataNull(const char* type, size_t* size)
+{
+    if (_glfwClipboardDataOffered(type))
+    {
+        const void* data = _glfw.clipboardData.callback(type, size);
+        if (data)
+            return data;
+    }
+    else if (_glfw.null.clipboardString &&
+             strcmp(type, "text/plain;charset=utf-8") == 0)
+    {
+        *size = strlen(_glfw.null.clipboardString);
+        return _glfw.null.clipboardString;
+    }
+
+    *size = 0;
+    _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                    "Null: Clipboard data is not available as %s", type);
+    return NULL;
+}
+
 EGLenum _glfwGetEGLPlatformNull(EGLint** attribs)
 {
     if (_glfw.egl.EXT_platform_base && _glfw.egl.MESA_platform_surfaceless)
@@ -747,3 +989,202 @@ VkResult _glfwCreateWindowSurfaceNull(VkInstance instance,
     return err;
 }
 
+
+//////////////////////////////////////////////////////////////////////////
+//////                        GLFW native API                       //////
+//////////////////////////////////////////////////////////////////////////
+
+GLFWAPI int glfwInjectNullEvents(const GLFWevent* events, int count, int timed)
+{
+    int i;
+    double base = 0.0;
+
+    assert(events != NULL);
+    assert(count >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "Null: Platform not initialized");
+        return GLFW_FALSE;
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        const GLFWevent* event = events + i;
+
+        if (!event->window)
+        {
+            _glfwInputError(GLFW_INVALID_VALUE,
+                            "Null: Injected event %i has no window", i);
+            return GLFW_FALSE;
+        }
+
+        // Consecutive events for the same window only need to be checked once
+        if (i == 0 || event->window != events[i - 1].window)
+        {
+            if (!isValidWindow(event->window))
+            {
+                _glfwInputError(GLFW_INVALID_VALUE,
+                                "Null: Injected event %i has an invalid window", i);
+                return GLFW_FALSE;
+            }
+        }
+
+        switch (event->type)
+        {
+            case GLFW_EVENT_KEY:
+            {
+                const int key = event->data.key.key;
+                const int action = event->data.key.action;
+
+                if (key != GLFW_KEY_UNKNOWN && (key < GLFW_KEY_SPACE || key > GLFW_KEY_LAST))
+                {
+                    _glfwInputError(GLFW_INVALID_ENUM,
+                                    "Null: Invalid key %i in injected event %i",
+                                    key, i);
+                    return GLFW_FALSE;
+                }
+
+                if (action != GLFW_PRESS && action != GLFW_RELEASE && action != GLFW_REPEAT)
+                {
+                    _glfwInputError(GLFW_INVALID_ENUM,
+                                    "Null: Invalid key action %i in injected event %i",
+                                    action, i);
+                    return GLFW_FALSE;
+                }
+
+                break;
+            }
+
+            case GLFW_EVENT_MOUSE_BUTTON:
+            {
+                const int button = event->data.button.button;
+                const int action = event->data.button.action;
+
+                if (button < 0)
+                {
+                    _glfwInputError(GLFW_INVALID_ENUM,
+                                    "Null: Invalid mouse button %i in injected event %i",
+                                    button, i);
+                    return GLFW_FALSE;
+                }
+
+                if (action != GLFW_PRESS && action != GLFW_RELEASE)
+                {
+                    _glfwInputError(GLFW_INVALID_ENUM,
+                                    "Null: Invalid mouse button action %i in injected event %i",
+                                    action, i);
+                    return GLFW_FALSE;
+                }
+
+                break;
+            }
+
+            case GLFW_EVENT_WINDOW_SIZE:
+            {
+                if (event->data.size.width <= 0 || event->data.size.height <= 0)
+                {
+                    _glfwInputError(GLFW_INVALID_VALUE,
+                                    "Null: Invalid window size %ix%i in injected event %i",
+                                    event->data.size.width, event->data.size.height, i);
+                    return GLFW_FALSE;
+                }
+
+                break;
+            }
+
+            case GLFW_EVENT_CHAR:
+            case GLFW_EVENT_CURSOR_POS:
+            case GLFW_EVENT_CURSOR_ENTER:
+            case GLFW_EVENT_SCROLL:
+            case GLFW_EVENT_WINDOW_POS:
+            case GLFW_EVENT_WINDOW_CLOSE:
+            case GLFW_EVENT_WINDOW_FOCUS:
+                break;
+
+            default:
+            {
+                _glfwInputError(GLFW_INVALID_ENUM,
+                                "Null: Invalid type 0x%08X of injected event %i",
+                                event->type, i);
+                return GLFW_FALSE;
+            }
+        }
+    }
+
+    if (_glfw.null.injected.count + count > _glfw.null.injected.capacity)
+    {
+        const int capacity = _glfw_max(_glfw.null.injected.count + count,
+                                       _glfw.null.injected.capacity * 2);
+        GLFWevent* queue = _glfw_realloc(_glfw.null.injected.events,
+                                         capacity * sizeof(GLFWevent));
+        if (!queue)
+        {
+            _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+            return GLFW_FALSE;
+        }
+
+        _glfw.null.injected.events = queue;
+        _glfw.null.injected.capacity = capacity;
+    }
+
+    if (timed && count)
+        base = getTimerSeconds() - events[0].time;
+
+    for (i = 0;  i < count;  i++)
+    {
+        GLFWevent* event = _glfw.null.injected.events + _glfw.null.injected.count++;
+        *event = events[i];
+
+        // A time of zero marks the event as due immediately
+        if (timed)
+            event->time = base + events[i].time;
+        else
+            event->time = 0.0;
+
+        switch (event->type)
+        {
+            case GLFW_EVENT_KEY:
+                event->data.key.mods &= GLFW_MOD_MASK;
+                break;
+            case GLFW_EVENT_CHAR:
+                event->data.character.mods &= GLFW_MOD_MASK;
+                break;
+            case GLFW_EVENT_MOUSE_BUTTON:
+                event->data.button.mods &= GLFW_MOD_MASK;
+                break;
+            case GLFW_EVENT_CURSOR_ENTER:
+            case GLFW_EVENT_WINDOW_FOCUS:
+                event->data.state = event->data.state ? GLFW_TRUE : GLFW_FALSE;
+                break;
+        }
+    }
+
+    return GLFW_TRUE;
+}
+
+GLFWAPI void glfwInjectNullDrop(GLFWwindow* handle, const char* uri_list)
+{
+    _GLFWwindow* window = (_GLFWwindow*) handle;
+    assert(window != NULL);
+    assert(uri_list != NULL);
+
+    _GLFW_REQUIRE_INIT();
+
+    if (_glfw.platform.platformID != GLFW_PLATFORM_NULL)
+    {
+        _glfwInputError(GLFW_PLATFORM_UNAVAILABLE, "Null: Platform not initialized");
+        return;
+    }
+
+    if (!isValidWindow(handle))
+    {
+        _glfwInputError(GLFW_INVALID_VALUE, "Null: Invalid window for dropped URIs");
+        return;
+    }
+
+    _glfwInputDropUriList(window, uri_list);
+}
+
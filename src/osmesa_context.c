@@ -96,10 +96,10 @@ static void swapIntervalOSMesa(int interval)
     // No swap interval on OSMesa
 }
 
-static int extensionSupportedOSMesa(const char* extension)
+static const char* getExtensionStringOSMesa(void)
 {
     // OSMesa does not have extensions
-    return GLFW_FALSE;
+    return NULL;
 }
 
 
@@ -277,7 +277,7 @@ GLFWbool _glfwCreateContextOSMesa(_GLFWwindow* window,
     window->context.makeCurrent = makeContextCurrentOSMesa;
     window->context.swapBuffers = swapBuffersOSMesa;
     window->context.swapInterval = swapIntervalOSMesa;
-    window->context.extensionSupported = extensionSupportedOSMesa;
+    window->context.getExtensionString = getExtensionStringOSMesa;
     window->context.getProcAddress = getProcAddressOSMesa;
     window->context.destroy = destroyContextOSMesa;
 
@@ -0,0 +1,428 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#include "pixel.h"
+#include "simd.h"
+
+#include <limits.h>
+
+// Whether unsigned long is 64-bit, as XChangeProperty pads 32-bit items to it
+#if ULONG_MAX > 0xffffffffUL
+ #define _GLFW_PIXEL_LONG64
+#endif
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                        Scalar kernels                        //////
+//////////////////////////////////////////////////////////////////////////
+
+static void argb32Scalar(const unsigned char* source, uint32_t* target, size_t count)
+{
+    for (size_t i = 0;  i < count;  i++, source += 4)
+    {
+        target[i] = ((uint32_t) source[3] << 24) |
+                    ((uint32_t) source[0] << 16) |
+                    ((uint32_t) source[1] <<  8) |
+                    ((uint32_t) source[2] <<  0);
+    }
+}
+
+static void premultipliedARGB32Scalar(const unsigned char* source,
+                                      uint32_t* target,
+                                      size_t count)
+{
+    for (size_t i = 0;  i < count;  i++, source += 4)
+    {
+        const unsigned int alpha = source[3];
+
+        target[i] = ((uint32_t) alpha << 24) |
+                    ((uint32_t) ((source[0] * alpha) / 255) << 16) |
+                    ((uint32_t) ((source[1] * alpha) / 255) <<  8) |
+                    ((uint32_t) ((source[2] * alpha) / 255) <<  0);
+    }
+}
+
+static void argbLongScalar(const unsigned char* source, unsigned long* target, size_t count)
+{
+    for (size_t i = 0;  i < count;  i++, source += 4)
+    {
+        target[i] = ((unsigned long) source[3] << 24) |
+                    ((unsigned long) source[0] << 16) |
+                    ((unsigned long) source[1] <<  8) |
+                    ((unsigned long) source[2] <<  0);
+    }
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                         SSE2 kernels                         //////
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(_GLFW_SIMD_SSE2)
+
+// Swaps the R and B channels of four RGBA pixels, making them ARGB32
+//
+static __m128i swizzleSSE2(__m128i pixels)
+{
+    const __m128i ga = _mm_and_si128(pixels, _mm_set1_epi32((int) 0xff00ff00));
+    __m128i rb = _mm_and_si128(pixels, _mm_set1_epi32(0x00ff00ff));
+    rb = _mm_shufflelo_epi16(rb, _MM_SHUFFLE(2, 3, 0, 1));
+    rb = _mm_shufflehi_epi16(rb, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_or_si128(ga, rb);
+}
+
+// Premultiplies two RGBA pixels widened to 16 bits per channel, dividing by
+// 255 with truncation exactly like the scalar kernel
+//
+static __m128i premultiplyWideSSE2(__m128i pixels)
+{
+    // The alpha channel is multiplied by 255 so that the division restores it
+    const __m128i mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+    const __m128i opaque = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+
+    __m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_or_si128(_mm_and_si128(alpha, mask), opaque);
+
+    // x / 255 == (x + 1 + (x >> 8)) >> 8 for every product of two bytes
+    const __m128i x = _mm_mullo_epi16(pixels, alpha);
+    const __m128i sum = _mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)),
+                                      _mm_srli_epi16(x, 8));
+    return _mm_srli_epi16(sum, 8);
+}
+
+static __m128i premultiplySSE2(__m128i pixels)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low = premultiplyWideSSE2(_mm_unpacklo_epi8(pixels, zero));
+    const __m128i high = premultiplyWideSSE2(_mm_unpackhi_epi8(pixels, zero));
+    return _mm_packus_epi16(low, high);
+}
+
+static void argb32SSE2(const unsigned char* source, uint32_t* target, size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*) (source + i * 4));
+        _mm_storeu_si128((__m128i*) (target + i), swizzleSSE2(pixels));
+    }
+
+    argb32Scalar(source + i * 4, target + i, count - i);
+}
+
+static void premultipliedARGB32SSE2(const unsigned char* source,
+                                    uint32_t* target,
+                                    size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128((const __m128i*) (source + i * 4));
+        _mm_storeu_si128((__m128i*) (target + i),
+                         swizzleSSE2(premultiplySSE2(pixels)));
+    }
+
+    premultipliedARGB32Scalar(source + i * 4, target + i, count - i);
+}
+
+#if defined(_GLFW_PIXEL_LONG64)
+static void argbLongSSE2(const unsigned char* source, unsigned long* target, size_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (;  i + 4 <= count;  i += 4)
+    {
+        const __m128i pixels =
+            swizzleSSE2(_mm_loadu_si128((const __m128i*) (source + i * 4)));
+        _mm_storeu_si128((__m128i*) (target + i), _mm_unpacklo_epi32(pixels, zero));
+        _mm_storeu_si128((__m128i*) (target + i + 2), _mm_unpackhi_epi32(pixels, zero));
+    }
+
+    argbLongScalar(source + i * 4, target + i, count - i);
+}
+#else
+ #define argbLongSSE2 argbLongScalar
+#endif
+
+#endif // _GLFW_SIMD_SSE2
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                         AVX2 kernels                         //////
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(_GLFW_SIMD_AVX2)
+
+_GLFW_AVX2_FUNCTION
+static __m256i swizzleAVX2(__m256i pixels)
+{
+    const __m256i order = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7,
+                                           10, 9, 8, 11, 14, 13, 12, 15,
+                                           2, 1, 0, 3, 6, 5, 4, 7,
+                                           10, 9, 8, 11, 14, 13, 12, 15);
+    return _mm256_shuffle_epi8(pixels, order);
+}
+
+_GLFW_AVX2_FUNCTION
+static __m256i premultiplyWideAVX2(__m256i pixels)
+{
+    const __m256i mask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1,
+                                          0, -1, -1, -1, 0, -1, -1, -1);
+    const __m256i opaque = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0,
+                                            255, 0, 0, 0, 255, 0, 0, 0);
+
+    __m256i alpha = _mm256_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_or_si256(_mm256_and_si256(alpha, mask), opaque);
+
+    const __m256i x = _mm256_mullo_epi16(pixels, alpha);
+    const __m256i sum = _mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)),
+                                         _mm256_srli_epi16(x, 8));
+    return _mm256_srli_epi16(sum, 8);
+}
+
+_GLFW_AVX2_FUNCTION
+static __m256i premultiplyAVX2(__m256i pixels)
+{
+    // The unpacking and packing both work within 128-bit lanes, so the pixel
+    // order is preserved
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i low = premultiplyWideAVX2(_mm256_unpacklo_epi8(pixels, zero));
+    const __m256i high = premultiplyWideAVX2(_mm256_unpackhi_epi8(pixels, zero));
+    return _mm256_packus_epi16(low, high);
+}
+
+_GLFW_AVX2_FUNCTION
+static void argb32AVX2(const unsigned char* source, uint32_t* target, size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 8 <= count;  i += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*) (source + i * 4));
+        _mm256_storeu_si256((__m256i*) (target + i), swizzleAVX2(pixels));
+    }
+
+    argb32SSE2(source + i * 4, target + i, count - i);
+}
+
+_GLFW_AVX2_FUNCTION
+static void premultipliedARGB32AVX2(const unsigned char* source,
+                                    uint32_t* target,
+                                    size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 8 <= count;  i += 8)
+    {
+        const __m256i pixels = _mm256_loadu_si256((const __m256i*) (source + i * 4));
+        _mm256_storeu_si256((__m256i*) (target + i),
+                            swizzleAVX2(premultiplyAVX2(pixels)));
+    }
+
+    premultipliedARGB32SSE2(source + i * 4, target + i, count - i);
+}
+
+#if defined(_GLFW_PIXEL_LONG64)
+_GLFW_AVX2_FUNCTION
+static void argbLongAVX2(const unsigned char* source, unsigned long* target, size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 8 <= count;  i += 8)
+    {
+        const __m256i pixels =
+            swizzleAVX2(_mm256_loadu_si256((const __m256i*) (source + i * 4)));
+        _mm256_storeu_si256((__m256i*) (target + i),
+                            _mm256_cvtepu32_epi64(_mm256_castsi256_si128(pixels)));
+        _mm256_storeu_si256((__m256i*) (target + i + 4),
+                            _mm256_cvtepu32_epi64(_mm256_extracti128_si256(pixels, 1)));
+    }
+
+    argbLongSSE2(source + i * 4, target + i, count - i);
+}
+#else
+ #define argbLongAVX2 argbLongScalar
+#endif
+
+#endif // _GLFW_SIMD_AVX2
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                         NEON kernels                         //////
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(_GLFW_SIMD_NEON)
+
+// Divides the products of two bytes by 255 with truncation
+//
+static uint8x8_t divide255NEON(uint16x8_t x)
+{
+    const uint16x8_t sum = vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8));
+    return vshrn_n_u16(sum, 8);
+}
+
+static uint8x16_t premultiplyNEON(uint8x16_t color, uint8x16_t alpha)
+{
+    const uint16x8_t low = vmull_u8(vget_low_u8(color), vget_low_u8(alpha));
+    const uint16x8_t high = vmull_u8(vget_high_u8(color), vget_high_u8(alpha));
+    return vcombine_u8(divide255NEON(low), divide255NEON(high));
+}
+
+static void argb32NEON(const unsigned char* source, uint32_t* target, size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 16 <= count;  i += 16)
+    {
+        const uint8x16x4_t rgba = vld4q_u8(source + i * 4);
+        uint8x16x4_t bgra;
+        bgra.val[0] = rgba.val[2];
+        bgra.val[1] = rgba.val[1];
+        bgra.val[2] = rgba.val[0];
+        bgra.val[3] = rgba.val[3];
+        vst4q_u8((uint8_t*) (target + i), bgra);
+    }
+
+    argb32Scalar(source + i * 4, target + i, count - i);
+}
+
+static void premultipliedARGB32NEON(const unsigned char* source,
+                                    uint32_t* target,
+                                    size_t count)
+{
+    size_t i = 0;
+
+    for (;  i + 16 <= count;  i += 16)
+    {
+        const uint8x16x4_t rgba = vld4q_u8(source + i * 4);
+        uint8x16x4_t bgra;
+        bgra.val[0] = premultiplyNEON(rgba.val[2], rgba.val[3]);
+        bgra.val[1] = premultiplyNEON(rgba.val[1], rgba.val[3]);
+        bgra.val[2] = premultiplyNEON(rgba.val[0], rgba.val[3]);
+        bgra.val[3] = rgba.val[3];
+        vst4q_u8((uint8_t*) (target + i), bgra);
+    }
+
+    premultipliedARGB32Scalar(source + i * 4, target + i, count - i);
+}
+
+static void argbLongNEON(const unsigned char* source, unsigned long* target, size_t count)
+{
+    uint32_t pixels[64];
+
+    // The pixels are converted in blocks and then widened
+    for (size_t i = 0;  i < count;  i += 64)
+    {
+        const size_t blockSize = count - i < 64 ? count - i : 64;
+
+        argb32NEON(source + i * 4, pixels, blockSize);
+
+        for (size_t j = 0;  j < blockSize;  j++)
+            target[i + j] = pixels[j];
+    }
+}
+
+#endif // _GLFW_SIMD_NEON
+
+
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// The kernels in order of preference, with AVX2 last so that it can be left out
+// if the processor does not support it
+//
+static const _GLFWpixelconverter converters[] =
+{
+    { "scalar", argb32Scalar, premultipliedARGB32Scalar, argbLongScalar },
+#if defined(_GLFW_SIMD_NEON)
+    { "NEON", argb32NEON, premultipliedARGB32NEON, argbLongNEON },
+#endif
+#if defined(_GLFW_SIMD_SSE2)
+    { "SSE2", argb32SSE2, premultipliedARGB32SSE2, argbLongSSE2 },
+#endif
+#if defined(_GLFW_SIMD_AVX2)
+    { "AVX2", argb32AVX2, premultipliedARGB32AVX2, argbLongAVX2 },
+#endif
+};
+
+// Returns the pixel converters supported by the processor, from the scalar
+// fallback to the fastest one
+//
+int _glfwGetPixelConverters(const _GLFWpixelconverter** result)
+{
+    *result = converters;
+    return _GLFW_SUPPORTED_KERNEL_COUNT(converters);
+}
+
+static const _GLFWpixelconverter* getPixelConverter(void)
+{
+    static const _GLFWpixelconverter* converter = NULL;
+
+    if (!converter)
+    {
+        const _GLFWpixelconverter* supported;
+        const int count = _glfwGetPixelConverters(&supported);
+        converter = supported + count - 1;
+    }
+
+    return converter;
+}
+
+// Converts RGBA pixels to ARGB32
+//
+void _glfwConvertRGBAtoARGB32(const unsigned char* source,
+                              uint32_t* target,
+                              size_t count)
+{
+    getPixelConverter()->argb32(source, target, count);
+}
+
+// Converts RGBA pixels to premultiplied ARGB32, which is BGRA in memory on
+// little-endian machines
+//
+void _glfwConvertRGBAtoPremultipliedARGB32(const unsigned char* source,
+                                           uint32_t* target,
+                                           size_t count)
+{
+    getPixelConverter()->premultipliedARGB32(source, target, count);
+}
+
+// Converts RGBA pixels to ARGB32 widened to unsigned long
+//
+void _glfwConvertRGBAtoARGBLong(const unsigned char* source,
+                                unsigned long* target,
+                                size_t count)
+{
+    getPixelConverter()->argbLong(source, target, count);
+}
+
@@ -0,0 +1,59 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The pixel conversion module does not depend on the rest of GLFW, so that it
+// can be built into the pixel conversion test
+
+// A set of pixel conversion kernels for one instruction set
+// All kernels take tightly packed non-premultiplied 8-bit RGBA pixels, as used
+// by GLFWimage, and write ARGB pixels with A in the most significant byte
+//
+typedef struct _GLFWpixelconverter
+{
+    const char*     name;
+    void            (*argb32)(const unsigned char*, uint32_t*, size_t);
+    void            (*premultipliedARGB32)(const unsigned char*, uint32_t*, size_t);
+    void            (*argbLong)(const unsigned char*, unsigned long*, size_t);
+} _GLFWpixelconverter;
+
+int _glfwGetPixelConverters(const _GLFWpixelconverter** converters);
+
+void _glfwConvertRGBAtoARGB32(const unsigned char* source,
+                              uint32_t* target,
+                              size_t count);
+void _glfwConvertRGBAtoPremultipliedARGB32(const unsigned char* source,
+                                           uint32_t* target,
+                                           size_t count);
+void _glfwConvertRGBAtoARGBLong(const unsigned char* source,
+                                unsigned long* target,
+                                size_t count);
+
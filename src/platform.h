@@ -38,6 +38,7 @@
 #endif
 
 #include "null_platform.h"
+#define GLFW_EXPOSE_NATIVE_NULL
 #define GLFW_EXPOSE_NATIVE_EGL
 #define GLFW_EXPOSE_NATIVE_OSMESA
 
@@ -175,10 +176,14 @@
  #include "win32_thread.h"
  #define GLFW_PLATFORM_TLS_STATE    GLFW_WIN32_TLS_STATE
  #define GLFW_PLATFORM_MUTEX_STATE  GLFW_WIN32_MUTEX_STATE
+ #define GLFW_PLATFORM_COND_STATE   GLFW_WIN32_COND_STATE
+ #define GLFW_PLATFORM_THREAD_STATE GLFW_WIN32_THREAD_STATE
 #elif defined(GLFW_BUILD_POSIX_THREAD)
  #include "posix_thread.h"
  #define GLFW_PLATFORM_TLS_STATE    GLFW_POSIX_TLS_STATE
  #define GLFW_PLATFORM_MUTEX_STATE  GLFW_POSIX_MUTEX_STATE
+ #define GLFW_PLATFORM_COND_STATE   GLFW_POSIX_COND_STATE
+ #define GLFW_PLATFORM_THREAD_STATE GLFW_POSIX_THREAD_STATE
 #endif
 
 #if defined(_WIN32)
@@ -33,6 +33,13 @@
 #include <signal.h>
 #include <time.h>
 #include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#if defined(__linux__)
+ #include <sys/eventfd.h>
+#endif
 
 GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
 {
@@ -79,5 +86,102 @@ GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout)
     }
 }
 
+// Creates the empty event wakeup channel, preferring an eventfd to a pipe
+//
+GLFWbool _glfwCreateEmptyEventPOSIX(_GLFWemptyeventPOSIX* ee)
+{
+    ee->pending = 0;
+
+#if defined(__linux__)
+    ee->fds[0] = ee->fds[1] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ee->fds[0] != -1)
+        return GLFW_TRUE;
+#endif
+
+    // Create the pipe without assuming the OS has pipe2(2)
+    if (pipe(ee->fds) != 0)
+    {
+        ee->fds[0] = ee->fds[1] = -1;
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create empty event pipe: %s",
+                        strerror(errno));
+        return GLFW_FALSE;
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        const int sf = fcntl(ee->fds[i], F_GETFL, 0);
+        const int df = fcntl(ee->fds[i], F_GETFD, 0);
+
+        if (sf == -1 || df == -1 ||
+            fcntl(ee->fds[i], F_SETFL, sf | O_NONBLOCK) == -1 ||
+            fcntl(ee->fds[i], F_SETFD, df | FD_CLOEXEC) == -1)
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "POSIX: Failed to set flags for empty event pipe: %s",
+                            strerror(errno));
+            return GLFW_FALSE;
+        }
+    }
+
+    return GLFW_TRUE;
+}
+
+void _glfwDestroyEmptyEventPOSIX(_GLFWemptyeventPOSIX* ee)
+{
+    if (ee->fds[0] > 0)
+        close(ee->fds[0]);
+    if (ee->fds[1] > 0 && ee->fds[1] != ee->fds[0])
+        close(ee->fds[1]);
+
+    ee->fds[0] = ee->fds[1] = -1;
+}
+
+// Wakes up the event wait unless an earlier wakeup has not yet been drained
+// This may be called from any thread
+//
+void _glfwPostEmptyEventPOSIX(_GLFWemptyeventPOSIX* ee)
+{
+    if (__atomic_exchange_n(&ee->pending, 1, __ATOMIC_ACQ_REL))
+        return;
+
+    for (;;)
+    {
+        const uint64_t value = 1;
+        ssize_t result;
+
+        if (ee->fds[1] == ee->fds[0])
+            result = write(ee->fds[1], &value, sizeof(value));
+        else
+            result = write(ee->fds[1], &value, 1);
+
+        if (result > 0 || (result == -1 && errno != EINTR))
+            break;
+    }
+}
+
+// Drains the empty event wakeup channel and allows the next post to wake it
+// This should only be called when the channel has been reported readable
+//
+void _glfwDrainEmptyEventsPOSIX(_GLFWemptyeventPOSIX* ee)
+{
+    for (;;)
+    {
+        char dummy[64];
+        const ssize_t result = read(ee->fds[0], dummy, sizeof(dummy));
+        if (result == -1 && errno != EINTR)
+            break;
+        if (result >= 0 && ee->fds[0] == ee->fds[1])
+            break;
+    }
+
+    // Clear the flag only after draining, as a post that cleared it and wrote
+    // before the read would otherwise have its wakeup consumed while leaving
+    // the flag set, making every later post skip its write
+    // A post skipped between the read and this store is harmless, as the
+    // calling thread is already awake and about to process events
+    __atomic_store_n(&ee->pending, 0, __ATOMIC_SEQ_CST);
+}
+
 #endif // GLFW_BUILD_POSIX_POLL
 
@@ -26,5 +26,20 @@
 
 #include <poll.h>
 
+// POSIX-specific empty event wakeup data
+//
+typedef struct _GLFWemptyeventPOSIX
+{
+    // Read and write ends of the wakeup channel, the same eventfd if available
+    int             fds[2];
+    // Non-zero while a posted empty event has not yet been drained
+    int             pending;
+} _GLFWemptyeventPOSIX;
+
 GLFWbool _glfwPollPOSIX(struct pollfd* fds, nfds_t count, double* timeout);
 
+GLFWbool _glfwCreateEmptyEventPOSIX(_GLFWemptyeventPOSIX* ee);
+void _glfwDestroyEmptyEventPOSIX(_GLFWemptyeventPOSIX* ee);
+void _glfwPostEmptyEventPOSIX(_GLFWemptyeventPOSIX* ee);
+void _glfwDrainEmptyEventsPOSIX(_GLFWemptyeventPOSIX* ee);
+
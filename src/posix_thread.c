@@ -31,6 +31,16 @@
 
 #include <assert.h>
 #include <string.h>
+#include <time.h>
+#include <errno.h>
+
+
+static void* threadStart(void* argument)
+{
+    _GLFWthread* thread = argument;
+    thread->function(thread->argument);
+    return NULL;
+}
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -103,5 +113,112 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     pthread_mutex_unlock(&mutex->posix.handle);
 }
 
+GLFWbool _glfwPlatformCreateCond(_GLFWcond* cond)
+{
+    pthread_condattr_t attr;
+    int result;
+
+    assert(cond->posix.allocated == GLFW_FALSE);
+
+    pthread_condattr_init(&attr);
+#if !defined(__APPLE__)
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+    result = pthread_cond_init(&cond->posix.handle, &attr);
+    pthread_condattr_destroy(&attr);
+
+    if (result != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "POSIX: Failed to create condition variable");
+        return GLFW_FALSE;
+    }
+
+    return cond->posix.allocated = GLFW_TRUE;
+}
+
+void _glfwPlatformDestroyCond(_GLFWcond* cond)
+{
+    if (cond->posix.allocated)
+        pthread_cond_destroy(&cond->posix.handle);
+    memset(cond, 0, sizeof(_GLFWcond));
+}
+
+// Waits for the condition variable to be signaled or the timeout to elapse
+// The remaining time is written back to the timeout, which may be NULL
+//
+GLFWbool _glfwPlatformWaitCond(_GLFWcond* cond, _GLFWmutex* mutex, double* timeout)
+{
+    assert(cond->posix.allocated == GLFW_TRUE);
+    assert(mutex->posix.allocated == GLFW_TRUE);
+
+    if (!timeout)
+        return pthread_cond_wait(&cond->posix.handle, &mutex->posix.handle) == 0;
+
+    if (*timeout <= 0.0)
+        return GLFW_FALSE;
+
+    const uint64_t base = _glfwPlatformGetTimerValue();
+    // Clamp the timeout to keep the deadline within range of time_t
+    const double seconds = *timeout < 1e8 ? *timeout : 1e8;
+    struct timespec ts;
+
+#if defined(__APPLE__)
+    clock_gettime(CLOCK_REALTIME, &ts);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+
+    ts.tv_sec += (time_t) seconds;
+    ts.tv_nsec += (long) ((seconds - (time_t) seconds) * 1e9);
+    if (ts.tv_nsec >= 1000000000)
+    {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000;
+    }
+
+    const int result = pthread_cond_timedwait(&cond->posix.handle,
+                                              &mutex->posix.handle,
+                                              &ts);
+
+    *timeout -= (_glfwPlatformGetTimerValue() - base) /
+        (double) _glfwPlatformGetTimerFrequency();
+
+    return result == 0;
+}
+
+void _glfwPlatformSignalCond(_GLFWcond* cond)
+{
+    assert(cond->posix.allocated == GLFW_TRUE);
+    pthread_cond_signal(&cond->posix.handle);
+}
+
+GLFWbool _glfwPlatformCreateThread(_GLFWthread* thread,
+                                   void (*function)(void*),
+                                   void* argument)
+{
+    assert(thread->posix.allocated == GLFW_FALSE);
+
+    thread->function = function;
+    thread->argument = argument;
+
+    if (pthread_create(&thread->posix.handle, NULL, threadStart, thread) != 0)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "POSIX: Failed to create thread");
+        return GLFW_FALSE;
+    }
+
+    return thread->posix.allocated = GLFW_TRUE;
+}
+
+// Waits for the thread function to return
+//
+void _glfwPlatformJoinThread(_GLFWthread* thread)
+{
+    if (thread->posix.allocated)
+        pthread_join(thread->posix.handle, NULL);
+    memset(thread, 0, sizeof(_GLFWthread));
+}
+
 #endif // GLFW_BUILD_POSIX_THREAD
 
@@ -29,6 +29,8 @@
 
 #define GLFW_POSIX_TLS_STATE    _GLFWtlsPOSIX   posix;
 #define GLFW_POSIX_MUTEX_STATE  _GLFWmutexPOSIX posix;
+#define GLFW_POSIX_COND_STATE   _GLFWcondPOSIX  posix;
+#define GLFW_POSIX_THREAD_STATE _GLFWthreadPOSIX posix;
 
 
 // POSIX-specific thread local storage data
@@ -47,3 +49,19 @@ typedef struct _GLFWmutexPOSIX
     pthread_mutex_t handle;
 } _GLFWmutexPOSIX;
 
+// POSIX-specific condition variable data
+//
+typedef struct _GLFWcondPOSIX
+{
+    GLFWbool        allocated;
+    pthread_cond_t  handle;
+} _GLFWcondPOSIX;
+
+// POSIX-specific thread data
+//
+typedef struct _GLFWthreadPOSIX
+{
+    GLFWbool        allocated;
+    pthread_t       handle;
+} _GLFWthreadPOSIX;
+
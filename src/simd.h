@@ -0,0 +1,66 @@
+//========================================================================
+// GLFW 3.5 - www.glfw.org
+//------------------------------------------------------------------------
+// Copyright (c) 2002-2006 Marcus Geelnard
+// Copyright (c) 2006-2019 Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+
+#pragma once
+
+// The instruction sets available to the modules with vector kernels and the
+// run-time selection of their kernels, which like those modules do not depend
+// on the rest of GLFW
+
+// SSE2 is part of the baseline of x86-64 and is used whenever the compiler
+// targets it, while AVX2 is selected at run-time where the compiler allows it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #define _GLFW_SIMD_SSE2
+ #include <emmintrin.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && \
+    defined(_GLFW_SIMD_SSE2)
+ #define _GLFW_SIMD_AVX2
+ #define _GLFW_AVX2_FUNCTION __attribute__((target("avx2")))
+ #include <immintrin.h>
+#endif
+
+// NEON is part of the baseline of AArch64 and the SIMD kernels assume that
+// elements are stored in little-endian order
+#if (defined(__ARM_NEON) || defined(_M_ARM64)) && !defined(__ARM_BIG_ENDIAN)
+ #define _GLFW_SIMD_NEON
+ #include <arm_neon.h>
+#endif
+
+// Returns the number of kernels in a table, ordered from the scalar fallback to
+// the fastest one, that the processor supports
+//
+// Any AVX2 kernel must be last in the table, so that it can be left out
+//
+#if defined(_GLFW_SIMD_AVX2)
+ #define _GLFW_SUPPORTED_KERNEL_COUNT(kernels) \
+    ((int) (sizeof(kernels) / sizeof((kernels)[0])) - !__builtin_cpu_supports("avx2"))
+#else
+ #define _GLFW_SUPPORTED_KERNEL_COUNT(kernels) \
+    ((int) (sizeof(kernels) / sizeof((kernels)[0])))
+#endif
@@ -368,15 +368,19 @@ static void swapIntervalWGL(int interval)
         wglSwapIntervalEXT(interval);
 }
 
-static int extensionSupportedWGL(const char* extension)
+static const char* getExtensionStringWGL(void)
 {
-    const char* extensions = NULL;
-
     if (_glfw.wgl.GetExtensionsStringARB)
-        extensions = wglGetExtensionsStringARB(wglGetCurrentDC());
+        return wglGetExtensionsStringARB(wglGetCurrentDC());
     else if (_glfw.wgl.GetExtensionsStringEXT)
-        extensions = wglGetExtensionsStringEXT();
+        return wglGetExtensionsStringEXT();
+
+    return NULL;
+}
 
+static int extensionSupportedWGL(const char* extension)
+{
+    const char* extensions = getExtensionStringWGL();
     if (!extensions)
         return GLFW_FALSE;
 
@@ -764,7 +768,7 @@ GLFWbool _glfwCreateContextWGL(_GLFWwindow* window,
     window->context.makeCurrent = makeContextCurrentWGL;
     window->context.swapBuffers = swapBuffersWGL;
     window->context.swapInterval = swapIntervalWGL;
-    window->context.extensionSupported = extensionSupportedWGL;
+    window->context.getExtensionString = getExtensionStringWGL;
     window->context.getProcAddress = getProcAddressWGL;
     window->context.destroy = destroyContextWGL;
 
@@ -339,8 +339,17 @@ static LRESULT CALLBACK helperWindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LP
     {
         case WM_DISPLAYCHANGE:
             _glfwPollMonitorsWin32();
+            _glfwInputMonitorChange(NULL);
             break;
 
+        case WM_SETTINGCHANGE:
+        {
+            if (wParam == SPI_SETWORKAREA)
+                _glfwInputMonitorChange(NULL);
+
+            break;
+        }
+
         case WM_DEVICECHANGE:
         {
             if (!_glfw.joysticksInitialized)
@@ -361,6 +370,29 @@ static LRESULT CALLBACK helperWindowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LP
 
             break;
         }
+
+        case WM_RENDERFORMAT:
+        {
+            // The clipboard is already open by the application requesting it
+            _glfwRenderClipboardDataWin32((UINT) wParam);
+            return 0;
+        }
+
+        case WM_RENDERALLFORMATS:
+        {
+            // The clipboard data is about to lose its owner
+            if (!OpenClipboard(hWnd))
+                return 0;
+
+            if (GetClipboardOwner() == hWnd && _glfw.win32.clipboardFormats)
+            {
+                for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+                    _glfwRenderClipboardDataWin32(_glfw.win32.clipboardFormats[i]);
+            }
+
+            CloseClipboard();
+            return 0;
+        }
     }
 
     return DefWindowProcW(hWnd, uMsg, wParam, lParam);
@@ -618,6 +650,10 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeWin32,
         .setClipboardString = _glfwSetClipboardStringWin32,
         .getClipboardString = _glfwGetClipboardStringWin32,
+        .requestClipboardString = _glfwRequestClipboardStringWin32,
+        .cancelClipboardRequest = _glfwCancelClipboardRequestWin32,
+        .setClipboardData = _glfwSetClipboardDataWin32,
+        .getClipboardData = _glfwGetClipboardDataWin32,
         .initJoysticks = _glfwInitJoysticksWin32,
         .terminateJoysticks = _glfwTerminateJoysticksWin32,
         .pollJoystick = _glfwPollJoystickWin32,
@@ -631,6 +667,7 @@ GLFWbool _glfwConnectWin32(int platformID, _GLFWplatform* platform)
         .getVideoMode = _glfwGetVideoModeWin32,
         .getGammaRamp = _glfwGetGammaRampWin32,
         .setGammaRamp = _glfwSetGammaRampWin32,
+        .flushGammaRamps = _glfwFlushGammaRampsWin32,
         .createWindow = _glfwCreateWindowWin32,
         .destroyWindow = _glfwDestroyWindowWin32,
         .setWindowTitle = _glfwSetWindowTitleWin32,
@@ -718,6 +755,8 @@ void _glfwTerminateWin32(void)
         UnregisterClassW(MAKEINTATOM(_glfw.win32.mainWindowClass), _glfw.win32.instance);
 
     _glfw_free(_glfw.win32.clipboardString);
+    _glfw_free(_glfw.win32.clipboardFormats);
+    _glfw_free(_glfw.win32.clipboardData);
     _glfw_free(_glfw.win32.rawInput);
 
     _glfwTerminateWGL();
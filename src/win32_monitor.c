@@ -276,7 +276,10 @@ void _glfwSetVideoModeWin32(_GLFWmonitor* monitor, const GLFWvidmode* desired)
                                       CDS_FULLSCREEN,
                                       NULL);
     if (result == DISP_CHANGE_SUCCESSFUL)
+    {
         monitor->win32.modeChanged = GLFW_TRUE;
+        _glfwInputMonitorChange(monitor);
+    }
     else
     {
         const char* description = "Unknown error";
@@ -311,6 +314,7 @@ void _glfwRestoreVideoModeWin32(_GLFWmonitor* monitor)
         ChangeDisplaySettingsExW(monitor->win32.adapterName,
                                  NULL, NULL, CDS_FULLSCREEN, NULL);
         monitor->win32.modeChanged = GLFW_FALSE;
+        _glfwInputMonitorChange(monitor);
     }
 }
 
@@ -512,16 +516,17 @@ GLFWbool _glfwGetGammaRampWin32(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     return GLFW_TRUE;
 }
 
-void _glfwSetGammaRampWin32(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
+GLFWbool _glfwSetGammaRampWin32(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     HDC dc;
+    BOOL result;
     WORD values[3][256];
 
     if (ramp->size != 256)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Win32: Gamma ramp size must be 256");
-        return;
+        return GLFW_FALSE;
     }
 
     memcpy(values[0], ramp->red,   sizeof(values[0]));
@@ -529,8 +534,20 @@ void _glfwSetGammaRampWin32(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
     memcpy(values[2], ramp->blue,  sizeof(values[2]));
 
     dc = CreateDCW(L"DISPLAY", monitor->win32.adapterName, NULL, NULL);
-    SetDeviceGammaRamp(dc, values);
+    result = SetDeviceGammaRamp(dc, values);
     DeleteDC(dc);
+
+    if (!result)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to set gamma ramp");
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+void _glfwFlushGammaRampsWin32(void)
+{
 }
 
 
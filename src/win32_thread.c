@@ -32,6 +32,14 @@
 #include <assert.h>
 
 
+static DWORD WINAPI threadStart(LPVOID argument)
+{
+    _GLFWthread* thread = argument;
+    thread->function(thread->argument);
+    return 0;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW platform API                      //////
 //////////////////////////////////////////////////////////////////////////
@@ -96,5 +104,102 @@ void _glfwPlatformUnlockMutex(_GLFWmutex* mutex)
     LeaveCriticalSection(&mutex->win32.section);
 }
 
+GLFWbool _glfwPlatformCreateCond(_GLFWcond* cond)
+{
+    assert(cond->win32.allocated == GLFW_FALSE);
+
+    cond->win32.event = CreateEventW(NULL, FALSE, FALSE, NULL);
+    if (!cond->win32.event)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Win32: Failed to create condition variable event");
+        return GLFW_FALSE;
+    }
+
+    return cond->win32.allocated = GLFW_TRUE;
+}
+
+void _glfwPlatformDestroyCond(_GLFWcond* cond)
+{
+    if (cond->win32.allocated)
+        CloseHandle(cond->win32.event);
+    memset(cond, 0, sizeof(_GLFWcond));
+}
+
+// Waits for the condition variable to be signaled or the timeout to elapse
+// The remaining time is written back to the timeout, which may be NULL
+//
+GLFWbool _glfwPlatformWaitCond(_GLFWcond* cond, _GLFWmutex* mutex, double* timeout)
+{
+    DWORD milliseconds = INFINITE;
+
+    assert(cond->win32.allocated == GLFW_TRUE);
+    assert(mutex->win32.allocated == GLFW_TRUE);
+
+    if (timeout)
+    {
+        if (*timeout <= 0.0)
+            return GLFW_FALSE;
+
+        if (*timeout < (INFINITE - 1) / 1e3)
+            milliseconds = (DWORD) (*timeout * 1e3);
+        else
+            milliseconds = INFINITE - 1;
+    }
+
+    const uint64_t base = _glfwPlatformGetTimerValue();
+
+    // The auto-reset event stays signaled if set between these two calls
+    LeaveCriticalSection(&mutex->win32.section);
+    const DWORD result = WaitForSingleObject(cond->win32.event, milliseconds);
+    EnterCriticalSection(&mutex->win32.section);
+
+    if (timeout)
+    {
+        *timeout -= (_glfwPlatformGetTimerValue() - base) /
+            (double) _glfwPlatformGetTimerFrequency();
+    }
+
+    return result == WAIT_OBJECT_0;
+}
+
+void _glfwPlatformSignalCond(_GLFWcond* cond)
+{
+    assert(cond->win32.allocated == GLFW_TRUE);
+    SetEvent(cond->win32.event);
+}
+
+GLFWbool _glfwPlatformCreateThread(_GLFWthread* thread,
+                                   void (*function)(void*),
+                                   void* argument)
+{
+    assert(thread->win32.allocated == GLFW_FALSE);
+
+    thread->function = function;
+    thread->argument = argument;
+
+    thread->win32.handle = CreateThread(NULL, 0, threadStart, thread, 0, NULL);
+    if (!thread->win32.handle)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR, "Win32: Failed to create thread");
+        return GLFW_FALSE;
+    }
+
+    return thread->win32.allocated = GLFW_TRUE;
+}
+
+// Waits for the thread function to return
+//
+void _glfwPlatformJoinThread(_GLFWthread* thread)
+{
+    if (thread->win32.allocated)
+    {
+        WaitForSingleObject(thread->win32.handle, INFINITE);
+        CloseHandle(thread->win32.handle);
+    }
+
+    memset(thread, 0, sizeof(_GLFWthread));
+}
+
 #endif // GLFW_BUILD_WIN32_THREAD
 
@@ -34,6 +34,8 @@
 
 #define GLFW_WIN32_TLS_STATE            _GLFWtlsWin32     win32;
 #define GLFW_WIN32_MUTEX_STATE          _GLFWmutexWin32   win32;
+#define GLFW_WIN32_COND_STATE           _GLFWcondWin32    win32;
+#define GLFW_WIN32_THREAD_STATE         _GLFWthreadWin32  win32;
 
 // Win32-specific thread local storage data
 //
@@ -51,3 +53,20 @@ typedef struct _GLFWmutexWin32
     CRITICAL_SECTION    section;
 } _GLFWmutexWin32;
 
+// Win32-specific condition variable data
+// This is an auto-reset event, as condition variables require Windows Vista
+//
+typedef struct _GLFWcondWin32
+{
+    GLFWbool            allocated;
+    HANDLE              event;
+} _GLFWcondWin32;
+
+// Win32-specific thread data
+//
+typedef struct _GLFWthreadWin32
+{
+    GLFWbool            allocated;
+    HANDLE              handle;
+} _GLFWthreadWin32;
+
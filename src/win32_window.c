@@ -100,7 +100,6 @@ static const GLFWimage* chooseImage(int count, const GLFWimage* images,
 //
 static HICON createIcon(const GLFWimage* image, int xhot, int yhot, GLFWbool icon)
 {
-    int i;
     HDC dc;
     HICON handle;
     HBITMAP color, mask;
@@ -146,15 +145,7 @@ static HICON createIcon(const GLFWimage* image, int xhot, int yhot, GLFWbool ico
         return NULL;
     }
 
-    for (i = 0;  i < image->width * image->height;  i++)
-    {
-        target[0] = source[2];
-        target[1] = source[1];
-        target[2] = source[0];
-        target[3] = source[3];
-        target += 4;
-        source += 4;
-    }
+    _glfwConvertRGBAtoARGB32(source, (uint32_t*) target, image->width * image->height);
 
     ZeroMemory(&ii, sizeof(ii));
     ii.fIcon    = icon;
@@ -529,6 +520,22 @@ static void maximizeWindowManually(_GLFWwindow* window)
                  SWP_NOACTIVATE | SWP_NOZORDER | SWP_FRAMECHANGED);
 }
 
+// Returns the clipboard format for the specified MIME type
+//
+static UINT getClipboardFormat(const char* type)
+{
+    if (strcmp(type, "text/plain;charset=utf-8") == 0)
+        return CF_UNICODETEXT;
+
+    WCHAR* wideType = _glfwCreateWideStringFromUTF8Win32(type);
+    if (!wideType)
+        return 0;
+
+    const UINT format = RegisterClipboardFormatW(wideType);
+    _glfw_free(wideType);
+    return format;
+}
+
 // Window procedure for user-created windows
 //
 static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam)
@@ -1218,6 +1225,9 @@ static LRESULT CALLBACK windowProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM l
                              SWP_NOACTIVATE | SWP_NOZORDER);
             }
 
+            // The scale of a monitor may also have changed
+            _glfwInputMonitorChange(NULL);
+
             _glfwInputWindowContentScale(window, xscale, yscale);
             break;
         }
@@ -2463,6 +2473,250 @@ const char* _glfwGetClipboardStringWin32(void)
     return _glfw.win32.clipboardString;
 }
 
+void _glfwRequestClipboardStringWin32(void)
+{
+    // The clipboard contents are available without waiting for their owner
+    _glfwInputClipboardString(_glfwGetClipboardStringWin32());
+}
+
+void _glfwCancelClipboardRequestWin32(void)
+{
+}
+
+// Renders the data offered with glfwSetClipboardData in the specified format
+//
+void _glfwRenderClipboardDataWin32(UINT format)
+{
+    int index;
+    HANDLE object;
+    size_t size = 0;
+
+    if (!_glfw.clipboardData.callback || !_glfw.win32.clipboardFormats)
+        return;
+
+    for (index = 0;  index < _glfw.clipboardData.typeCount;  index++)
+    {
+        if (_glfw.win32.clipboardFormats[index] == format)
+            break;
+    }
+
+    if (index == _glfw.clipboardData.typeCount)
+        return;
+
+    const char* data =
+        _glfw.clipboardData.callback(_glfw.clipboardData.types[index], &size);
+    if (!data)
+        return;
+
+    if (format == CF_UNICODETEXT)
+    {
+        if (size > INT_MAX)
+            return;
+
+        const int length =
+            MultiByteToWideChar(CP_UTF8, 0, data, (int) size, NULL, 0);
+
+        object = GlobalAlloc(GMEM_MOVEABLE, (length + 1) * sizeof(WCHAR));
+        if (!object)
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to allocate global handle for clipboard");
+            return;
+        }
+
+        WCHAR* buffer = GlobalLock(object);
+        if (!buffer)
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to lock global handle");
+            GlobalFree(object);
+            return;
+        }
+
+        MultiByteToWideChar(CP_UTF8, 0, data, (int) size, buffer, length);
+        buffer[length] = L'\0';
+        GlobalUnlock(object);
+    }
+    else
+    {
+        object = GlobalAlloc(GMEM_MOVEABLE, size);
+        if (!object)
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to allocate global handle for clipboard");
+            return;
+        }
+
+        if (size)
+        {
+            void* buffer = GlobalLock(object);
+            if (!buffer)
+            {
+                _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                     "Win32: Failed to lock global handle");
+                GlobalFree(object);
+                return;
+            }
+
+            memcpy(buffer, data, size);
+            GlobalUnlock(object);
+        }
+    }
+
+    if (!SetClipboardData(format, object))
+        GlobalFree(object);
+}
+
+GLFWbool _glfwSetClipboardDataWin32(void)
+{
+    int tries = 0;
+    const int count = _glfw.clipboardData.typeCount;
+
+    UINT* formats = _glfw_calloc(count, sizeof(UINT));
+    if (!formats)
+        return GLFW_FALSE;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        formats[i] = getClipboardFormat(_glfw.clipboardData.types[i]);
+        if (!formats[i])
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to register clipboard format");
+            _glfw_free(formats);
+            return GLFW_FALSE;
+        }
+    }
+
+    // NOTE: Retry clipboard opening a few times as some other application may have it
+    //       open and also the Windows Clipboard History reads it after each update
+    while (!OpenClipboard(_glfw.win32.helperWindowHandle))
+    {
+        Sleep(1);
+        tries++;
+
+        if (tries == 3)
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to open clipboard");
+            _glfw_free(formats);
+            return GLFW_FALSE;
+        }
+    }
+
+    _glfw_free(_glfw.win32.clipboardFormats);
+    _glfw.win32.clipboardFormats = formats;
+
+    EmptyClipboard();
+
+    // The data is rendered by the helper window only when it is requested
+    for (int i = 0;  i < count;  i++)
+        SetClipboardData(formats[i], NULL);
+
+    CloseClipboard();
+    return GLFW_TRUE;
+}
+
+const void* _glfwGetClipboardDataWin32(const char* type, size_t* size)
+{
+    HANDLE object;
+    int tries = 0;
+
+    _glfw_free(_glfw.win32.clipboardData);
+    _glfw.win32.clipboardData = NULL;
+
+    if (GetClipboardOwner() == _glfw.win32.helperWindowHandle &&
+        _glfwClipboardDataOffered(type))
+    {
+        // The data is returned directly when the clipboard is ours
+        const void* data = _glfw.clipboardData.callback(type, size);
+        if (data)
+            return data;
+
+        *size = 0;
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Win32: Clipboard data is not available as %s", type);
+        return NULL;
+    }
+
+    const UINT format = getClipboardFormat(type);
+    if (!format)
+    {
+        _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                             "Win32: Failed to register clipboard format");
+        return NULL;
+    }
+
+    // NOTE: Retry clipboard opening a few times as some other application may have it
+    //       open and also the Windows Clipboard History reads it after each update
+    while (!OpenClipboard(_glfw.win32.helperWindowHandle))
+    {
+        Sleep(1);
+        tries++;
+
+        if (tries == 3)
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to open clipboard");
+            return NULL;
+        }
+    }
+
+    object = GetClipboardData(format);
+    if (!object)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Win32: Clipboard data is not available as %s", type);
+        CloseClipboard();
+        return NULL;
+    }
+
+    // NOTE: The size of a global memory object may be larger than the size of
+    //       the data it was allocated for
+    const SIZE_T objectSize = GlobalSize(object);
+    void* buffer = NULL;
+
+    if (objectSize)
+    {
+        buffer = GlobalLock(object);
+        if (!buffer)
+        {
+            _glfwInputErrorWin32(GLFW_PLATFORM_ERROR,
+                                 "Win32: Failed to lock global handle");
+            CloseClipboard();
+            return NULL;
+        }
+    }
+
+    if (format == CF_UNICODETEXT)
+    {
+        if (buffer)
+            _glfw.win32.clipboardData = _glfwCreateUTF8FromWideStringWin32(buffer);
+        else
+            _glfw.win32.clipboardData = _glfw_calloc(1, 1);
+
+        if (_glfw.win32.clipboardData)
+            *size = strlen(_glfw.win32.clipboardData);
+    }
+    else
+    {
+        _glfw.win32.clipboardData = _glfw_calloc(objectSize ? objectSize : 1, 1);
+        if (_glfw.win32.clipboardData)
+        {
+            if (buffer)
+                memcpy(_glfw.win32.clipboardData, buffer, objectSize);
+
+            *size = objectSize;
+        }
+    }
+
+    if (buffer)
+        GlobalUnlock(object);
+
+    CloseClipboard();
+    return _glfw.win32.clipboardData;
+}
+
 EGLenum _glfwGetEGLPlatformWin32(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -34,6 +34,280 @@
 #include <float.h>
 
 
+// Reports any coalesced cursor motion of all windows
+//
+static void flushCursorMotion(void)
+{
+    _GLFWwindow* window;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+        _glfwFlushCursorPos(window);
+}
+
+// Removes the batched events already available to the application, keeping
+// those received since then outside of event processing
+//
+static void clearEventBatch(void)
+{
+    const int remaining = _glfw.batch.count - _glfw.batch.returned;
+
+    memmove(_glfw.batch.events,
+            _glfw.batch.events + _glfw.batch.returned,
+            remaining * sizeof(GLFWevent));
+
+    _glfw.batch.count = remaining;
+    _glfw.batch.returned = 0;
+}
+
+// Creates a window and its context with the specified configuration
+//
+static _GLFWwindow* createWindow(const _GLFWwndconfig* wndconfig,
+                                 const _GLFWctxconfig* ctxconfig,
+                                 const _GLFWfbconfig* fbconfig,
+                                 _GLFWmonitor* monitor)
+{
+    _GLFWwindow* window = _glfw_calloc(1, sizeof(_GLFWwindow));
+    window->next = _glfw.windowListHead;
+    _glfw.windowListHead = window;
+
+    window->videoMode.width       = wndconfig->width;
+    window->videoMode.height      = wndconfig->height;
+    window->videoMode.redBits     = fbconfig->redBits;
+    window->videoMode.greenBits   = fbconfig->greenBits;
+    window->videoMode.blueBits    = fbconfig->blueBits;
+    window->videoMode.refreshRate = _glfw.hints.refreshRate;
+
+    window->monitor          = monitor;
+    window->resizable        = wndconfig->resizable;
+    window->decorated        = wndconfig->decorated;
+    window->autoIconify      = wndconfig->autoIconify;
+    window->floating         = wndconfig->floating;
+    window->focusOnShow      = wndconfig->focusOnShow;
+    window->mousePassthrough = wndconfig->mousePassthrough;
+    window->cursorMode       = GLFW_CURSOR_NORMAL;
+
+    window->doublebuffer = fbconfig->doublebuffer;
+
+    window->minwidth    = GLFW_DONT_CARE;
+    window->minheight   = GLFW_DONT_CARE;
+    window->maxwidth    = GLFW_DONT_CARE;
+    window->maxheight   = GLFW_DONT_CARE;
+    window->numer       = GLFW_DONT_CARE;
+    window->denom       = GLFW_DONT_CARE;
+    window->title       = _glfw_strdup(wndconfig->title);
+
+    if (!_glfw.platform.createWindow(window, wndconfig, ctxconfig, fbconfig))
+    {
+        glfwDestroyWindow((GLFWwindow*) window);
+        return NULL;
+    }
+
+    return window;
+}
+
+// Clears the window hints that are applied when a pooled window is handed out,
+// so that they do not affect which pool the window is taken from
+//
+static void clearHandOutHints(_GLFWwndconfig* wndconfig)
+{
+    wndconfig->xpos      = GLFW_ANY_POSITION;
+    wndconfig->ypos      = GLFW_ANY_POSITION;
+    wndconfig->width     = 0;
+    wndconfig->height    = 0;
+    wndconfig->title     = NULL;
+    wndconfig->visible   = GLFW_FALSE;
+    wndconfig->focused   = GLFW_FALSE;
+    wndconfig->maximized = GLFW_FALSE;
+}
+
+// Returns the window pool for the specified configuration, if any
+//
+static _GLFWwindowpool* findWindowPool(const _GLFWwndconfig* wndconfig,
+                                       const _GLFWctxconfig* ctxconfig,
+                                       const _GLFWfbconfig* fbconfig)
+{
+    _GLFWwindowpool* pool;
+
+    for (pool = _glfw.windowPoolListHead;  pool;  pool = pool->next)
+    {
+        if (memcmp(&pool->wndconfig, wndconfig, sizeof(_GLFWwndconfig)) == 0 &&
+            memcmp(&pool->ctxconfig, ctxconfig, sizeof(_GLFWctxconfig)) == 0 &&
+            memcmp(&pool->fbconfig, fbconfig, sizeof(_GLFWfbconfig)) == 0)
+        {
+            return pool;
+        }
+    }
+
+    return NULL;
+}
+
+// Destroys the idle windows of a pool and detaches the windows handed out
+// from it, so they are destroyed normally
+//
+static void destroyWindowPool(_GLFWwindowpool* pool)
+{
+    _GLFWwindowpool** prev = &_glfw.windowPoolListHead;
+    _GLFWwindow* window;
+    int i;
+
+    while (*prev != pool)
+        prev = &((*prev)->next);
+
+    *prev = pool->next;
+
+    for (window = _glfw.windowListHead;  window;  window = window->next)
+    {
+        if (window->pool == pool)
+            window->pool = NULL;
+    }
+
+    for (i = 0;  i < pool->count;  i++)
+        glfwDestroyWindow((GLFWwindow*) pool->windows[i]);
+
+    _glfw_free(pool->windows);
+    _glfw_free(pool);
+}
+
+// Hands out an idle window of a pool, made to look like it was just created
+// with the specified configuration
+//
+static _GLFWwindow* takePooledWindow(_GLFWwindowpool* pool,
+                                     const _GLFWwndconfig* wndconfig)
+{
+    _GLFWwindow* window = pool->windows[--pool->count];
+
+    window->videoMode.width       = wndconfig->width;
+    window->videoMode.height      = wndconfig->height;
+    window->videoMode.refreshRate = _glfw.hints.refreshRate;
+
+    if (strcmp(window->title, wndconfig->title) != 0)
+    {
+        char* prev = window->title;
+        window->title = _glfw_strdup(wndconfig->title);
+        _glfw.platform.setWindowTitle(window, wndconfig->title);
+        _glfw_free(prev);
+    }
+
+    _glfw.platform.setWindowSize(window, wndconfig->width, wndconfig->height);
+
+    // NOTE: Without position hints the window stays where it was last placed,
+    //       as there is no window manager placement to restore
+    if (wndconfig->xpos != GLFW_ANY_POSITION && wndconfig->ypos != GLFW_ANY_POSITION)
+        _glfw.platform.setWindowPos(window, wndconfig->xpos, wndconfig->ypos);
+
+    if (wndconfig->maximized)
+        _glfw.platform.maximizeWindow(window);
+
+    if (wndconfig->visible)
+    {
+        _glfw.platform.showWindow(window);
+        if (wndconfig->focused)
+            _glfw.platform.focusWindow(window);
+    }
+
+    return window;
+}
+
+// Returns a window being destroyed to its pool, in the state of a newly
+// created hidden window, if the pool has room for it and that state can be
+// restored
+//
+static GLFWbool returnPooledWindow(_GLFWwindow* window)
+{
+    _GLFWwindowpool* pool = window->pool;
+    const _GLFWwndconfig* wndconfig = &pool->wndconfig;
+
+    if (pool->count == pool->size || window->monitor)
+        return GLFW_FALSE;
+
+    // Restoring an iconified window would briefly show it
+    if (_glfw.platform.windowIconified(window))
+        return GLFW_FALSE;
+
+    if (_glfw.platform.windowMaximized(window))
+        _glfw.platform.restoreWindow(window);
+
+    _glfw.platform.hideWindow(window);
+
+    if (window->minwidth != GLFW_DONT_CARE || window->minheight != GLFW_DONT_CARE ||
+        window->maxwidth != GLFW_DONT_CARE || window->maxheight != GLFW_DONT_CARE)
+    {
+        window->minwidth  = GLFW_DONT_CARE;
+        window->minheight = GLFW_DONT_CARE;
+        window->maxwidth  = GLFW_DONT_CARE;
+        window->maxheight = GLFW_DONT_CARE;
+        _glfw.platform.setWindowSizeLimits(window,
+                                           GLFW_DONT_CARE, GLFW_DONT_CARE,
+                                           GLFW_DONT_CARE, GLFW_DONT_CARE);
+    }
+
+    if (window->numer != GLFW_DONT_CARE || window->denom != GLFW_DONT_CARE)
+    {
+        window->numer = GLFW_DONT_CARE;
+        window->denom = GLFW_DONT_CARE;
+        _glfw.platform.setWindowAspectRatio(window, GLFW_DONT_CARE, GLFW_DONT_CARE);
+    }
+
+    if (window->resizable != wndconfig->resizable)
+    {
+        window->resizable = wndconfig->resizable;
+        _glfw.platform.setWindowResizable(window, wndconfig->resizable);
+    }
+
+    if (window->decorated != wndconfig->decorated)
+    {
+        window->decorated = wndconfig->decorated;
+        _glfw.platform.setWindowDecorated(window, wndconfig->decorated);
+    }
+
+    if (window->floating != wndconfig->floating)
+    {
+        window->floating = wndconfig->floating;
+        _glfw.platform.setWindowFloating(window, wndconfig->floating);
+    }
+
+    if (window->mousePassthrough != wndconfig->mousePassthrough)
+    {
+        window->mousePassthrough = wndconfig->mousePassthrough;
+        _glfw.platform.setWindowMousePassthrough(window, wndconfig->mousePassthrough);
+    }
+
+    window->autoIconify = wndconfig->autoIconify;
+    window->focusOnShow = wndconfig->focusOnShow;
+
+    if (window->cursor)
+        glfwSetCursor((GLFWwindow*) window, NULL);
+
+    if (window->cursorMode != GLFW_CURSOR_NORMAL)
+    {
+        window->cursorMode = GLFW_CURSOR_NORMAL;
+        _glfw.platform.setCursorMode(window, GLFW_CURSOR_NORMAL);
+    }
+
+    if (window->rawMouseMotion)
+    {
+        window->rawMouseMotion = GLFW_FALSE;
+        _glfw.platform.setRawMouseMotion(window, GLFW_FALSE);
+    }
+
+    window->stickyKeys              = GLFW_FALSE;
+    window->stickyMouseButtons      = GLFW_FALSE;
+    window->lockKeyMods             = GLFW_FALSE;
+    window->disableMouseButtonLimit = GLFW_FALSE;
+    window->coalesceCursorMotion    = GLFW_FALSE;
+    window->cursorMotionPending     = GLFW_FALSE;
+    memset(window->keys, GLFW_RELEASE, sizeof(window->keys));
+    memset(window->mouseButtons, GLFW_RELEASE, sizeof(window->mouseButtons));
+
+    window->shouldClose = GLFW_FALSE;
+    window->userPointer = NULL;
+    window->recordId    = 0;
+
+    pool->windows[pool->count++] = window;
+    return GLFW_TRUE;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                         GLFW event API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -45,7 +319,18 @@ void _glfwInputWindowFocus(_GLFWwindow* window, GLFWbool focused)
     assert(window != NULL);
     assert(focused == GLFW_TRUE || focused == GLFW_FALSE);
 
-    if (window->callbacks.focus)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_FOCUS, focused, 0, 0, 0);
+
+    _glfwFlushCursorPos(window);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_WINDOW_FOCUS);
+        if (event)
+            event->data.state = focused;
+    }
+    else if (window->callbacks.focus)
         window->callbacks.focus((GLFWwindow*) window, focused);
 
     if (!focused)
@@ -76,7 +361,19 @@ void _glfwInputWindowPos(_GLFWwindow* window, int x, int y)
 {
     assert(window != NULL);
 
-    if (window->callbacks.pos)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_POS, x, y, 0, 0);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_WINDOW_POS);
+        if (event)
+        {
+            event->data.pos.x = x;
+            event->data.pos.y = y;
+        }
+    }
+    else if (window->callbacks.pos)
         window->callbacks.pos((GLFWwindow*) window, x, y);
 }
 
@@ -89,7 +386,19 @@ void _glfwInputWindowSize(_GLFWwindow* window, int width, int height)
     assert(width >= 0);
     assert(height >= 0);
 
-    if (window->callbacks.size)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_SIZE, width, height, 0, 0);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_WINDOW_SIZE);
+        if (event)
+        {
+            event->data.size.width = width;
+            event->data.size.height = height;
+        }
+    }
+    else if (window->callbacks.size)
         window->callbacks.size((GLFWwindow*) window, width, height);
 }
 
@@ -100,7 +409,16 @@ void _glfwInputWindowIconify(_GLFWwindow* window, GLFWbool iconified)
     assert(window != NULL);
     assert(iconified == GLFW_TRUE || iconified == GLFW_FALSE);
 
-    if (window->callbacks.iconify)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_ICONIFY, iconified, 0, 0, 0);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_WINDOW_ICONIFY);
+        if (event)
+            event->data.state = iconified;
+    }
+    else if (window->callbacks.iconify)
         window->callbacks.iconify((GLFWwindow*) window, iconified);
 }
 
@@ -111,7 +429,16 @@ void _glfwInputWindowMaximize(_GLFWwindow* window, GLFWbool maximized)
     assert(window != NULL);
     assert(maximized == GLFW_TRUE || maximized == GLFW_FALSE);
 
-    if (window->callbacks.maximize)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_MAXIMIZE, maximized, 0, 0, 0);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_WINDOW_MAXIMIZE);
+        if (event)
+            event->data.state = maximized;
+    }
+    else if (window->callbacks.maximize)
         window->callbacks.maximize((GLFWwindow*) window, maximized);
 }
 
@@ -124,7 +451,19 @@ void _glfwInputFramebufferSize(_GLFWwindow* window, int width, int height)
     assert(width >= 0);
     assert(height >= 0);
 
-    if (window->callbacks.fbsize)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_FRAMEBUFFER_SIZE, width, height, 0, 0);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_FRAMEBUFFER_SIZE);
+        if (event)
+        {
+            event->data.size.width = width;
+            event->data.size.height = height;
+        }
+    }
+    else if (window->callbacks.fbsize)
         window->callbacks.fbsize((GLFWwindow*) window, width, height);
 }
 
@@ -139,7 +478,19 @@ void _glfwInputWindowContentScale(_GLFWwindow* window, float xscale, float yscal
     assert(yscale > 0.f);
     assert(yscale < FLT_MAX);
 
-    if (window->callbacks.scale)
+    if (_glfw.recording.file)
+        _glfwRecordEventf(window, GLFW_EVENT_WINDOW_CONTENT_SCALE, xscale, yscale);
+
+    if (window->batchEvents)
+    {
+        GLFWevent* event = _glfwInputEvent(window, GLFW_EVENT_WINDOW_CONTENT_SCALE);
+        if (event)
+        {
+            event->data.scale.x = xscale;
+            event->data.scale.y = yscale;
+        }
+    }
+    else if (window->callbacks.scale)
         window->callbacks.scale((GLFWwindow*) window, xscale, yscale);
 }
 
@@ -149,7 +500,12 @@ void _glfwInputWindowDamage(_GLFWwindow* window)
 {
     assert(window != NULL);
 
-    if (window->callbacks.refresh)
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_REFRESH, 0, 0, 0, 0);
+
+    if (window->batchEvents)
+        _glfwInputEvent(window, GLFW_EVENT_WINDOW_REFRESH);
+    else if (window->callbacks.refresh)
         window->callbacks.refresh((GLFWwindow*) window);
 }
 
@@ -159,9 +515,14 @@ void _glfwInputWindowCloseRequest(_GLFWwindow* window)
 {
     assert(window != NULL);
 
+    if (_glfw.recording.file)
+        _glfwRecordEvent(window, GLFW_EVENT_WINDOW_CLOSE, 0, 0, 0, 0);
+
     window->shouldClose = GLFW_TRUE;
 
-    if (window->callbacks.close)
+    if (window->batchEvents)
+        _glfwInputEvent(window, GLFW_EVENT_WINDOW_CLOSE);
+    else if (window->callbacks.close)
         window->callbacks.close((GLFWwindow*) window);
 }
 
@@ -173,6 +534,19 @@ void _glfwInputWindowMonitor(_GLFWwindow* window, _GLFWmonitor* monitor)
     window->monitor = monitor;
 }
 
+//////////////////////////////////////////////////////////////////////////
+//////                       GLFW internal API                      //////
+//////////////////////////////////////////////////////////////////////////
+
+// Destroys all window pools and their idle windows
+//
+void _glfwTerminateWindowPools(void)
+{
+    while (_glfw.windowPoolListHead)
+        destroyWindowPool(_glfw.windowPoolListHead);
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW public API                       //////
 //////////////////////////////////////////////////////////////////////////
@@ -185,7 +559,6 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     _GLFWfbconfig fbconfig;
     _GLFWctxconfig ctxconfig;
     _GLFWwndconfig wndconfig;
-    _GLFWwindow* window;
 
     assert(title != NULL);
     assert(width >= 0);
@@ -214,43 +587,101 @@ GLFWAPI GLFWwindow* glfwCreateWindow(int width, int height,
     if (!_glfwIsValidContextConfig(&ctxconfig))
         return NULL;
 
-    window = _glfw_calloc(1, sizeof(_GLFWwindow));
-    window->next = _glfw.windowListHead;
-    _glfw.windowListHead = window;
+    if (!monitor)
+    {
+        _GLFWwndconfig pooled = wndconfig;
+        clearHandOutHints(&pooled);
 
-    window->videoMode.width       = width;
-    window->videoMode.height      = height;
-    window->videoMode.redBits     = fbconfig.redBits;
-    window->videoMode.greenBits   = fbconfig.greenBits;
-    window->videoMode.blueBits    = fbconfig.blueBits;
-    window->videoMode.refreshRate = _glfw.hints.refreshRate;
+        _GLFWwindowpool* pool = findWindowPool(&pooled, &ctxconfig, &fbconfig);
+        if (pool && pool->count)
+            return (GLFWwindow*) takePooledWindow(pool, &wndconfig);
+    }
 
-    window->monitor          = (_GLFWmonitor*) monitor;
-    window->resizable        = wndconfig.resizable;
-    window->decorated        = wndconfig.decorated;
-    window->autoIconify      = wndconfig.autoIconify;
-    window->floating         = wndconfig.floating;
-    window->focusOnShow      = wndconfig.focusOnShow;
-    window->mousePassthrough = wndconfig.mousePassthrough;
-    window->cursorMode       = GLFW_CURSOR_NORMAL;
+    return (GLFWwindow*) createWindow(&wndconfig, &ctxconfig, &fbconfig,
+                                      (_GLFWmonitor*) monitor);
+}
 
-    window->doublebuffer = fbconfig.doublebuffer;
+GLFWAPI int glfwPoolWindows(int count, GLFWwindow* share)
+{
+    _GLFWfbconfig fbconfig;
+    _GLFWctxconfig ctxconfig;
+    _GLFWwndconfig wndconfig;
+    _GLFWwindowpool* pool;
 
-    window->minwidth    = GLFW_DONT_CARE;
-    window->minheight   = GLFW_DONT_CARE;
-    window->maxwidth    = GLFW_DONT_CARE;
-    window->maxheight   = GLFW_DONT_CARE;
-    window->numer       = GLFW_DONT_CARE;
-    window->denom       = GLFW_DONT_CARE;
-    window->title       = _glfw_strdup(title);
+    assert(count >= 0);
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(GLFW_FALSE);
 
-    if (!_glfw.platform.createWindow(window, &wndconfig, &ctxconfig, &fbconfig))
+    if (count < 0)
     {
+        _glfwInputError(GLFW_INVALID_VALUE, "Invalid window pool size %i", count);
+        return GLFW_FALSE;
+    }
+
+    fbconfig  = _glfw.hints.framebuffer;
+    ctxconfig = _glfw.hints.context;
+    wndconfig = _glfw.hints.window;
+
+    ctxconfig.share = (_GLFWwindow*) share;
+    clearHandOutHints(&wndconfig);
+
+    if (wndconfig.scaleToMonitor)
+    {
+        // The initial size of these windows depends on where they are placed
+        _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
+                        "Windows scaled to their monitor cannot be pooled");
+        return GLFW_FALSE;
+    }
+
+    if (!_glfwIsValidContextConfig(&ctxconfig))
+        return GLFW_FALSE;
+
+    pool = findWindowPool(&wndconfig, &ctxconfig, &fbconfig);
+    if (!pool)
+    {
+        if (count == 0)
+            return GLFW_TRUE;
+
+        pool = _glfw_calloc(1, sizeof(_GLFWwindowpool));
+        pool->fbconfig  = fbconfig;
+        pool->ctxconfig = ctxconfig;
+        pool->wndconfig = wndconfig;
+        pool->next = _glfw.windowPoolListHead;
+        _glfw.windowPoolListHead = pool;
+    }
+
+    if (count == 0)
+    {
+        destroyWindowPool(pool);
+        return GLFW_TRUE;
+    }
+
+    while (pool->count > count)
+    {
+        _GLFWwindow* window = pool->windows[--pool->count];
+        window->pool = NULL;
         glfwDestroyWindow((GLFWwindow*) window);
-        return NULL;
     }
 
-    return (GLFWwindow*) window;
+    pool->windows = _glfw_realloc(pool->windows, count * sizeof(_GLFWwindow*));
+    pool->size = count;
+
+    // The size and title are replaced when the window is handed out
+    wndconfig.width  = 640;
+    wndconfig.height = 480;
+    wndconfig.title  = "";
+
+    while (pool->count < count)
+    {
+        _GLFWwindow* window = createWindow(&wndconfig, &ctxconfig, &fbconfig, NULL);
+        if (!window)
+            return GLFW_FALSE;
+
+        window->pool = pool;
+        pool->windows[pool->count++] = window;
+    }
+
+    return GLFW_TRUE;
 }
 
 void glfwDefaultWindowHints(void)
@@ -477,12 +908,50 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
 
     // Clear all callbacks to avoid exposing a half torn-down window object
     memset(&window->callbacks, 0, sizeof(window->callbacks));
+    window->batchEvents = GLFW_FALSE;
+
+    _glfwCancelClipboardRequest(window);
+
+    // Remove any batched events referring to the window
+    {
+        int i, count = 0, returned = 0;
+
+        for (i = 0;  i < _glfw.batch.count;  i++)
+        {
+            if (_glfw.batch.events[i].window != handle)
+            {
+                if (i < _glfw.batch.returned)
+                    returned++;
+
+                _glfw.batch.events[count++] = _glfw.batch.events[i];
+            }
+        }
+
+        _glfw.batch.count = count;
+        _glfw.batch.returned = returned;
+    }
 
     // The window's context must not be current on another thread when the
     // window is destroyed
     if (window == _glfwPlatformGetTls(&_glfw.contextSlot))
         glfwMakeContextCurrent(NULL);
 
+    if (window->pool && returnPooledWindow(window))
+        return;
+
+    // Pools of windows sharing objects with this one may not be found again
+    {
+        _GLFWwindowpool* pool = _glfw.windowPoolListHead;
+
+        while (pool)
+        {
+            _GLFWwindowpool* next = pool->next;
+            if (pool->ctxconfig.share == window)
+                destroyWindowPool(pool);
+            pool = next;
+        }
+    }
+
     _glfw.platform.destroyWindow(window);
 
     // Unlink window from global linked list
@@ -495,6 +964,9 @@ GLFWAPI void glfwDestroyWindow(GLFWwindow* handle)
         *prev = window->next;
     }
 
+    _glfwReleaseProcTable(window);
+    _glfw_free(window->context.extensionSlots);
+    _glfw_free(window->context.extensionNames);
     _glfw_free(window->title);
     _glfw_free(window);
 }
@@ -576,6 +1048,10 @@ GLFWAPI void glfwSetWindowIcon(GLFWwindow* handle,
         }
     }
 
+    // The icon cannot be removed on every platform, so the window is not
+    // returned to its pool
+    window->pool = NULL;
+
     _glfw.platform.setWindowIcon(window, count, images);
 }
 
@@ -792,6 +1268,9 @@ GLFWAPI void glfwSetWindowOpacity(GLFWwindow* handle, float opacity)
         return;
     }
 
+    // The opacity is not reset when the window is returned to its pool
+    window->pool = NULL;
+
     _glfw.platform.setWindowOpacity(window, opacity);
 }
 
@@ -1167,13 +1646,28 @@ GLFWAPI GLFWwindowcontentscalefun glfwSetWindowContentScaleCallback(GLFWwindow*
 GLFWAPI void glfwPollEvents(void)
 {
     _GLFW_REQUIRE_INIT();
+    clearEventBatch();
     _glfw.platform.pollEvents();
+    flushCursorMotion();
+    _glfwUpdateClipboardRequests();
+    _glfw.batch.returned = _glfw.batch.count;
 }
 
 GLFWAPI void glfwWaitEvents(void)
 {
     _GLFW_REQUIRE_INIT();
-    _glfw.platform.waitEvents();
+    clearEventBatch();
+
+    // Wake up in time to report clipboard requests that time out
+    const double timeout = _glfwGetClipboardRequestTimeout();
+    if (timeout < 0.0)
+        _glfw.platform.waitEvents();
+    else
+        _glfw.platform.waitEventsTimeout(timeout);
+
+    flushCursorMotion();
+    _glfwUpdateClipboardRequests();
+    _glfw.batch.returned = _glfw.batch.count;
 }
 
 GLFWAPI void glfwWaitEventsTimeout(double timeout)
@@ -1189,7 +1683,17 @@ GLFWAPI void glfwWaitEventsTimeout(double timeout)
         return;
     }
 
+    clearEventBatch();
+
+    // Wake up in time to report clipboard requests that time out
+    const double clipboardTimeout = _glfwGetClipboardRequestTimeout();
+    if (clipboardTimeout >= 0.0 && clipboardTimeout < timeout)
+        timeout = clipboardTimeout;
+
     _glfw.platform.waitEventsTimeout(timeout);
+    flushCursorMotion();
+    _glfwUpdateClipboardRequests();
+    _glfw.batch.returned = _glfw.batch.count;
 }
 
 GLFWAPI void glfwPostEmptyEvent(void)
@@ -1198,3 +1702,22 @@ GLFWAPI void glfwPostEmptyEvent(void)
     _glfw.platform.postEmptyEvent();
 }
 
+GLFWAPI const GLFWevent* glfwGetEventBatch(int* count)
+{
+    assert(count != NULL);
+
+    *count = 0;
+
+    _GLFW_REQUIRE_INIT_OR_RETURN(NULL);
+
+    if (!_glfw.batch.count)
+        return NULL;
+
+    // Events received outside of event processing are returned here at most
+    // once, instead of again after the next event processing call
+    _glfw.batch.returned = _glfw.batch.count;
+
+    *count = _glfw.batch.count;
+    return _glfw.batch.events;
+}
+
@@ -395,6 +395,23 @@ static void createKeyTables(void)
     }
 }
 
+// Loads the cursor theme at the normal and the doubled size
+// This may be run on the cursor preload thread
+//
+static void loadCursorThemes(void* argument)
+{
+    struct wl_shm* shm = _glfw.wl.cursorShm ? _glfw.wl.cursorShm : _glfw.wl.shm;
+
+    _glfw.wl.cursorTheme = wl_cursor_theme_load(_glfw.wl.cursorThemeName,
+                                                _glfw.wl.cursorSize,
+                                                shm);
+
+    // If this happens to be NULL, we just fallback to the scale=1 version.
+    _glfw.wl.cursorThemeHiDPI = wl_cursor_theme_load(_glfw.wl.cursorThemeName,
+                                                     _glfw.wl.cursorSize * 2,
+                                                     shm);
+}
+
 static GLFWbool loadCursorTheme(void)
 {
     int cursorSize = 16;
@@ -409,8 +426,40 @@ static GLFWbool loadCursorTheme(void)
     }
 
     const char* themeName = getenv("XCURSOR_THEME");
+    if (themeName)
+        _glfw.wl.cursorThemeName = _glfw_strdup(themeName);
+
+    _glfw.wl.cursorSize = cursorSize;
+
+    _glfw.wl.cursorSurface = wl_compositor_create_surface(_glfw.wl.compositor);
+    _glfw.wl.cursorTimerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+
+    if (_glfw.hints.init.preloadCursors)
+    {
+        // NOTE: The preload thread must not use the shm global, as the main
+        //       thread may be dispatching events for it meanwhile, so it uses
+        //       a wrapper with its own event queue instead
+        // NOTE: The shm pools of the themes and every buffer later created from
+        //       them inherit that queue, which is dispatched with the main one
+        _glfw.wl.cursorQueue = wl_display_create_queue(_glfw.wl.display);
+        if (_glfw.wl.cursorQueue)
+        {
+            _glfw.wl.cursorShm = wl_proxy_create_wrapper(_glfw.wl.shm);
+            if (_glfw.wl.cursorShm)
+            {
+                wl_proxy_set_queue((struct wl_proxy*) _glfw.wl.cursorShm,
+                                   _glfw.wl.cursorQueue);
+            }
+        }
+
+        // A theme that fails to load in the background is reported when first
+        // used
+        if (_glfw.wl.cursorShm && _glfwStartCursorPreload(loadCursorThemes))
+            return GLFW_TRUE;
+    }
+
+    loadCursorThemes(NULL);
 
-    _glfw.wl.cursorTheme = wl_cursor_theme_load(themeName, cursorSize, _glfw.wl.shm);
     if (!_glfw.wl.cursorTheme)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -418,12 +467,6 @@ static GLFWbool loadCursorTheme(void)
         return GLFW_FALSE;
     }
 
-    // If this happens to be NULL, we just fallback to the scale=1 version.
-    _glfw.wl.cursorThemeHiDPI =
-        wl_cursor_theme_load(themeName, cursorSize * 2, _glfw.wl.shm);
-
-    _glfw.wl.cursorSurface = wl_compositor_create_surface(_glfw.wl.compositor);
-    _glfw.wl.cursorTimerfd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
     return GLFW_TRUE;
 }
 
@@ -452,6 +495,10 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeWayland,
         .setClipboardString = _glfwSetClipboardStringWayland,
         .getClipboardString = _glfwGetClipboardStringWayland,
+        .requestClipboardString = _glfwRequestClipboardStringWayland,
+        .cancelClipboardRequest = _glfwCancelClipboardRequestWayland,
+        .setClipboardData = _glfwSetClipboardDataWayland,
+        .getClipboardData = _glfwGetClipboardDataWayland,
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
         .initJoysticks = _glfwInitJoysticksLinux,
         .terminateJoysticks = _glfwTerminateJoysticksLinux,
@@ -473,6 +520,7 @@ GLFWbool _glfwConnectWayland(int platformID, _GLFWplatform* platform)
         .getVideoMode = _glfwGetVideoModeWayland,
         .getGammaRamp = _glfwGetGammaRampWayland,
         .setGammaRamp = _glfwSetGammaRampWayland,
+        .flushGammaRamps = _glfwFlushGammaRampsWayland,
         .createWindow = _glfwCreateWindowWayland,
         .destroyWindow = _glfwDestroyWindowWayland,
         .setWindowTitle = _glfwSetWindowTitleWayland,
@@ -566,6 +614,8 @@ int _glfwInitWayland(void)
     // These must be set before any failure checks
     _glfw.wl.keyRepeatTimerfd = -1;
     _glfw.wl.cursorTimerfd = -1;
+    _glfw.wl.clipboardRequest.fd = -1;
+    _glfw.wl.emptyEvent.fds[0] = _glfw.wl.emptyEvent.fds[1] = -1;
 
     _glfw.wl.tag = glfwGetVersionString();
 
@@ -607,6 +657,18 @@ int _glfwInitWayland(void)
         _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_proxy_get_version");
     _glfw.wl.client.proxy_marshal_flags = (PFN_wl_proxy_marshal_flags)
         _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_proxy_marshal_flags");
+    _glfw.wl.client.display_create_queue = (PFN_wl_display_create_queue)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_create_queue");
+    _glfw.wl.client.display_dispatch_queue_pending = (PFN_wl_display_dispatch_queue_pending)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_display_dispatch_queue_pending");
+    _glfw.wl.client.event_queue_destroy = (PFN_wl_event_queue_destroy)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_event_queue_destroy");
+    _glfw.wl.client.proxy_create_wrapper = (PFN_wl_proxy_create_wrapper)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_proxy_create_wrapper");
+    _glfw.wl.client.proxy_wrapper_destroy = (PFN_wl_proxy_wrapper_destroy)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_proxy_wrapper_destroy");
+    _glfw.wl.client.proxy_set_queue = (PFN_wl_proxy_set_queue)
+        _glfwPlatformGetModuleSymbol(_glfw.wl.client.handle, "wl_proxy_set_queue");
 
     if (!_glfw.wl.client.display_flush ||
         !_glfw.wl.client.display_cancel_read ||
@@ -624,7 +686,13 @@ int _glfwInitWayland(void)
         !_glfw.wl.client.proxy_get_user_data ||
         !_glfw.wl.client.proxy_set_user_data ||
         !_glfw.wl.client.proxy_get_tag ||
-        !_glfw.wl.client.proxy_set_tag)
+        !_glfw.wl.client.proxy_set_tag ||
+        !_glfw.wl.client.display_create_queue ||
+        !_glfw.wl.client.display_dispatch_queue_pending ||
+        !_glfw.wl.client.event_queue_destroy ||
+        !_glfw.wl.client.proxy_create_wrapper ||
+        !_glfw.wl.client.proxy_wrapper_destroy ||
+        !_glfw.wl.client.proxy_set_queue)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Wayland: Failed to load libwayland-client entry point");
@@ -834,6 +902,9 @@ int _glfwInitWayland(void)
 
     createKeyTables();
 
+    if (!_glfwCreateEmptyEventPOSIX(&_glfw.wl.emptyEvent))
+        return GLFW_FALSE;
+
     _glfw.wl.xkb.context = xkb_context_new(0);
     if (!_glfw.wl.xkb.context)
     {
@@ -894,6 +965,9 @@ int _glfwInitWayland(void)
 
 void _glfwTerminateWayland(void)
 {
+    // The cursor theme may still be loading from the Wayland objects below
+    _glfwFinishCursorPreload();
+
     _glfwTerminateEGL();
     _glfwTerminateOSMesa();
 
@@ -937,6 +1011,12 @@ void _glfwTerminateWayland(void)
         wl_cursor_theme_destroy(_glfw.wl.cursorTheme);
     if (_glfw.wl.cursorThemeHiDPI)
         wl_cursor_theme_destroy(_glfw.wl.cursorThemeHiDPI);
+    // The themes were the only users of the cursor queue
+    if (_glfw.wl.cursorShm)
+        wl_proxy_wrapper_destroy(_glfw.wl.cursorShm);
+    if (_glfw.wl.cursorQueue)
+        wl_event_queue_destroy(_glfw.wl.cursorQueue);
+    _glfw_free(_glfw.wl.cursorThemeName);
     if (_glfw.wl.cursor.handle)
     {
         _glfwPlatformFreeModule(_glfw.wl.cursor.handle);
@@ -1001,7 +1081,11 @@ void _glfwTerminateWayland(void)
     if (_glfw.wl.cursorTimerfd >= 0)
         close(_glfw.wl.cursorTimerfd);
 
+    _glfwDestroyEmptyEventPOSIX(&_glfw.wl.emptyEvent);
+
+    _glfwCancelClipboardRequestWayland();
     _glfw_free(_glfw.wl.clipboardString);
+    _glfw_free(_glfw.wl.clipboardData);
 }
 
 #endif // _GLFW_WAYLAND
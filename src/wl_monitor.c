@@ -90,6 +90,9 @@ static void outputHandleDone(void* userData, struct wl_output* output)
 {
     struct _GLFWmonitor* monitor = userData;
 
+    // This ends every batch of output changes
+    _glfwInputMonitorChange(monitor);
+
     if (monitor->widthMM <= 0 || monitor->heightMM <= 0)
     {
         // If Wayland does not provide a physical size, assume the default 96 DPI
@@ -246,10 +249,15 @@ GLFWbool _glfwGetGammaRampWayland(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     return GLFW_FALSE;
 }
 
-void _glfwSetGammaRampWayland(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
+GLFWbool _glfwSetGammaRampWayland(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     _glfwInputError(GLFW_FEATURE_UNAVAILABLE,
                     "Wayland: Gamma ramp access is not available");
+    return GLFW_FALSE;
+}
+
+void _glfwFlushGammaRampsWayland(void)
+{
 }
 
 
@@ -64,6 +64,12 @@ typedef void (* PFN_wl_proxy_set_tag)(struct wl_proxy*,const char*const*);
 typedef const char* const* (* PFN_wl_proxy_get_tag)(struct wl_proxy*);
 typedef uint32_t (* PFN_wl_proxy_get_version)(struct wl_proxy*);
 typedef struct wl_proxy* (* PFN_wl_proxy_marshal_flags)(struct wl_proxy*,uint32_t,const struct wl_interface*,uint32_t,uint32_t,...);
+typedef struct wl_event_queue* (* PFN_wl_display_create_queue)(struct wl_display*);
+typedef int (* PFN_wl_display_dispatch_queue_pending)(struct wl_display*,struct wl_event_queue*);
+typedef void (* PFN_wl_event_queue_destroy)(struct wl_event_queue*);
+typedef void* (* PFN_wl_proxy_create_wrapper)(void*);
+typedef void (* PFN_wl_proxy_wrapper_destroy)(void*);
+typedef void (* PFN_wl_proxy_set_queue)(struct wl_proxy*,struct wl_event_queue*);
 #define wl_display_flush _glfw.wl.client.display_flush
 #define wl_display_cancel_read _glfw.wl.client.display_cancel_read
 #define wl_display_dispatch_pending _glfw.wl.client.display_dispatch_pending
@@ -83,6 +89,12 @@ typedef struct wl_proxy* (* PFN_wl_proxy_marshal_flags)(struct wl_proxy*,uint32_
 #define wl_proxy_set_tag _glfw.wl.client.proxy_set_tag
 #define wl_proxy_get_version _glfw.wl.client.proxy_get_version
 #define wl_proxy_marshal_flags _glfw.wl.client.proxy_marshal_flags
+#define wl_display_create_queue _glfw.wl.client.display_create_queue
+#define wl_display_dispatch_queue_pending _glfw.wl.client.display_dispatch_queue_pending
+#define wl_event_queue_destroy _glfw.wl.client.event_queue_destroy
+#define wl_proxy_create_wrapper _glfw.wl.client.proxy_create_wrapper
+#define wl_proxy_wrapper_destroy _glfw.wl.client.proxy_wrapper_destroy
+#define wl_proxy_set_queue _glfw.wl.client.proxy_set_queue
 
 struct wl_shm;
 struct wl_output;
@@ -443,6 +455,7 @@ typedef struct _GLFWlibraryWayland
     unsigned int                offerCount;
 
     struct wl_data_offer*       selectionOffer;
+    GLFWbool                    selectionOfferText;
     struct wl_data_source*      selectionSource;
 
     struct wl_data_offer*       dragOffer;
@@ -451,20 +464,37 @@ typedef struct _GLFWlibraryWayland
 
     const char*                 tag;
 
+    char*                       cursorThemeName;
+    int                         cursorSize;
     struct wl_cursor_theme*     cursorTheme;
     struct wl_cursor_theme*     cursorThemeHiDPI;
+    // Used instead of the shm global when the themes are loaded on the cursor
+    // preload thread, along with the queue of the objects created from it
+    struct wl_shm*              cursorShm;
+    struct wl_event_queue*      cursorQueue;
     struct wl_surface*          cursorSurface;
     const char*                 cursorPreviousName;
     int                         cursorTimerfd;
     uint32_t                    serial;
     uint32_t                    pointerEnterSerial;
 
+    _GLFWemptyeventPOSIX        emptyEvent;
+
     int                         keyRepeatTimerfd;
     int32_t                     keyRepeatRate;
     int32_t                     keyRepeatDelay;
     int                         keyRepeatScancode;
 
     char*                       clipboardString;
+    // Clipboard data returned by the last glfwGetClipboardData
+    char*                       clipboardData;
+    // Data offer pipe read for glfwRequestClipboardString
+    struct {
+        int                     fd;
+        char*                   string;
+        size_t                  length;
+        size_t                  size;
+    } clipboardRequest;
     short int                   keycodes[256];
     short int                   scancodes[GLFW_KEY_LAST + 1];
     char                        keynames[GLFW_KEY_LAST + 1][5];
@@ -534,6 +564,12 @@ typedef struct _GLFWlibraryWayland
         PFN_wl_proxy_set_tag                        proxy_set_tag;
         PFN_wl_proxy_get_version                    proxy_get_version;
         PFN_wl_proxy_marshal_flags                  proxy_marshal_flags;
+        PFN_wl_display_create_queue                 display_create_queue;
+        PFN_wl_display_dispatch_queue_pending       display_dispatch_queue_pending;
+        PFN_wl_event_queue_destroy                  event_queue_destroy;
+        PFN_wl_proxy_create_wrapper                 proxy_create_wrapper;
+        PFN_wl_proxy_wrapper_destroy                proxy_wrapper_destroy;
+        PFN_wl_proxy_set_queue                      proxy_set_queue;
     } client;
 
     struct {
@@ -668,6 +704,10 @@ void _glfwDestroyCursorWayland(_GLFWcursor* cursor);
 void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringWayland(const char* string);
 const char* _glfwGetClipboardStringWayland(void);
+void _glfwRequestClipboardStringWayland(void);
+void _glfwCancelClipboardRequestWayland(void);
+GLFWbool _glfwSetClipboardDataWayland(void);
+const void* _glfwGetClipboardDataWayland(const char* type, size_t* size);
 
 EGLenum _glfwGetEGLPlatformWayland(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayWayland(void);
@@ -684,7 +724,8 @@ void _glfwGetMonitorWorkareaWayland(_GLFWmonitor* monitor, int* xpos, int* ypos,
 GLFWvidmode* _glfwGetVideoModesWayland(_GLFWmonitor* monitor, int* count);
 GLFWbool _glfwGetVideoModeWayland(_GLFWmonitor* monitor, GLFWvidmode* mode);
 GLFWbool _glfwGetGammaRampWayland(_GLFWmonitor* monitor, GLFWgammaramp* ramp);
-void _glfwSetGammaRampWayland(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+GLFWbool _glfwSetGammaRampWayland(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+void _glfwFlushGammaRampsWayland(void);
 
 void _glfwAddOutputWayland(uint32_t name, uint32_t version);
 void _glfwUpdateBufferScaleFromOutputsWayland(_GLFWwindow* window);
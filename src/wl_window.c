@@ -170,17 +170,15 @@ static struct wl_buffer* createShmBuffer(const GLFWimage* image)
 
     close(fd);
 
-    unsigned char* source = (unsigned char*) image->pixels;
-    unsigned char* target = data;
-    for (int i = 0;  i < image->width * image->height;  i++, source += 4)
-    {
-        unsigned int alpha = source[3];
-
-        *target++ = (unsigned char) ((source[2] * alpha) / 255);
-        *target++ = (unsigned char) ((source[1] * alpha) / 255);
-        *target++ = (unsigned char) ((source[0] * alpha) / 255);
-        *target++ = (unsigned char) alpha;
-    }
+    uint32_t* target = data;
+    _glfwConvertRGBAtoPremultipliedARGB32(image->pixels, target,
+                                          image->width * image->height);
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    // The channels of wl_shm formats are in little-endian order
+    for (int i = 0;  i < image->width * image->height;  i++)
+        target[i] = __builtin_bswap32(target[i]);
+#endif
 
     struct wl_buffer* buffer =
         wl_shm_pool_create_buffer(pool, 0,
@@ -1202,21 +1200,102 @@ static void inputText(_GLFWwindow* window, uint32_t scancode)
     }
 }
 
+// Reports the result of the data offer pipe read for
+// glfwRequestClipboardString
+//
+static void finishClipboardRequest(GLFWbool success)
+{
+    char* string = _glfw.wl.clipboardRequest.string;
+
+    if (success)
+        string[_glfw.wl.clipboardRequest.length] = '\0';
+    else
+    {
+        _glfw_free(string);
+        string = NULL;
+    }
+
+    close(_glfw.wl.clipboardRequest.fd);
+
+    // The callbacks may make new requests
+    memset(&_glfw.wl.clipboardRequest, 0, sizeof(_glfw.wl.clipboardRequest));
+    _glfw.wl.clipboardRequest.fd = -1;
+
+    _glfwInputClipboardString(string);
+    _glfw_free(string);
+}
+
+// Reads the available data from the data offer pipe of
+// glfwRequestClipboardString and returns whether the read has finished
+//
+static GLFWbool readClipboardRequest(void)
+{
+    for (;;)
+    {
+        const size_t readSize = 4096;
+        const size_t requiredSize = _glfw.wl.clipboardRequest.length + readSize + 1;
+        if (requiredSize > _glfw.wl.clipboardRequest.size)
+        {
+            size_t size = _glfw.wl.clipboardRequest.size * 2;
+            if (size < requiredSize)
+                size = requiredSize;
+
+            char* longer = _glfw_realloc(_glfw.wl.clipboardRequest.string, size);
+            if (!longer)
+            {
+                finishClipboardRequest(GLFW_FALSE);
+                return GLFW_TRUE;
+            }
+
+            _glfw.wl.clipboardRequest.string = longer;
+            _glfw.wl.clipboardRequest.size = size;
+        }
+
+        const ssize_t result = read(_glfw.wl.clipboardRequest.fd,
+                                    _glfw.wl.clipboardRequest.string +
+                                    _glfw.wl.clipboardRequest.length,
+                                    _glfw.wl.clipboardRequest.size -
+                                    _glfw.wl.clipboardRequest.length - 1);
+        if (result == 0)
+        {
+            finishClipboardRequest(GLFW_TRUE);
+            return GLFW_TRUE;
+        }
+        else if (result == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno == EAGAIN)
+                return GLFW_FALSE;
+
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "Wayland: Failed to read from data offer pipe: %s",
+                            strerror(errno));
+            finishClipboardRequest(GLFW_FALSE);
+            return GLFW_TRUE;
+        }
+
+        _glfw.wl.clipboardRequest.length += result;
+    }
+}
+
 static void handleEvents(double* timeout)
 {
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwPollJoysticksLinux();
 #endif
 
     GLFWbool event = GLFW_FALSE;
-    enum { DISPLAY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD };
+    enum { DISPLAY_FD, EMPTY_FD, KEYREPEAT_FD, CURSOR_FD, LIBDECOR_FD, CLIPBOARD_FD };
     struct pollfd fds[] =
     {
         [DISPLAY_FD] = { wl_display_get_fd(_glfw.wl.display), POLLIN },
+        [EMPTY_FD] = { _glfw.wl.emptyEvent.fds[0], POLLIN },
         [KEYREPEAT_FD] = { _glfw.wl.keyRepeatTimerfd, POLLIN },
         [CURSOR_FD] = { _glfw.wl.cursorTimerfd, POLLIN },
-        [LIBDECOR_FD] = { -1, POLLIN }
+        [LIBDECOR_FD] = { -1, POLLIN },
+        [CLIPBOARD_FD] = { _glfw.wl.clipboardRequest.fd, POLLIN }
     };
 
     if (_glfw.wl.libdecor.context)
@@ -1257,10 +1336,20 @@ static void handleEvents(double* timeout)
             wl_display_read_events(_glfw.wl.display);
             if (wl_display_dispatch_pending(_glfw.wl.display) > 0)
                 event = GLFW_TRUE;
+
+            // This only releases cursor buffers and is not an event to report
+            if (_glfw.wl.cursorQueue)
+                wl_display_dispatch_queue_pending(_glfw.wl.display, _glfw.wl.cursorQueue);
         }
         else
             wl_display_cancel_read(_glfw.wl.display);
 
+        if (fds[EMPTY_FD].revents & POLLIN)
+        {
+            _glfwDrainEmptyEventsPOSIX(&_glfw.wl.emptyEvent);
+            event = GLFW_TRUE;
+        }
+
         if (fds[KEYREPEAT_FD].revents & POLLIN)
         {
             uint64_t repeats;
@@ -1294,12 +1383,22 @@ static void handleEvents(double* timeout)
             if (libdecor_dispatch(_glfw.wl.libdecor.context, 0) > 0)
                 event = GLFW_TRUE;
         }
+
+        if (fds[CLIPBOARD_FD].revents & (POLLIN | POLLHUP))
+        {
+            // The pipe is not polled again once the read has finished
+            if (readClipboardRequest())
+                event = GLFW_TRUE;
+        }
     }
 }
 
-// Reads the specified data offer as the specified MIME type
+// Reads the specified data offer as the specified MIME type into a
+// null-terminated buffer, growing it geometrically
 //
-static char* readDataOfferAsString(struct wl_data_offer* offer, const char* mimeType)
+static char* readDataOffer(struct wl_data_offer* offer,
+                           const char* mimeType,
+                           size_t* length)
 {
     int fds[2];
 
@@ -1317,27 +1416,33 @@ static char* readDataOfferAsString(struct wl_data_offer* offer, const char* mime
 
     char* string = NULL;
     size_t size = 0;
-    size_t length = 0;
+
+    *length = 0;
 
     for (;;)
     {
         const size_t readSize = 4096;
-        const size_t requiredSize = length + readSize + 1;
+        const size_t requiredSize = *length + readSize + 1;
         if (requiredSize > size)
         {
-            char* longer = _glfw_realloc(string, requiredSize);
+            size_t longerSize = size ? size : readSize + 1;
+            while (longerSize < requiredSize)
+                longerSize *= 2;
+
+            char* longer = _glfw_realloc(string, longerSize);
             if (!longer)
             {
                 _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+                _glfw_free(string);
                 close(fds[0]);
                 return NULL;
             }
 
             string = longer;
-            size = requiredSize;
+            size = longerSize;
         }
 
-        const ssize_t result = read(fds[0], string + length, readSize);
+        const ssize_t result = read(fds[0], string + *length, size - *length - 1);
         if (result == 0)
             break;
         else if (result == -1)
@@ -1348,19 +1453,28 @@ static char* readDataOfferAsString(struct wl_data_offer* offer, const char* mime
             _glfwInputError(GLFW_PLATFORM_ERROR,
                             "Wayland: Failed to read from data offer pipe: %s",
                             strerror(errno));
+            _glfw_free(string);
             close(fds[0]);
             return NULL;
         }
 
-        length += result;
+        *length += result;
     }
 
     close(fds[0]);
 
-    string[length] = '\0';
+    string[*length] = '\0';
     return string;
 }
 
+// Reads the specified data offer as the specified MIME type
+//
+static char* readDataOfferAsString(struct wl_data_offer* offer, const char* mimeType)
+{
+    size_t length;
+    return readDataOffer(offer, mimeType, &length);
+}
+
 static void pointerHandleEnter(void* userData,
                                struct wl_pointer* pointer,
                                uint32_t serial,
@@ -1486,7 +1600,9 @@ static void pointerHandleMotion(void* userData,
             }
         }
 
-        if (_glfw.wl.cursorPreviousName != cursorName)
+        _glfwFinishCursorPreload();
+
+        if (_glfw.wl.cursorPreviousName != cursorName && _glfw.wl.cursorTheme)
         {
             struct wl_surface* surface = _glfw.wl.cursorSurface;
             struct wl_cursor_theme* theme = _glfw.wl.cursorTheme;
@@ -2039,18 +2155,7 @@ static void dataDeviceHandleDrop(void* userData,
     char* string = readDataOfferAsString(_glfw.wl.dragOffer, "text/uri-list");
     if (string)
     {
-        int count;
-        char** paths = _glfwParseUriList(string, &count);
-        if (paths)
-        {
-            _glfwInputDrop(_glfw.wl.dragFocus, count, (const char**) paths);
-
-            for (int i = 0; i < count; i++)
-                _glfw_free(paths[i]);
-
-            _glfw_free(paths);
-        }
-
+        _glfwInputDropUriList(_glfw.wl.dragFocus, string);
         _glfw_free(string);
     }
 }
@@ -2069,10 +2174,9 @@ static void dataDeviceHandleSelection(void* userData,
     {
         if (_glfw.wl.offers[i].offer == offer)
         {
-            if (_glfw.wl.offers[i].text_plain_utf8)
-                _glfw.wl.selectionOffer = offer;
-            else
-                wl_data_offer_destroy(offer);
+            // The offer is kept for glfwGetClipboardData even without text
+            _glfw.wl.selectionOffer = offer;
+            _glfw.wl.selectionOfferText = _glfw.wl.offers[i].text_plain_utf8;
 
             _glfw.wl.offers[i] = _glfw.wl.offers[_glfw.wl.offerCount - 1];
             _glfw.wl.offerCount--;
@@ -2661,8 +2765,7 @@ void _glfwWaitEventsTimeoutWayland(double timeout)
 
 void _glfwPostEmptyEventWayland(void)
 {
-    wl_display_sync(_glfw.wl.display);
-    flushDisplay();
+    _glfwPostEmptyEventPOSIX(&_glfw.wl.emptyEvent);
 }
 
 void _glfwGetCursorPosWayland(_GLFWwindow* window, double* xpos, double* ypos)
@@ -2765,6 +2868,15 @@ GLFWbool _glfwCreateStandardCursorWayland(_GLFWcursor* cursor, int shape)
 {
     const char* name = NULL;
 
+    _glfwFinishCursorPreload();
+
+    if (!_glfw.wl.cursorTheme)
+    {
+        _glfwInputError(GLFW_CURSOR_UNAVAILABLE,
+                        "Wayland: Failed to load default cursor theme");
+        return GLFW_FALSE;
+    }
+
     // Try the XDG names first
     switch (shape)
     {
@@ -3041,8 +3153,16 @@ void _glfwSetCursorWayland(_GLFWwindow* window, _GLFWcursor* cursor)
             setCursorImage(window, &cursor->wl);
         else
         {
-            struct wl_cursor* defaultCursor =
-                wl_cursor_theme_get_cursor(_glfw.wl.cursorTheme, "left_ptr");
+            struct wl_cursor* defaultCursor = NULL;
+
+            _glfwFinishCursorPreload();
+
+            if (_glfw.wl.cursorTheme)
+            {
+                defaultCursor =
+                    wl_cursor_theme_get_cursor(_glfw.wl.cursorTheme, "left_ptr");
+            }
+
             if (!defaultCursor)
             {
                 _glfwInputError(GLFW_PLATFORM_ERROR,
@@ -3094,17 +3214,30 @@ static void dataSourceHandleSend(void* userData,
                                  const char* mimeType,
                                  int fd)
 {
+    const char* string = NULL;
+    size_t length = 0;
+
     // Ignore it if this is an outdated or invalid request
-    if (_glfw.wl.selectionSource != source ||
-        strcmp(mimeType, "text/plain;charset=utf-8") != 0)
+    if (_glfw.wl.selectionSource == source)
+    {
+        if (_glfw.clipboardData.callback)
+        {
+            if (_glfwClipboardDataOffered(mimeType))
+                string = _glfw.clipboardData.callback(mimeType, &length);
+        }
+        else if (strcmp(mimeType, "text/plain;charset=utf-8") == 0)
+        {
+            string = _glfw.wl.clipboardString;
+            length = strlen(string);
+        }
+    }
+
+    if (!string)
     {
         close(fd);
         return;
     }
 
-    char* string = _glfw.wl.clipboardString;
-    size_t length = strlen(string);
-
     while (length > 0)
     {
         const ssize_t result = write(fd, string, length);
@@ -3168,7 +3301,7 @@ void _glfwSetClipboardStringWayland(const char* string)
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "Wayland: Failed to create clipboard data source");
-        return;
+        return GLFW_FALSE;
     }
     wl_data_source_add_listener(_glfw.wl.selectionSource,
                                 &dataSourceListener,
@@ -3181,7 +3314,7 @@ void _glfwSetClipboardStringWayland(const char* string)
 
 const char* _glfwGetClipboardStringWayland(void)
 {
-    if (!_glfw.wl.selectionOffer)
+    if (!_glfw.wl.selectionOffer || !_glfw.wl.selectionOfferText)
     {
         _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
                         "Wayland: No clipboard data available");
@@ -3197,6 +3330,122 @@ const char* _glfwGetClipboardStringWayland(void)
     return _glfw.wl.clipboardString;
 }
 
+GLFWbool _glfwSetClipboardDataWayland(void)
+{
+    if (_glfw.wl.selectionSource)
+    {
+        wl_data_source_destroy(_glfw.wl.selectionSource);
+        _glfw.wl.selectionSource = NULL;
+    }
+
+    _glfw_free(_glfw.wl.clipboardString);
+    _glfw.wl.clipboardString = NULL;
+
+    _glfw.wl.selectionSource =
+        wl_data_device_manager_create_data_source(_glfw.wl.dataDeviceManager);
+    if (!_glfw.wl.selectionSource)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create clipboard data source");
+        return GLFW_FALSE;
+    }
+    wl_data_source_add_listener(_glfw.wl.selectionSource,
+                                &dataSourceListener,
+                                NULL);
+
+    for (int i = 0;  i < _glfw.clipboardData.typeCount;  i++)
+        wl_data_source_offer(_glfw.wl.selectionSource, _glfw.clipboardData.types[i]);
+
+    wl_data_device_set_selection(_glfw.wl.dataDevice,
+                                 _glfw.wl.selectionSource,
+                                 _glfw.wl.serial);
+    return GLFW_TRUE;
+}
+
+const void* _glfwGetClipboardDataWayland(const char* type, size_t* size)
+{
+    _glfw_free(_glfw.wl.clipboardData);
+    _glfw.wl.clipboardData = NULL;
+
+    if (_glfw.wl.selectionSource)
+    {
+        // The data is returned directly when the clipboard is ours
+        if (_glfwClipboardDataOffered(type))
+        {
+            const void* data = _glfw.clipboardData.callback(type, size);
+            if (data)
+                return data;
+        }
+        else if (_glfw.wl.clipboardString &&
+                 strcmp(type, "text/plain;charset=utf-8") == 0)
+        {
+            *size = strlen(_glfw.wl.clipboardString);
+            return _glfw.wl.clipboardString;
+        }
+    }
+    else if (_glfw.wl.selectionOffer)
+    {
+        // The offered MIME types are not tracked, so an offer of empty data
+        // cannot be told apart from one that does not include the type
+        _glfw.wl.clipboardData =
+            readDataOffer(_glfw.wl.selectionOffer, type, size);
+        if (_glfw.wl.clipboardData && *size)
+            return _glfw.wl.clipboardData;
+    }
+
+    *size = 0;
+    _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                    "Wayland: Clipboard data is not available as %s", type);
+    return NULL;
+}
+
+void _glfwRequestClipboardStringWayland(void)
+{
+    if (!_glfw.wl.selectionOffer || !_glfw.wl.selectionOfferText)
+    {
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "Wayland: No clipboard data available");
+        _glfwInputClipboardString(NULL);
+        return;
+    }
+
+    if (_glfw.wl.selectionSource)
+    {
+        _glfwInputClipboardString(_glfw.wl.clipboardString);
+        return;
+    }
+
+    int fds[2];
+
+    if (pipe2(fds, O_CLOEXEC | O_NONBLOCK) == -1)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "Wayland: Failed to create pipe for data offer: %s",
+                        strerror(errno));
+        _glfwInputClipboardString(NULL);
+        return;
+    }
+
+    wl_data_offer_receive(_glfw.wl.selectionOffer,
+                          "text/plain;charset=utf-8",
+                          fds[1]);
+    flushDisplay();
+    close(fds[1]);
+
+    // The pipe is read by the event processing functions as data arrives
+    _glfw.wl.clipboardRequest.fd = fds[0];
+}
+
+void _glfwCancelClipboardRequestWayland(void)
+{
+    if (_glfw.wl.clipboardRequest.fd >= 0)
+        close(_glfw.wl.clipboardRequest.fd);
+
+    _glfw_free(_glfw.wl.clipboardRequest.string);
+    memset(&_glfw.wl.clipboardRequest, 0, sizeof(_glfw.wl.clipboardRequest));
+    _glfw.wl.clipboardRequest.fd = -1;
+}
+
 EGLenum _glfwGetEGLPlatformWayland(EGLint** attribs)
 {
     if (_glfw.egl.EXT_platform_base && _glfw.egl.EXT_platform_wayland)
@@ -35,7 +35,6 @@
 #include <stdio.h>
 #include <locale.h>
 #include <unistd.h>
-#include <fcntl.h>
 #include <errno.h>
 #include <assert.h>
 
@@ -601,6 +600,74 @@ static void detectEWMH(void)
         XFree(supportedAtoms);
 }
 
+// Load the XCB RandR library, which lets monitor enumeration send all its
+// output and CRTC queries before waiting for any of the replies
+//
+static void initXCBRandR(void)
+{
+    PFN_XGetXCBConnection getConnection = XGetXCBConnection;
+    void* x11xcb = NULL;
+
+#if defined(__CYGWIN__)
+    _glfw.x11.xcbrandr.handle = _glfwPlatformLoadModule("libxcb-randr-0.so");
+#elif defined(__OpenBSD__) || defined(__NetBSD__)
+    _glfw.x11.xcbrandr.handle = _glfwPlatformLoadModule("libxcb-randr.so");
+#else
+    _glfw.x11.xcbrandr.handle = _glfwPlatformLoadModule("libxcb-randr.so.0");
+#endif
+    if (!_glfw.x11.xcbrandr.handle)
+        return;
+
+    _glfw.x11.xcbrandr.GetOutputInfo = (PFN_xcb_randr_get_output_info)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xcbrandr.handle, "xcb_randr_get_output_info");
+    _glfw.x11.xcbrandr.GetOutputInfoReply = (PFN_xcb_randr_get_output_info_reply)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xcbrandr.handle, "xcb_randr_get_output_info_reply");
+    _glfw.x11.xcbrandr.GetOutputInfoModes = (PFN_xcb_randr_get_output_info_modes)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xcbrandr.handle, "xcb_randr_get_output_info_modes");
+    _glfw.x11.xcbrandr.GetOutputInfoName = (PFN_xcb_randr_get_output_info_name)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xcbrandr.handle, "xcb_randr_get_output_info_name");
+    _glfw.x11.xcbrandr.GetCrtcInfo = (PFN_xcb_randr_get_crtc_info)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xcbrandr.handle, "xcb_randr_get_crtc_info");
+    _glfw.x11.xcbrandr.GetCrtcInfoReply = (PFN_xcb_randr_get_crtc_info_reply)
+        _glfwPlatformGetModuleSymbol(_glfw.x11.xcbrandr.handle, "xcb_randr_get_crtc_info_reply");
+
+    // NOTE: The XCB connection belongs to the display, so Xlib-XCB is only
+    //       needed long enough to retrieve it, unless Vulkan also uses it
+    if (!getConnection)
+    {
+#if defined(__CYGWIN__)
+        x11xcb = _glfwPlatformLoadModule("libX11-xcb-1.so");
+#elif defined(__OpenBSD__) || defined(__NetBSD__)
+        x11xcb = _glfwPlatformLoadModule("libX11-xcb.so");
+#else
+        x11xcb = _glfwPlatformLoadModule("libX11-xcb.so.1");
+#endif
+        if (x11xcb)
+        {
+            getConnection = (PFN_XGetXCBConnection)
+                _glfwPlatformGetModuleSymbol(x11xcb, "XGetXCBConnection");
+        }
+    }
+
+    if (getConnection)
+        _glfw.x11.xcbrandr.connection = getConnection(_glfw.x11.display);
+
+    if (x11xcb)
+        _glfwPlatformFreeModule(x11xcb);
+
+    if (!_glfw.x11.xcbrandr.connection ||
+        !_glfw.x11.xcbrandr.GetOutputInfo ||
+        !_glfw.x11.xcbrandr.GetOutputInfoReply ||
+        !_glfw.x11.xcbrandr.GetOutputInfoModes ||
+        !_glfw.x11.xcbrandr.GetOutputInfoName ||
+        !_glfw.x11.xcbrandr.GetCrtcInfo ||
+        !_glfw.x11.xcbrandr.GetCrtcInfoReply)
+    {
+        _glfwPlatformFreeModule(_glfw.x11.xcbrandr.handle);
+        memset(&_glfw.x11.xcbrandr, 0, sizeof(_glfw.x11.xcbrandr));
+    }
+}
+
 // Look for and initialize supported X11 extensions
 //
 static GLFWbool initExtensions(void)
@@ -749,8 +816,13 @@ static GLFWbool initExtensions(void)
 
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
+        // Mode and position changes of a CRTC and changes of the screen size do
+        // not always come with an output change but must invalidate the cached
+        // monitor properties
         XRRSelectInput(_glfw.x11.display, _glfw.x11.root,
-                       RROutputChangeNotifyMask);
+                       RROutputChangeNotifyMask |
+                       RRCrtcChangeNotifyMask |
+                       RRScreenChangeNotifyMask);
     }
 
 #if defined(__CYGWIN__)
@@ -846,6 +918,9 @@ static GLFWbool initExtensions(void)
             _glfwPlatformGetModuleSymbol(_glfw.x11.x11xcb.handle, "XGetXCBConnection");
     }
 
+    if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
+        initXCBRandR();
+
 #if defined(__CYGWIN__)
     _glfw.x11.xrender.handle = _glfwPlatformLoadModule("libXrender-1.so");
 #elif defined(__OpenBSD__) || defined(__NetBSD__)
@@ -916,9 +991,11 @@ static GLFWbool initExtensions(void)
     _glfw.x11.UTF8_STRING = XInternAtom(_glfw.x11.display, "UTF8_STRING", False);
     _glfw.x11.ATOM_PAIR = XInternAtom(_glfw.x11.display, "ATOM_PAIR", False);
 
-    // Custom selection property atom
+    // Custom selection property atoms
     _glfw.x11.GLFW_SELECTION =
         XInternAtom(_glfw.x11.display, "GLFW_SELECTION", False);
+    _glfw.x11.GLFW_CLIPBOARD_REQUEST =
+        XInternAtom(_glfw.x11.display, "GLFW_CLIPBOARD_REQUEST", False);
 
     // ICCCM standard clipboard atoms
     _glfw.x11.TARGETS = XInternAtom(_glfw.x11.display, "TARGETS", False);
@@ -985,6 +1062,11 @@ static GLFWbool initExtensions(void)
     // Detect whether an EWMH-conformant window manager is running
     detectEWMH();
 
+    // The monitor work areas are cached, so watch the root window properties
+    // they are retrieved from
+    if (_glfw.x11.NET_WORKAREA && _glfw.x11.NET_CURRENT_DESKTOP)
+        XSelectInput(_glfw.x11.display, _glfw.x11.root, PropertyChangeMask);
+
     return GLFW_TRUE;
 }
 
@@ -1046,37 +1128,6 @@ static Window createHelperWindow(void)
                          CWEventMask, &wa);
 }
 
-// Create the pipe for empty events without assumuing the OS has pipe2(2)
-//
-static GLFWbool createEmptyEventPipe(void)
-{
-    if (pipe(_glfw.x11.emptyEventPipe) != 0)
-    {
-        _glfwInputError(GLFW_PLATFORM_ERROR,
-                        "X11: Failed to create empty event pipe: %s",
-                        strerror(errno));
-        return GLFW_FALSE;
-    }
-
-    for (int i = 0; i < 2; i++)
-    {
-        const int sf = fcntl(_glfw.x11.emptyEventPipe[i], F_GETFL, 0);
-        const int df = fcntl(_glfw.x11.emptyEventPipe[i], F_GETFD, 0);
-
-        if (sf == -1 || df == -1 ||
-            fcntl(_glfw.x11.emptyEventPipe[i], F_SETFL, sf | O_NONBLOCK) == -1 ||
-            fcntl(_glfw.x11.emptyEventPipe[i], F_SETFD, df | FD_CLOEXEC) == -1)
-        {
-            _glfwInputError(GLFW_PLATFORM_ERROR,
-                            "X11: Failed to set flags for empty event pipe: %s",
-                            strerror(errno));
-            return GLFW_FALSE;
-        }
-    }
-
-    return GLFW_TRUE;
-}
-
 // X error handler
 //
 static int errorHandler(Display *display, XErrorEvent* event)
@@ -1139,18 +1190,10 @@ Cursor _glfwCreateNativeCursorX11(const GLFWimage* image, int xhot, int yhot)
     native->xhot = xhot;
     native->yhot = yhot;
 
-    unsigned char* source = (unsigned char*) image->pixels;
-    XcursorPixel* target = native->pixels;
-
-    for (int i = 0;  i < image->width * image->height;  i++, target++, source += 4)
-    {
-        unsigned int alpha = source[3];
-
-        *target = (alpha << 24) |
-                  ((unsigned char) ((source[0] * alpha) / 255) << 16) |
-                  ((unsigned char) ((source[1] * alpha) / 255) <<  8) |
-                  ((unsigned char) ((source[2] * alpha) / 255) <<  0);
-    }
+    // XcursorPixel is a 32-bit ARGB value despite the name
+    _glfwConvertRGBAtoPremultipliedARGB32(image->pixels,
+                                          (uint32_t*) native->pixels,
+                                          image->width * image->height);
 
     cursor = XcursorImageLoadCursor(_glfw.x11.display, native);
     XcursorImageDestroy(native);
@@ -1183,6 +1226,10 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .getKeyScancode = _glfwGetKeyScancodeX11,
         .setClipboardString = _glfwSetClipboardStringX11,
         .getClipboardString = _glfwGetClipboardStringX11,
+        .requestClipboardString = _glfwRequestClipboardStringX11,
+        .cancelClipboardRequest = _glfwCancelClipboardRequestX11,
+        .setClipboardData = _glfwSetClipboardDataX11,
+        .getClipboardData = _glfwGetClipboardDataX11,
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
         .initJoysticks = _glfwInitJoysticksLinux,
         .terminateJoysticks = _glfwTerminateJoysticksLinux,
@@ -1204,6 +1251,7 @@ GLFWbool _glfwConnectX11(int platformID, _GLFWplatform* platform)
         .getVideoMode = _glfwGetVideoModeX11,
         .getGammaRamp = _glfwGetGammaRampX11,
         .setGammaRamp = _glfwSetGammaRampX11,
+        .flushGammaRamps = _glfwFlushGammaRampsX11,
         .createWindow = _glfwCreateWindowX11,
         .destroyWindow = _glfwDestroyWindowX11,
         .setWindowTitle = _glfwSetWindowTitleX11,
@@ -1528,13 +1576,17 @@ int _glfwInitX11(void)
 
     getSystemContentScale(&_glfw.x11.contentScaleX, &_glfw.x11.contentScaleY);
 
-    if (!createEmptyEventPipe())
+    if (!_glfwCreateEmptyEventPOSIX(&_glfw.x11.emptyEvent))
         return GLFW_FALSE;
 
     if (!initExtensions())
         return GLFW_FALSE;
 
+    // Loading the cursor theme overlaps with the remaining initialization
+    _glfwPreloadStandardCursorsX11();
+
     _glfw.x11.helperWindowHandle = createHelperWindow();
+    _glfw.x11.clipboardRequestHandle = createHelperWindow();
     _glfw.x11.hiddenCursorHandle = createHiddenCursor();
 
     if (XSupportsLocale() && _glfw.x11.xlib.utf8)
@@ -1566,6 +1618,14 @@ void _glfwTerminateX11(void)
         _glfw.x11.helperWindowHandle = None;
     }
 
+    if (_glfw.x11.clipboardRequestHandle)
+    {
+        XDestroyWindow(_glfw.x11.display, _glfw.x11.clipboardRequestHandle);
+        _glfw.x11.clipboardRequestHandle = None;
+    }
+
+    _glfwFreeStandardCursorsX11();
+
     if (_glfw.x11.hiddenCursorHandle)
     {
         XFreeCursor(_glfw.x11.display, _glfw.x11.hiddenCursorHandle);
@@ -1574,6 +1634,14 @@ void _glfwTerminateX11(void)
 
     _glfw_free(_glfw.x11.primarySelectionString);
     _glfw_free(_glfw.x11.clipboardString);
+    _glfw_free(_glfw.x11.clipboardRequest.string);
+    _glfw_free(_glfw.x11.clipboardTypes);
+    _glfw_free(_glfw.x11.transfers);
+
+    if (_glfw.x11.clipboardDataIncremental)
+        _glfw_free(_glfw.x11.clipboardData);
+    else if (_glfw.x11.clipboardData)
+        XFree(_glfw.x11.clipboardData);
 
     XUnregisterIMInstantiateCallback(_glfw.x11.display,
                                      NULL, NULL, NULL,
@@ -1598,6 +1666,12 @@ void _glfwTerminateX11(void)
         _glfw.x11.x11xcb.handle = NULL;
     }
 
+    if (_glfw.x11.xcbrandr.handle)
+    {
+        _glfwPlatformFreeModule(_glfw.x11.xcbrandr.handle);
+        memset(&_glfw.x11.xcbrandr, 0, sizeof(_glfw.x11.xcbrandr));
+    }
+
     if (_glfw.x11.xcursor.handle)
     {
         _glfwPlatformFreeModule(_glfw.x11.xcursor.handle);
@@ -1646,11 +1720,7 @@ void _glfwTerminateX11(void)
         _glfw.x11.xlib.handle = NULL;
     }
 
-    if (_glfw.x11.emptyEventPipe[0] || _glfw.x11.emptyEventPipe[1])
-    {
-        close(_glfw.x11.emptyEventPipe[0]);
-        close(_glfw.x11.emptyEventPipe[1]);
-    }
+    _glfwDestroyEmptyEventPOSIX(&_glfw.x11.emptyEvent);
 }
 
 #endif // _GLFW_X11
@@ -68,12 +68,11 @@ static const XRRModeInfo* getModeInfo(const XRRScreenResources* sr, RRMode id)
 
 // Convert RandR mode info to GLFW video mode
 //
-static GLFWvidmode vidmodeFromModeInfo(const XRRModeInfo* mi,
-                                       const XRRCrtcInfo* ci)
+static GLFWvidmode vidmodeFromModeInfo(const XRRModeInfo* mi, Rotation rotation)
 {
     GLFWvidmode mode;
 
-    if (ci->rotation == RR_Rotate_90 || ci->rotation == RR_Rotate_270)
+    if (rotation == RR_Rotate_90 || rotation == RR_Rotate_270)
     {
         mode.width  = mi->height;
         mode.height = mi->width;
@@ -92,6 +91,224 @@ static GLFWvidmode vidmodeFromModeInfo(const XRRModeInfo* mi,
     return mode;
 }
 
+// Lexically compare video modes, for use with qsort
+//
+static int compareVideoModes(const void* fp, const void* sp)
+{
+    return _glfwCompareVideoModes(fp, sp);
+}
+
+// The parts of RandR output info used by GLFW
+//
+typedef struct _GLFWoutputinfoX11
+{
+    Connection      connection;
+    RRCrtc          crtc;
+    unsigned long   mmWidth;
+    unsigned long   mmHeight;
+    char*           name;
+    RRMode*         modes;
+    int             modeCount;
+} _GLFWoutputinfoX11;
+
+// The parts of RandR CRTC info used by GLFW
+//
+typedef struct _GLFWcrtcinfoX11
+{
+    RRCrtc          id;
+    int             x, y;
+    unsigned int    width, height;
+    Rotation        rotation;
+} _GLFWcrtcinfoX11;
+
+// Fills in output info, leaving the allocated mode list for the caller to fill
+// If the name or mode list cannot be allocated the output is left disconnected
+//
+static GLFWbool setOutputInfo(_GLFWoutputinfoX11* info,
+                              Connection connection, RRCrtc crtc,
+                              unsigned long mmWidth, unsigned long mmHeight,
+                              const char* name, int nameLength, int modeCount)
+{
+    char* nameCopy = _glfw_calloc(nameLength + 1, 1);
+    RRMode* modes = _glfw_calloc(modeCount, sizeof(RRMode));
+    if (!nameCopy || (modeCount && !modes))
+    {
+        _glfw_free(nameCopy);
+        _glfw_free(modes);
+        return GLFW_FALSE;
+    }
+
+    memcpy(nameCopy, name, nameLength);
+
+    info->connection = connection;
+    info->crtc = crtc;
+    info->mmWidth = mmWidth;
+    info->mmHeight = mmHeight;
+    info->name = nameCopy;
+    info->modes = modes;
+    info->modeCount = modeCount;
+    return GLFW_TRUE;
+}
+
+// Retrieves the info of the specified outputs and CRTCs
+//
+// With XCB all requests are sent before waiting for the first reply, so the
+// whole query costs a single round trip instead of one per output and CRTC
+//
+static void queryRandR(XRRScreenResources* sr,
+                       const RROutput* outputIDs, int outputCount,
+                       _GLFWoutputinfoX11* outputs,
+                       const RRCrtc* crtcIDs, int crtcCount,
+                       _GLFWcrtcinfoX11* crtcs)
+{
+    int i;
+
+    memset(outputs, 0, outputCount * sizeof(_GLFWoutputinfoX11));
+    memset(crtcs, 0, crtcCount * sizeof(_GLFWcrtcinfoX11));
+
+    for (i = 0;  i < outputCount;  i++)
+        outputs[i].connection = RR_Disconnected;
+
+    for (i = 0;  i < crtcCount;  i++)
+    {
+        crtcs[i].id = crtcIDs[i];
+        crtcs[i].rotation = RR_Rotate_0;
+    }
+
+    xcb_randr_get_output_info_cookie_t* outputCookies = NULL;
+    xcb_randr_get_crtc_info_cookie_t* crtcCookies = NULL;
+    GLFWbool pipelined = GLFW_FALSE;
+
+    if (_glfw.x11.xcbrandr.handle)
+    {
+        outputCookies =
+            _glfw_calloc(outputCount, sizeof(xcb_randr_get_output_info_cookie_t));
+        crtcCookies =
+            _glfw_calloc(crtcCount, sizeof(xcb_randr_get_crtc_info_cookie_t));
+
+        // Fall back to one request at a time if the cookies cannot be stored
+        if ((outputCount && !outputCookies) || (crtcCount && !crtcCookies))
+        {
+            _glfw_free(outputCookies);
+            _glfw_free(crtcCookies);
+        }
+        else
+            pipelined = GLFW_TRUE;
+    }
+
+    if (pipelined)
+    {
+        xcb_connection_t* connection = _glfw.x11.xcbrandr.connection;
+
+        for (i = 0;  i < outputCount;  i++)
+        {
+            outputCookies[i] = xcb_randr_get_output_info(connection,
+                                                         (uint32_t) outputIDs[i],
+                                                         (uint32_t) sr->configTimestamp);
+        }
+
+        for (i = 0;  i < crtcCount;  i++)
+        {
+            crtcCookies[i] = xcb_randr_get_crtc_info(connection,
+                                                     (uint32_t) crtcIDs[i],
+                                                     (uint32_t) sr->configTimestamp);
+        }
+
+        for (i = 0;  i < outputCount;  i++)
+        {
+            xcb_generic_error_t* error = NULL;
+            xcb_randr_get_output_info_reply_t* oi =
+                xcb_randr_get_output_info_reply(connection, outputCookies[i], &error);
+
+            // NOTE: XCB allocates replies and errors with the C library
+            free(error);
+
+            if (!oi)
+                continue;
+
+            if (setOutputInfo(outputs + i,
+                              oi->connection, oi->crtc,
+                              oi->mm_width, oi->mm_height,
+                              (const char*) xcb_randr_get_output_info_name(oi),
+                              oi->name_len,
+                              oi->num_modes))
+            {
+                const uint32_t* modes = xcb_randr_get_output_info_modes(oi);
+                for (int j = 0;  j < oi->num_modes;  j++)
+                    outputs[i].modes[j] = modes[j];
+            }
+
+            free(oi);
+        }
+
+        for (i = 0;  i < crtcCount;  i++)
+        {
+            xcb_generic_error_t* error = NULL;
+            xcb_randr_get_crtc_info_reply_t* ci =
+                xcb_randr_get_crtc_info_reply(connection, crtcCookies[i], &error);
+
+            free(error);
+
+            if (!ci)
+                continue;
+
+            crtcs[i].x = ci->x;
+            crtcs[i].y = ci->y;
+            crtcs[i].width = ci->width;
+            crtcs[i].height = ci->height;
+            crtcs[i].rotation = ci->rotation;
+            free(ci);
+        }
+
+        _glfw_free(outputCookies);
+        _glfw_free(crtcCookies);
+    }
+    else
+    {
+        for (i = 0;  i < outputCount;  i++)
+        {
+            XRROutputInfo* oi = XRRGetOutputInfo(_glfw.x11.display, sr, outputIDs[i]);
+            if (!oi)
+                continue;
+
+            if (setOutputInfo(outputs + i,
+                              oi->connection, oi->crtc,
+                              oi->mm_width, oi->mm_height,
+                              oi->name, oi->nameLen,
+                              oi->nmode))
+            {
+                for (int j = 0;  j < oi->nmode;  j++)
+                    outputs[i].modes[j] = oi->modes[j];
+            }
+
+            XRRFreeOutputInfo(oi);
+        }
+
+        for (i = 0;  i < crtcCount;  i++)
+        {
+            XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, crtcIDs[i]);
+            if (!ci)
+                continue;
+
+            crtcs[i].x = ci->x;
+            crtcs[i].y = ci->y;
+            crtcs[i].width = ci->width;
+            crtcs[i].height = ci->height;
+            crtcs[i].rotation = ci->rotation;
+            XRRFreeCrtcInfo(ci);
+        }
+    }
+}
+
+static void freeOutputInfos(_GLFWoutputinfoX11* outputs, int count)
+{
+    for (int i = 0;  i < count;  i++)
+    {
+        _glfw_free(outputs[i].name);
+        _glfw_free(outputs[i].modes);
+    }
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                       GLFW internal API                      //////
@@ -123,16 +340,31 @@ void _glfwPollMonitorsX11(void)
                    _glfw.monitorCount * sizeof(_GLFWmonitor*));
         }
 
-        for (int i = 0;  i < sr->noutput;  i++)
+        _GLFWoutputinfoX11* outputs =
+            _glfw_calloc(sr->noutput, sizeof(_GLFWoutputinfoX11));
+        _GLFWcrtcinfoX11* crtcs = _glfw_calloc(sr->ncrtc, sizeof(_GLFWcrtcinfoX11));
+        int outputCount = sr->noutput;
+
+        // Keep the current monitors if the info cannot be stored
+        if ((sr->noutput && !outputs) || (sr->ncrtc && !crtcs))
+        {
+            outputCount = 0;
+            disconnectedCount = 0;
+        }
+        else
+        {
+            queryRandR(sr, sr->outputs, sr->noutput, outputs,
+                       sr->crtcs, sr->ncrtc, crtcs);
+        }
+
+        for (int i = 0;  i < outputCount;  i++)
         {
             int j, type, widthMM, heightMM;
+            const _GLFWoutputinfoX11* oi = outputs + i;
+            const _GLFWcrtcinfoX11* ci = NULL;
 
-            XRROutputInfo* oi = XRRGetOutputInfo(_glfw.x11.display, sr, sr->outputs[i]);
             if (oi->connection != RR_Connected || oi->crtc == None)
-            {
-                XRRFreeOutputInfo(oi);
                 continue;
-            }
 
             for (j = 0;  j < disconnectedCount;  j++)
             {
@@ -145,21 +377,29 @@ void _glfwPollMonitorsX11(void)
             }
 
             if (j < disconnectedCount)
-            {
-                XRRFreeOutputInfo(oi);
                 continue;
+
+            for (j = 0;  j < sr->ncrtc;  j++)
+            {
+                if (crtcs[j].id == oi->crtc)
+                {
+                    ci = crtcs + j;
+                    break;
+                }
             }
 
-            XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, oi->crtc);
+            if (!ci)
+                continue;
+
             if (ci->rotation == RR_Rotate_90 || ci->rotation == RR_Rotate_270)
             {
-                widthMM  = oi->mm_height;
-                heightMM = oi->mm_width;
+                widthMM  = oi->mmHeight;
+                heightMM = oi->mmWidth;
             }
             else
             {
-                widthMM  = oi->mm_width;
-                heightMM = oi->mm_height;
+                widthMM  = oi->mmWidth;
+                heightMM = oi->mmHeight;
             }
 
             if (widthMM <= 0 || heightMM <= 0)
@@ -194,11 +434,11 @@ void _glfwPollMonitorsX11(void)
                 type = _GLFW_INSERT_LAST;
 
             _glfwInputMonitor(monitor, GLFW_CONNECTED, type);
-
-            XRRFreeOutputInfo(oi);
-            XRRFreeCrtcInfo(ci);
         }
 
+        freeOutputInfos(outputs, outputCount);
+        _glfw_free(outputs);
+        _glfw_free(crtcs);
         XRRFreeScreenResources(sr);
 
         if (screens)
@@ -248,7 +488,7 @@ void _glfwSetVideoModeX11(_GLFWmonitor* monitor, const GLFWvidmode* desired)
             if (!modeIsGood(mi))
                 continue;
 
-            const GLFWvidmode mode = vidmodeFromModeInfo(mi, ci);
+            const GLFWvidmode mode = vidmodeFromModeInfo(mi, ci->rotation);
             if (_glfwCompareVideoModes(best, &mode) == 0)
             {
                 native = mi->id;
@@ -269,6 +509,8 @@ void _glfwSetVideoModeX11(_GLFWmonitor* monitor, const GLFWvidmode* desired)
                              ci->rotation,
                              ci->outputs,
                              ci->noutput);
+
+            _glfwInputMonitorChange(monitor);
         }
 
         XRRFreeOutputInfo(oi);
@@ -303,6 +545,7 @@ void _glfwRestoreVideoModeX11(_GLFWmonitor* monitor)
         XRRFreeScreenResources(sr);
 
         monitor->x11.oldMode = None;
+        _glfwInputMonitorChange(monitor);
     }
 }
 
@@ -313,6 +556,8 @@ void _glfwRestoreVideoModeX11(_GLFWmonitor* monitor)
 
 void _glfwFreeMonitorX11(_GLFWmonitor* monitor)
 {
+    if (monitor->x11.gamma)
+        XRRFreeGamma(monitor->x11.gamma);
 }
 
 void _glfwGetMonitorPosX11(_GLFWmonitor* monitor, int* xpos, int* ypos)
@@ -448,38 +693,47 @@ GLFWvidmode* _glfwGetVideoModesX11(_GLFWmonitor* monitor, int* count)
 
     if (_glfw.x11.randr.available && !_glfw.x11.randr.monitorBroken)
     {
+        _GLFWoutputinfoX11 oi;
+        _GLFWcrtcinfoX11 ci;
         XRRScreenResources* sr =
             XRRGetScreenResourcesCurrent(_glfw.x11.display, _glfw.x11.root);
-        XRRCrtcInfo* ci = XRRGetCrtcInfo(_glfw.x11.display, sr, monitor->x11.crtc);
-        XRROutputInfo* oi = XRRGetOutputInfo(_glfw.x11.display, sr, monitor->x11.output);
 
-        result = _glfw_calloc(oi->nmode, sizeof(GLFWvidmode));
+        queryRandR(sr, &monitor->x11.output, 1, &oi, &monitor->x11.crtc, 1, &ci);
 
-        for (int i = 0;  i < oi->nmode;  i++)
+        result = _glfw_calloc(oi.modeCount, sizeof(GLFWvidmode));
+        if (!result)
         {
-            const XRRModeInfo* mi = getModeInfo(sr, oi->modes[i]);
-            if (!modeIsGood(mi))
+            freeOutputInfos(&oi, 1);
+            XRRFreeScreenResources(sr);
+            return NULL;
+        }
+
+        for (int i = 0;  i < oi.modeCount;  i++)
+        {
+            const XRRModeInfo* mi = getModeInfo(sr, oi.modes[i]);
+            if (!mi || !modeIsGood(mi))
                 continue;
 
-            const GLFWvidmode mode = vidmodeFromModeInfo(mi, ci);
-            int j;
+            result[(*count)++] = vidmodeFromModeInfo(mi, ci.rotation);
+        }
 
-            for (j = 0;  j < *count;  j++)
+        // Skip duplicate modes by sorting them so that duplicates are adjacent
+        if (*count > 1)
+        {
+            int unique = 1;
+
+            qsort(result, *count, sizeof(GLFWvidmode), compareVideoModes);
+
+            for (int i = 1;  i < *count;  i++)
             {
-                if (_glfwCompareVideoModes(result + j, &mode) == 0)
-                    break;
+                if (_glfwCompareVideoModes(result + unique - 1, result + i) != 0)
+                    result[unique++] = result[i];
             }
 
-            // Skip duplicate modes
-            if (j < *count)
-                continue;
-
-            (*count)++;
-            result[*count - 1] = mode;
+            *count = unique;
         }
 
-        XRRFreeOutputInfo(oi);
-        XRRFreeCrtcInfo(ci);
+        freeOutputInfos(&oi, 1);
         XRRFreeScreenResources(sr);
     }
     else
@@ -505,7 +759,7 @@ GLFWbool _glfwGetVideoModeX11(_GLFWmonitor* monitor, GLFWvidmode* mode)
         {
             mi = getModeInfo(sr, ci->mode);
             if (mi)
-                *mode = vidmodeFromModeInfo(mi, ci);
+                *mode = vidmodeFromModeInfo(mi, ci->rotation);
 
             XRRFreeCrtcInfo(ci);
         }
@@ -569,42 +823,75 @@ GLFWbool _glfwGetGammaRampX11(_GLFWmonitor* monitor, GLFWgammaramp* ramp)
     }
 }
 
-void _glfwSetGammaRampX11(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
+GLFWbool _glfwSetGammaRampX11(_GLFWmonitor* monitor, const GLFWgammaramp* ramp)
 {
     if (_glfw.x11.randr.available && !_glfw.x11.randr.gammaBroken)
     {
-        if (XRRGetCrtcGammaSize(_glfw.x11.display, monitor->x11.crtc) != ramp->size)
+        // NOTE: The original ramp is always retrieved before a ramp is set and
+        //       has the size of the CRTC gamma, saving a round trip per ramp
+        if (monitor->originalRamp.size != ramp->size)
         {
             _glfwInputError(GLFW_PLATFORM_ERROR,
                             "X11: Gamma ramp size must match current ramp size");
-            return;
+            return GLFW_FALSE;
+        }
+
+        if (monitor->x11.gamma && monitor->x11.gamma->size != (int) ramp->size)
+        {
+            XRRFreeGamma(monitor->x11.gamma);
+            monitor->x11.gamma = NULL;
         }
 
-        XRRCrtcGamma* gamma = XRRAllocGamma(ramp->size);
+        if (!monitor->x11.gamma)
+        {
+            monitor->x11.gamma = XRRAllocGamma(ramp->size);
+            if (!monitor->x11.gamma)
+            {
+                _glfwInputError(GLFW_OUT_OF_MEMORY, NULL);
+                return GLFW_FALSE;
+            }
+        }
+
+        XRRCrtcGamma* gamma = monitor->x11.gamma;
 
         memcpy(gamma->red,   ramp->red,   ramp->size * sizeof(unsigned short));
         memcpy(gamma->green, ramp->green, ramp->size * sizeof(unsigned short));
         memcpy(gamma->blue,  ramp->blue,  ramp->size * sizeof(unsigned short));
 
+        // The request is buffered by Xlib, so setting the gamma of several
+        // monitors in a row sends all the requests together
         XRRSetCrtcGamma(_glfw.x11.display, monitor->x11.crtc, gamma);
-        XRRFreeGamma(gamma);
+        return GLFW_TRUE;
     }
     else if (_glfw.x11.vidmode.available)
     {
-        XF86VidModeSetGammaRamp(_glfw.x11.display,
-                                _glfw.x11.screen,
-                                ramp->size,
-                                (unsigned short*) ramp->red,
-                                (unsigned short*) ramp->green,
-                                (unsigned short*) ramp->blue);
+        if (!XF86VidModeSetGammaRamp(_glfw.x11.display,
+                                     _glfw.x11.screen,
+                                     ramp->size,
+                                     (unsigned short*) ramp->red,
+                                     (unsigned short*) ramp->green,
+                                     (unsigned short*) ramp->blue))
+        {
+            _glfwInputError(GLFW_PLATFORM_ERROR,
+                            "X11: Failed to set gamma ramp");
+            return GLFW_FALSE;
+        }
+
+        return GLFW_TRUE;
     }
     else
     {
         _glfwInputError(GLFW_PLATFORM_ERROR,
                         "X11: Gamma ramp access not supported by server");
+        return GLFW_FALSE;
     }
 }
 
+void _glfwFlushGammaRampsX11(void)
+{
+    XFlush(_glfw.x11.display);
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 //////                        GLFW native API                       //////
@@ -360,6 +360,63 @@ typedef struct xcb_connection_t xcb_connection_t;
 typedef xcb_connection_t* (* PFN_XGetXCBConnection)(Display*);
 #define XGetXCBConnection _glfw.x11.x11xcb.GetXCBConnection
 
+typedef struct xcb_generic_error_t xcb_generic_error_t;
+typedef struct xcb_randr_get_output_info_cookie_t
+{
+    unsigned int sequence;
+} xcb_randr_get_output_info_cookie_t;
+typedef struct xcb_randr_get_output_info_reply_t
+{
+    uint8_t response_type;
+    uint8_t status;
+    uint16_t sequence;
+    uint32_t length;
+    uint32_t timestamp;
+    uint32_t crtc;
+    uint32_t mm_width;
+    uint32_t mm_height;
+    uint8_t connection;
+    uint8_t subpixel_order;
+    uint16_t num_crtcs;
+    uint16_t num_modes;
+    uint16_t num_preferred;
+    uint16_t num_clones;
+    uint16_t name_len;
+} xcb_randr_get_output_info_reply_t;
+typedef struct xcb_randr_get_crtc_info_cookie_t
+{
+    unsigned int sequence;
+} xcb_randr_get_crtc_info_cookie_t;
+typedef struct xcb_randr_get_crtc_info_reply_t
+{
+    uint8_t response_type;
+    uint8_t status;
+    uint16_t sequence;
+    uint32_t length;
+    uint32_t timestamp;
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t mode;
+    uint16_t rotation;
+    uint16_t rotations;
+    uint16_t num_outputs;
+    uint16_t num_possible_outputs;
+} xcb_randr_get_crtc_info_reply_t;
+typedef xcb_randr_get_output_info_cookie_t (* PFN_xcb_randr_get_output_info)(xcb_connection_t*,uint32_t,uint32_t);
+typedef xcb_randr_get_output_info_reply_t* (* PFN_xcb_randr_get_output_info_reply)(xcb_connection_t*,xcb_randr_get_output_info_cookie_t,xcb_generic_error_t**);
+typedef uint32_t* (* PFN_xcb_randr_get_output_info_modes)(const xcb_randr_get_output_info_reply_t*);
+typedef uint8_t* (* PFN_xcb_randr_get_output_info_name)(const xcb_randr_get_output_info_reply_t*);
+typedef xcb_randr_get_crtc_info_cookie_t (* PFN_xcb_randr_get_crtc_info)(xcb_connection_t*,uint32_t,uint32_t);
+typedef xcb_randr_get_crtc_info_reply_t* (* PFN_xcb_randr_get_crtc_info_reply)(xcb_connection_t*,xcb_randr_get_crtc_info_cookie_t,xcb_generic_error_t**);
+#define xcb_randr_get_output_info _glfw.x11.xcbrandr.GetOutputInfo
+#define xcb_randr_get_output_info_reply _glfw.x11.xcbrandr.GetOutputInfoReply
+#define xcb_randr_get_output_info_modes _glfw.x11.xcbrandr.GetOutputInfoModes
+#define xcb_randr_get_output_info_name _glfw.x11.xcbrandr.GetOutputInfoName
+#define xcb_randr_get_crtc_info _glfw.x11.xcbrandr.GetCrtcInfo
+#define xcb_randr_get_crtc_info_reply _glfw.x11.xcbrandr.GetCrtcInfoReply
+
 typedef Bool (* PFN_XF86VidModeQueryExtension)(Display*,int*,int*);
 typedef Bool (* PFN_XF86VidModeGetGammaRamp)(Display*,int,int,unsigned short*,unsigned short*,unsigned short*);
 typedef Bool (* PFN_XF86VidModeSetGammaRamp)(Display*,int,int,unsigned short*,unsigned short*,unsigned short*);
@@ -480,6 +537,8 @@ typedef struct _GLFWlibraryGLX
     int             eventBase;
     int             errorBase;
 
+    _GLFWfbconfigcache* fbconfigs;
+
     void*           handle;
 
     // GLX 1.3 functions
@@ -560,8 +619,17 @@ typedef struct _GLFWlibraryX11
     float           contentScaleX, contentScaleY;
     // Helper window for IPC
     Window          helperWindowHandle;
+    // Requestor window for glfwRequestClipboardString, so that its replies can
+    // be told apart from those to synchronous conversions even on failure
+    Window          clipboardRequestHandle;
     // Invisible cursor for hidden cursor mode
     Cursor          hiddenCursorHandle;
+    // Standard cursor theme images loaded in the background
+    struct {
+        char*           theme;
+        int             size;
+        XcursorImage*   images[_GLFW_STANDARD_CURSOR_COUNT];
+    } cursorPreload;
     // Context for mapping window XIDs to _GLFWwindow pointers
     XContext        context;
     // XIM input method
@@ -574,6 +642,31 @@ typedef struct _GLFWlibraryX11
     char*           primarySelectionString;
     // Clipboard string (while the selection is owned)
     char*           clipboardString;
+    // Clipboard transfer for glfwRequestClipboardString
+    struct {
+        Atom        target;
+        GLFWbool    incremental;
+        char*       string;
+        size_t      length;
+        size_t      size;
+    } clipboardRequest;
+    // Atoms of the types offered with glfwSetClipboardData
+    Atom*           clipboardTypes;
+    // Clipboard data returned by the last glfwGetClipboardData
+    unsigned char*  clipboardData;
+    // Whether the clipboard data was received incrementally (and allocated
+    // by GLFW instead of Xlib)
+    GLFWbool        clipboardDataIncremental;
+    // Outgoing incremental transfers of clipboard data
+    struct {
+        Window      requestor;
+        Atom        property;
+        Atom        target;
+        const unsigned char* data;
+        size_t      size;
+        size_t      offset;
+    }*              transfers;
+    int             transferCount;
     // Key name string
     char            keynames[GLFW_KEY_LAST + 1][5];
     // X11 keycode to GLFW key LUT
@@ -584,7 +677,7 @@ typedef struct _GLFWlibraryX11
     double          restoreCursorPosX, restoreCursorPosY;
     // The window whose disabled cursor mode is active
     _GLFWwindow*    disabledCursorWindow;
-    int             emptyEventPipe[2];
+    _GLFWemptyeventPOSIX emptyEvent;
 
     // Window manager atoms
     Atom            NET_SUPPORTED;
@@ -641,6 +734,7 @@ typedef struct _GLFWlibraryX11
     Atom            COMPOUND_STRING;
     Atom            ATOM_PAIR;
     Atom            GLFW_SELECTION;
+    Atom            GLFW_CLIPBOARD_REQUEST;
 
     struct {
         void*       handle;
@@ -827,6 +921,17 @@ typedef struct _GLFWlibraryX11
         PFN_XGetXCBConnection GetXCBConnection;
     } x11xcb;
 
+    struct {
+        void*       handle;
+        xcb_connection_t* connection;
+        PFN_xcb_randr_get_output_info GetOutputInfo;
+        PFN_xcb_randr_get_output_info_reply GetOutputInfoReply;
+        PFN_xcb_randr_get_output_info_modes GetOutputInfoModes;
+        PFN_xcb_randr_get_output_info_name GetOutputInfoName;
+        PFN_xcb_randr_get_crtc_info GetCrtcInfo;
+        PFN_xcb_randr_get_crtc_info_reply GetCrtcInfoReply;
+    } xcbrandr;
+
     struct {
         GLFWbool    available;
         void*       handle;
@@ -883,6 +988,8 @@ typedef struct _GLFWmonitorX11
     RROutput        output;
     RRCrtc          crtc;
     RRMode          oldMode;
+    // Request buffer for gamma ramps, reused while the ramp size is unchanged
+    XRRCrtcGamma*   gamma;
 
     // Index of corresponding Xinerama screen,
     // for EWMH full screen window placement
@@ -954,6 +1061,10 @@ void _glfwDestroyCursorX11(_GLFWcursor* cursor);
 void _glfwSetCursorX11(_GLFWwindow* window, _GLFWcursor* cursor);
 void _glfwSetClipboardStringX11(const char* string);
 const char* _glfwGetClipboardStringX11(void);
+void _glfwRequestClipboardStringX11(void);
+void _glfwCancelClipboardRequestX11(void);
+GLFWbool _glfwSetClipboardDataX11(void);
+const void* _glfwGetClipboardDataX11(const char* type, size_t* size);
 
 EGLenum _glfwGetEGLPlatformX11(EGLint** attribs);
 EGLNativeDisplayType _glfwGetEGLNativeDisplayX11(void);
@@ -970,13 +1081,16 @@ void _glfwGetMonitorWorkareaX11(_GLFWmonitor* monitor, int* xpos, int* ypos, int
 GLFWvidmode* _glfwGetVideoModesX11(_GLFWmonitor* monitor, int* count);
 GLFWbool _glfwGetVideoModeX11(_GLFWmonitor* monitor, GLFWvidmode* mode);
 GLFWbool _glfwGetGammaRampX11(_GLFWmonitor* monitor, GLFWgammaramp* ramp);
-void _glfwSetGammaRampX11(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+GLFWbool _glfwSetGammaRampX11(_GLFWmonitor* monitor, const GLFWgammaramp* ramp);
+void _glfwFlushGammaRampsX11(void);
 
 void _glfwPollMonitorsX11(void);
 void _glfwSetVideoModeX11(_GLFWmonitor* monitor, const GLFWvidmode* desired);
 void _glfwRestoreVideoModeX11(_GLFWmonitor* monitor);
 
 Cursor _glfwCreateNativeCursorX11(const GLFWimage* image, int xhot, int yhot);
+void _glfwPreloadStandardCursorsX11(void);
+void _glfwFreeStandardCursorsX11(void);
 
 unsigned long _glfwGetWindowPropertyX11(Window window,
                                         Atom property,
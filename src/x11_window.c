@@ -79,11 +79,11 @@ static GLFWbool waitForX11Event(double* timeout)
 //
 static GLFWbool waitForAnyEvent(double* timeout)
 {
-    enum { XLIB_FD, PIPE_FD, INOTIFY_FD };
+    enum { XLIB_FD, EMPTY_FD, INOTIFY_FD };
     struct pollfd fds[] =
     {
         [XLIB_FD] = { ConnectionNumber(_glfw.x11.display), POLLIN },
-        [PIPE_FD] = { _glfw.x11.emptyEventPipe[0], POLLIN },
+        [EMPTY_FD] = { _glfw.x11.emptyEvent.fds[0], POLLIN },
         [INOTIFY_FD] = { -1, POLLIN }
     };
 
@@ -97,6 +97,9 @@ static GLFWbool waitForAnyEvent(double* timeout)
         if (!_glfwPollPOSIX(fds, sizeof(fds) / sizeof(fds[0]), timeout))
             return GLFW_FALSE;
 
+        if (fds[EMPTY_FD].revents & POLLIN)
+            _glfwDrainEmptyEventsPOSIX(&_glfw.x11.emptyEvent);
+
         for (int i = 1; i < sizeof(fds) / sizeof(fds[0]); i++)
         {
             if (fds[i].revents & POLLIN)
@@ -107,32 +110,6 @@ static GLFWbool waitForAnyEvent(double* timeout)
     return GLFW_TRUE;
 }
 
-// Writes a byte to the empty event pipe
-//
-static void writeEmptyEvent(void)
-{
-    for (;;)
-    {
-        const char byte = 0;
-        const ssize_t result = write(_glfw.x11.emptyEventPipe[1], &byte, 1);
-        if (result == 1 || (result == -1 && errno != EINTR))
-            break;
-    }
-}
-
-// Drains available data from the empty event pipe
-//
-static void drainEmptyEvents(void)
-{
-    for (;;)
-    {
-        char dummy[64];
-        const ssize_t result = read(_glfw.x11.emptyEventPipe[0], dummy, sizeof(dummy));
-        if (result == -1 && errno != EINTR)
-            break;
-    }
-}
-
 // Waits until a VisibilityNotify event arrives for the specified window or the
 // timeout period elapses (ICCCM section 4.2.2)
 //
@@ -177,10 +154,25 @@ static int getWindowState(_GLFWwindow* window)
     return result;
 }
 
-// Returns whether the event is a selection event
+// Returns whether the event is a selection event or a property event of an
+// outgoing clipboard data transfer
 //
 static Bool isSelectionEvent(Display* display, XEvent* event, XPointer pointer)
 {
+    if (event->type == PropertyNotify)
+    {
+        for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+        {
+            if (event->xproperty.window == _glfw.x11.transfers[i].requestor &&
+                event->xproperty.atom == _glfw.x11.transfers[i].property)
+            {
+                return True;
+            }
+        }
+
+        return False;
+    }
+
     if (event->xany.window != _glfw.x11.helperWindowHandle)
         return False;
 
@@ -189,6 +181,21 @@ static Bool isSelectionEvent(Display* display, XEvent* event, XPointer pointer)
            event->type == SelectionClear;
 }
 
+// Returns whether it is the reply to the specified synchronous selection
+// conversion, which stores the result in the property of the request or fails
+// with no property
+//
+static Bool isSelectionNotify(Display* display, XEvent* event, XPointer pointer)
+{
+    const XSelectionEvent* request = (const XSelectionEvent*) pointer;
+    return event->type == SelectionNotify &&
+           event->xselection.requestor == request->requestor &&
+           event->xselection.selection == request->selection &&
+           event->xselection.target == request->target &&
+           (event->xselection.property == request->property ||
+            event->xselection.property == None);
+}
+
 // Returns whether it is a _NET_FRAME_EXTENTS event for the specified window
 //
 static Bool isFrameExtentsEvent(Display* display, XEvent* event, XPointer pointer)
@@ -452,6 +459,51 @@ static char* convertLatin1toUTF8(const char* source)
     return target;
 }
 
+// Returns the cursor theme name of the specified standard cursor shape
+//
+static const char* getStandardCursorName(int shape)
+{
+    switch (shape)
+    {
+        case GLFW_ARROW_CURSOR:
+            return "default";
+        case GLFW_IBEAM_CURSOR:
+            return "text";
+        case GLFW_CROSSHAIR_CURSOR:
+            return "crosshair";
+        case GLFW_POINTING_HAND_CURSOR:
+            return "pointer";
+        case GLFW_RESIZE_EW_CURSOR:
+            return "ew-resize";
+        case GLFW_RESIZE_NS_CURSOR:
+            return "ns-resize";
+        case GLFW_RESIZE_NWSE_CURSOR:
+            return "nwse-resize";
+        case GLFW_RESIZE_NESW_CURSOR:
+            return "nesw-resize";
+        case GLFW_RESIZE_ALL_CURSOR:
+            return "all-scroll";
+        case GLFW_NOT_ALLOWED_CURSOR:
+            return "not-allowed";
+    }
+
+    return NULL;
+}
+
+// Loads the theme images of all standard cursor shapes
+// This is run on the cursor preload thread and does not use the display
+//
+static void loadStandardCursorImages(void* argument)
+{
+    for (int i = 0;  i < _GLFW_STANDARD_CURSOR_COUNT;  i++)
+    {
+        _glfw.x11.cursorPreload.images[i] =
+            XcursorLibraryLoadImage(getStandardCursorName(GLFW_ARROW_CURSOR + i),
+                                    _glfw.x11.cursorPreload.theme,
+                                    _glfw.x11.cursorPreload.size);
+    }
+}
+
 // Updates the cursor image according to its cursor mode
 //
 static void updateCursorImage(_GLFWwindow* window)
@@ -787,6 +839,90 @@ static GLFWbool createNativeWindow(_GLFWwindow* window,
     return GLFW_TRUE;
 }
 
+// Returns the largest number of bytes that can be written to a property with
+// a single request
+//
+static size_t getMaxPropertySize(void)
+{
+    long units = XExtendedMaxRequestSize(_glfw.x11.display);
+    if (!units)
+        units = XMaxRequestSize(_glfw.x11.display);
+
+    // Leave room for the header of the ChangeProperty request
+    return (size_t) units * 4 - 64;
+}
+
+// Writes the clipboard data of the specified type to the property, starting an
+// incremental transfer if it is too large for a single request
+//
+static GLFWbool writeClipboardData(Window requestor, Atom property, Atom target)
+{
+    int index;
+
+    for (index = 0;  index < _glfw.clipboardData.typeCount;  index++)
+    {
+        if (_glfw.x11.clipboardTypes[index] == target)
+            break;
+    }
+
+    if (index == _glfw.clipboardData.typeCount)
+        return GLFW_FALSE;
+
+    size_t size = 0;
+    const unsigned char* data =
+        _glfw.clipboardData.callback(_glfw.clipboardData.types[index], &size);
+    if (!data)
+        return GLFW_FALSE;
+
+    if (size <= getMaxPropertySize())
+    {
+        XChangeProperty(_glfw.x11.display,
+                        requestor,
+                        property,
+                        target,
+                        8,
+                        PropModeReplace,
+                        data,
+                        (int) size);
+
+        return GLFW_TRUE;
+    }
+
+    // The data is sent in chunks, each written when the requestor has deleted
+    // the previous one (ICCCM section 2.7.2)
+
+    void* transfers = _glfw_realloc(_glfw.x11.transfers,
+                                    (_glfw.x11.transferCount + 1) *
+                                    sizeof(*_glfw.x11.transfers));
+    if (!transfers)
+        return GLFW_FALSE;
+
+    _glfw.x11.transfers = transfers;
+    _glfw.x11.transfers[_glfw.x11.transferCount].requestor = requestor;
+    _glfw.x11.transfers[_glfw.x11.transferCount].property = property;
+    _glfw.x11.transfers[_glfw.x11.transferCount].target = target;
+    _glfw.x11.transfers[_glfw.x11.transferCount].data = data;
+    _glfw.x11.transfers[_glfw.x11.transferCount].size = size;
+    _glfw.x11.transfers[_glfw.x11.transferCount].offset = 0;
+    _glfw.x11.transferCount++;
+
+    XSelectInput(_glfw.x11.display, requestor, PropertyChangeMask);
+
+    // The INCR property holds a lower bound of the size of the data
+    const unsigned long bound = size;
+
+    XChangeProperty(_glfw.x11.display,
+                    requestor,
+                    property,
+                    _glfw.x11.INCR,
+                    32,
+                    PropModeReplace,
+                    (unsigned char*) &bound,
+                    1);
+
+    return GLFW_TRUE;
+}
+
 // Set the specified property to the selection converted to the requested target
 //
 static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
@@ -794,6 +930,10 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
     char* selectionString = NULL;
     const Atom formats[] = { _glfw.x11.UTF8_STRING, XA_STRING };
     const int formatCount = sizeof(formats) / sizeof(formats[0]);
+    // Whether the clipboard holds data set with glfwSetClipboardData
+    const GLFWbool offersData = request->selection == _glfw.x11.CLIPBOARD &&
+                                _glfw.clipboardData.callback &&
+                                _glfw.x11.clipboardTypes;
 
     if (request->selection == _glfw.x11.PRIMARY)
         selectionString = _glfw.x11.primarySelectionString;
@@ -807,6 +947,32 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
         return None;
     }
 
+    if (request->target == _glfw.x11.TARGETS && offersData)
+    {
+        // The list of offered types was requested
+
+        const int count = _glfw.clipboardData.typeCount;
+        Atom* targets = _glfw_calloc(count + 2, sizeof(Atom));
+        if (!targets)
+            return None;
+
+        targets[0] = _glfw.x11.TARGETS;
+        targets[1] = _glfw.x11.MULTIPLE;
+        memcpy(targets + 2, _glfw.x11.clipboardTypes, count * sizeof(Atom));
+
+        XChangeProperty(_glfw.x11.display,
+                        request->requestor,
+                        request->property,
+                        XA_ATOM,
+                        32,
+                        PropModeReplace,
+                        (unsigned char*) targets,
+                        count + 2);
+
+        _glfw_free(targets);
+        return request->property;
+    }
+
     if (request->target == _glfw.x11.TARGETS)
     {
         // The list of supported targets was requested
@@ -843,6 +1009,18 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
         {
             int j;
 
+            if (offersData)
+            {
+                if (!writeClipboardData(request->requestor,
+                                        targets[i + 1],
+                                        targets[i]))
+                {
+                    targets[i + 1] = None;
+                }
+
+                continue;
+            }
+
             for (j = 0;  j < formatCount;  j++)
             {
                 if (targets[i] == formats[j])
@@ -897,6 +1075,18 @@ static Atom writeTargetToProperty(const XSelectionRequestEvent* request)
 
     // Conversion to a data target was requested
 
+    if (offersData)
+    {
+        if (writeClipboardData(request->requestor,
+                               request->property,
+                               request->target))
+        {
+            return request->property;
+        }
+
+        return None;
+    }
+
     for (int i = 0;  i < formatCount;  i++)
     {
         if (request->target == formats[i])
@@ -936,6 +1126,211 @@ static void handleSelectionRequest(XEvent* event)
     XSendEvent(_glfw.x11.display, request->requestor, False, 0, &reply);
 }
 
+// Writes the next chunk of an outgoing incremental transfer when the requestor
+// has deleted the previous one, returning whether the event was consumed
+//
+static GLFWbool handleTransferProperty(const XPropertyEvent* event)
+{
+    for (int i = 0;  i < _glfw.x11.transferCount;  i++)
+    {
+        if (_glfw.x11.transfers[i].requestor != event->window ||
+            _glfw.x11.transfers[i].property != event->atom)
+        {
+            continue;
+        }
+
+        if (event->state != PropertyDelete)
+            return GLFW_TRUE;
+
+        const size_t remaining = _glfw.x11.transfers[i].size -
+                                 _glfw.x11.transfers[i].offset;
+        const size_t maxSize = getMaxPropertySize();
+        const size_t count = remaining < maxSize ? remaining : maxSize;
+
+        // The transfer ends with a zero-length chunk
+        XChangeProperty(_glfw.x11.display,
+                        _glfw.x11.transfers[i].requestor,
+                        _glfw.x11.transfers[i].property,
+                        _glfw.x11.transfers[i].target,
+                        8,
+                        PropModeReplace,
+                        _glfw.x11.transfers[i].data + _glfw.x11.transfers[i].offset,
+                        (int) count);
+
+        if (count)
+            _glfw.x11.transfers[i].offset += count;
+        else
+        {
+            _glfw.x11.transfers[i] =
+                _glfw.x11.transfers[_glfw.x11.transferCount - 1];
+            _glfw.x11.transferCount--;
+        }
+
+        return GLFW_TRUE;
+    }
+
+    return GLFW_FALSE;
+}
+
+// Appends a chunk of an incremental selection transfer to the specified
+// null-terminated buffer, growing it geometrically
+//
+static GLFWbool appendSelectionData(char** string, size_t* length, size_t* size,
+                                    const char* data, size_t count)
+{
+    const size_t required = *length + count + 1;
+
+    if (required > *size)
+    {
+        size_t longerSize = *size ? *size : 4096;
+        while (longerSize < required)
+            longerSize *= 2;
+
+        char* longer = _glfw_realloc(*string, longerSize);
+        if (!longer)
+            return GLFW_FALSE;
+
+        *string = longer;
+        *size = longerSize;
+    }
+
+    if (count)
+        memcpy(*string + *length, data, count);
+
+    *length += count;
+    (*string)[*length] = '\0';
+    return GLFW_TRUE;
+}
+
+// Allocates the buffer of an incremental selection transfer from the lower
+// bound of its size announced in the INCR property
+//
+static void reserveSelectionData(char** string, size_t* length, size_t* size,
+                                 const unsigned char* data, unsigned long itemCount)
+{
+    // Do not trust the owner with more than a modest initial allocation
+    const size_t limit = 16 * 1024 * 1024;
+    size_t bound = 0;
+
+    if (itemCount)
+        bound = *(const unsigned long*) data;
+
+    *string = NULL;
+    *length = 0;
+    *size = 0;
+
+    if (bound)
+    {
+        *size = (bound < limit ? bound : limit) + 1;
+        *string = _glfw_calloc(*size, 1);
+        if (!*string)
+            *size = 0;
+    }
+}
+
+// Returns the size in bytes of the specified number of property items
+//
+static size_t getPropertyDataSize(int format, unsigned long itemCount)
+{
+    // Xlib returns 32-bit items as longs
+    if (format == 32)
+        return itemCount * sizeof(long);
+    else
+        return itemCount * (format / 8);
+}
+
+// Reads the property of a selection conversion, including incremental transfers
+// The data is allocated by GLFW if the type is INCR and by Xlib otherwise, and
+// is null-terminated in both cases
+//
+static unsigned char* readSelection(XEvent* notification, Atom* type, size_t* length)
+{
+    unsigned char* data;
+    int format;
+    unsigned long itemCount, bytesAfter;
+    XEvent dummy;
+
+    XCheckIfEvent(_glfw.x11.display,
+                  &dummy,
+                  isSelPropNewValueNotify,
+                  (XPointer) notification);
+
+    XGetWindowProperty(_glfw.x11.display,
+                       notification->xselection.requestor,
+                       notification->xselection.property,
+                       0,
+                       LONG_MAX,
+                       True,
+                       AnyPropertyType,
+                       type,
+                       &format,
+                       &itemCount,
+                       &bytesAfter,
+                       &data);
+
+    if (*type != _glfw.x11.INCR)
+    {
+        *length = getPropertyDataSize(format, itemCount);
+        return data;
+    }
+
+    char* string;
+    size_t size;
+
+    reserveSelectionData(&string, length, &size, data, itemCount);
+    XFree(data);
+
+    for (;;)
+    {
+        Atom chunkType;
+
+        while (!XCheckIfEvent(_glfw.x11.display,
+                              &dummy,
+                              isSelPropNewValueNotify,
+                              (XPointer) notification))
+        {
+            waitForX11Event(NULL);
+        }
+
+        XGetWindowProperty(_glfw.x11.display,
+                           notification->xselection.requestor,
+                           notification->xselection.property,
+                           0,
+                           LONG_MAX,
+                           True,
+                           AnyPropertyType,
+                           &chunkType,
+                           &format,
+                           &itemCount,
+                           &bytesAfter,
+                           &data);
+
+        const size_t count = getPropertyDataSize(format, itemCount);
+        if (!count)
+        {
+            XFree(data);
+            break;
+        }
+
+        if (!appendSelectionData(&string, length, &size, (char*) data, count))
+        {
+            XFree(data);
+            *length = 0;
+            break;
+        }
+
+        XFree(data);
+    }
+
+    if (!*length)
+    {
+        _glfw_free(string);
+        return NULL;
+    }
+
+    return (unsigned char*) string;
+}
+
 static const char* getSelectionString(Atom selection)
 {
     char** selectionString = NULL;
@@ -952,6 +1347,13 @@ static const char* getSelectionString(Atom selection)
     {
         // Instead of doing a large number of X round-trips just to put this
         // string into a window property and then read it back, just return it
+        if (!*selectionString)
+        {
+            // The clipboard holds data set with glfwSetClipboardData
+            _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                            "X11: Failed to convert selection to string");
+        }
+
         return *selectionString;
     }
 
@@ -962,9 +1364,8 @@ static const char* getSelectionString(Atom selection)
     {
         char* data;
         Atom actualType;
-        int actualFormat;
-        unsigned long itemCount, bytesAfter;
-        XEvent notification, dummy;
+        size_t length;
+        XEvent notification;
 
         XConvertSelection(_glfw.x11.display,
                           selection,
@@ -973,10 +1374,15 @@ static const char* getSelectionString(Atom selection)
                           _glfw.x11.helperWindowHandle,
                           CurrentTime);
 
-        while (!XCheckTypedWindowEvent(_glfw.x11.display,
-                                       _glfw.x11.helperWindowHandle,
-                                       SelectionNotify,
-                                       &notification))
+        notification.xselection.requestor = _glfw.x11.helperWindowHandle;
+        notification.xselection.selection = selection;
+        notification.xselection.target = targets[i];
+        notification.xselection.property = _glfw.x11.GLFW_SELECTION;
+
+        while (!XCheckIfEvent(_glfw.x11.display,
+                              &notification,
+                              isSelectionNotify,
+                              (XPointer) &notification))
         {
             waitForX11Event(NULL);
         }
@@ -984,87 +1390,33 @@ static const char* getSelectionString(Atom selection)
         if (notification.xselection.property == None)
             continue;
 
-        XCheckIfEvent(_glfw.x11.display,
-                      &dummy,
-                      isSelPropNewValueNotify,
-                      (XPointer) &notification);
-
-        XGetWindowProperty(_glfw.x11.display,
-                           notification.xselection.requestor,
-                           notification.xselection.property,
-                           0,
-                           LONG_MAX,
-                           True,
-                           AnyPropertyType,
-                           &actualType,
-                           &actualFormat,
-                           &itemCount,
-                           &bytesAfter,
-                           (unsigned char**) &data);
+        data = (char*) readSelection(&notification, &actualType, &length);
 
         if (actualType == _glfw.x11.INCR)
         {
-            size_t size = 1;
-            char* string = NULL;
-
-            for (;;)
+            if (data)
             {
-                while (!XCheckIfEvent(_glfw.x11.display,
-                                      &dummy,
-                                      isSelPropNewValueNotify,
-                                      (XPointer) &notification))
-                {
-                    waitForX11Event(NULL);
-                }
-
-                XFree(data);
-                XGetWindowProperty(_glfw.x11.display,
-                                   notification.xselection.requestor,
-                                   notification.xselection.property,
-                                   0,
-                                   LONG_MAX,
-                                   True,
-                                   AnyPropertyType,
-                                   &actualType,
-                                   &actualFormat,
-                                   &itemCount,
-                                   &bytesAfter,
-                                   (unsigned char**) &data);
-
-                if (itemCount)
+                if (targets[i] == XA_STRING)
                 {
-                    size += itemCount;
-                    string = _glfw_realloc(string, size);
-                    string[size - itemCount - 1] = '\0';
-                    strcat(string, data);
-                }
-
-                if (!itemCount)
-                {
-                    if (string)
-                    {
-                        if (targets[i] == XA_STRING)
-                        {
-                            *selectionString = convertLatin1toUTF8(string);
-                            _glfw_free(string);
-                        }
-                        else
-                            *selectionString = string;
-                    }
-
-                    break;
+                    *selectionString = convertLatin1toUTF8(data);
+                    _glfw_free(data);
                 }
+                else
+                    *selectionString = data;
             }
         }
-        else if (actualType == targets[i])
+        else
         {
-            if (targets[i] == XA_STRING)
-                *selectionString = convertLatin1toUTF8(data);
-            else
-                *selectionString = _glfw_strdup(data);
-        }
+            if (actualType == targets[i])
+            {
+                if (targets[i] == XA_STRING)
+                    *selectionString = convertLatin1toUTF8(data);
+                else
+                    *selectionString = _glfw_strdup(data);
+            }
 
-        XFree(data);
+            XFree(data);
+        }
 
         if (*selectionString)
             break;
@@ -1079,6 +1431,169 @@ static const char* getSelectionString(Atom selection)
     return *selectionString;
 }
 
+// Asks the clipboard owner to convert the clipboard to the specified target
+// for glfwRequestClipboardString
+//
+static void convertClipboardRequest(Atom target)
+{
+    _glfw_free(_glfw.x11.clipboardRequest.string);
+    memset(&_glfw.x11.clipboardRequest, 0, sizeof(_glfw.x11.clipboardRequest));
+    _glfw.x11.clipboardRequest.target = target;
+
+    XConvertSelection(_glfw.x11.display,
+                      _glfw.x11.CLIPBOARD,
+                      target,
+                      _glfw.x11.GLFW_CLIPBOARD_REQUEST,
+                      _glfw.x11.clipboardRequestHandle,
+                      CurrentTime);
+    XFlush(_glfw.x11.display);
+}
+
+// Reports the result of the clipboard transfer for glfwRequestClipboardString
+//
+static void finishClipboardRequest(GLFWbool success)
+{
+    char* string = _glfw.x11.clipboardRequest.string;
+    const Atom target = _glfw.x11.clipboardRequest.target;
+
+    // The callbacks may make new requests
+    memset(&_glfw.x11.clipboardRequest, 0, sizeof(_glfw.x11.clipboardRequest));
+
+    if (success && target == XA_STRING)
+    {
+        char* converted = convertLatin1toUTF8(string);
+        _glfw_free(string);
+        string = converted;
+    }
+    else if (!success)
+    {
+        _glfw_free(string);
+        string = NULL;
+
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Failed to convert selection to string");
+    }
+
+    _glfwInputClipboardString(string);
+    _glfw_free(string);
+}
+
+// Tries the next target for glfwRequestClipboardString after the clipboard
+// owner failed to convert to the current one
+//
+static void retryClipboardRequest(void)
+{
+    if (_glfw.x11.clipboardRequest.target == _glfw.x11.UTF8_STRING)
+        convertClipboardRequest(XA_STRING);
+    else
+        finishClipboardRequest(GLFW_FALSE);
+}
+
+// Reads the reply of the clipboard owner to glfwRequestClipboardString
+//
+static void handleClipboardNotify(const XSelectionEvent* event)
+{
+    if (!_glfw.x11.clipboardRequest.target ||
+        _glfw.x11.clipboardRequest.incremental ||
+        event->selection != _glfw.x11.CLIPBOARD ||
+        event->target != _glfw.x11.clipboardRequest.target)
+    {
+        return;
+    }
+
+    if (event->property == None)
+    {
+        retryClipboardRequest();
+        return;
+    }
+
+    unsigned char* data = NULL;
+    Atom actualType;
+    int actualFormat;
+    unsigned long itemCount, bytesAfter;
+
+    XGetWindowProperty(_glfw.x11.display,
+                       event->requestor,
+                       event->property,
+                       0,
+                       LONG_MAX,
+                       True,
+                       AnyPropertyType,
+                       &actualType,
+                       &actualFormat,
+                       &itemCount,
+                       &bytesAfter,
+                       &data);
+
+    if (actualType == _glfw.x11.INCR)
+    {
+        // Deleting the INCR property tells the owner to start sending chunks,
+        // which arrive as PropertyNotify events
+        reserveSelectionData(&_glfw.x11.clipboardRequest.string,
+                             &_glfw.x11.clipboardRequest.length,
+                             &_glfw.x11.clipboardRequest.size,
+                             data, itemCount);
+        _glfw.x11.clipboardRequest.incremental = GLFW_TRUE;
+    }
+    else if (actualType == _glfw.x11.clipboardRequest.target)
+    {
+        finishClipboardRequest(appendSelectionData(&_glfw.x11.clipboardRequest.string,
+                                                   &_glfw.x11.clipboardRequest.length,
+                                                   &_glfw.x11.clipboardRequest.size,
+                                                   (const char*) data, itemCount));
+    }
+    else
+        retryClipboardRequest();
+
+    if (data)
+        XFree(data);
+}
+
+// Reads a chunk of an incremental clipboard transfer for
+// glfwRequestClipboardString
+//
+static void handleClipboardProperty(const XPropertyEvent* event)
+{
+    if (!_glfw.x11.clipboardRequest.incremental ||
+        event->state != PropertyNewValue ||
+        event->atom != _glfw.x11.GLFW_CLIPBOARD_REQUEST)
+    {
+        return;
+    }
+
+    unsigned char* data = NULL;
+    Atom actualType;
+    int actualFormat;
+    unsigned long itemCount, bytesAfter;
+
+    XGetWindowProperty(_glfw.x11.display,
+                       event->window,
+                       event->atom,
+                       0,
+                       LONG_MAX,
+                       True,
+                       AnyPropertyType,
+                       &actualType,
+                       &actualFormat,
+                       &itemCount,
+                       &bytesAfter,
+                       &data);
+
+    // A zero-length chunk ends the transfer
+    if (!itemCount)
+        finishClipboardRequest(_glfw.x11.clipboardRequest.length > 0);
+    else if (!appendSelectionData(&_glfw.x11.clipboardRequest.string,
+                                  &_glfw.x11.clipboardRequest.length,
+                                  &_glfw.x11.clipboardRequest.size,
+                                  (const char*) data, itemCount))
+    {
+        finishClipboardRequest(GLFW_FALSE);
+    }
+
+    if (data)
+        XFree(data);
+}
+
 // Make the specified window and its video mode active on its monitor
 //
 static void acquireMonitor(_GLFWwindow* window)
@@ -1156,14 +1671,27 @@ static void processEvent(XEvent *event)
 
     if (_glfw.x11.randr.available)
     {
-        if (event->type == _glfw.x11.randr.eventBase + RRNotify)
+        if (event->type == _glfw.x11.randr.eventBase + RRNotify ||
+            event->type == _glfw.x11.randr.eventBase + RRScreenChangeNotify)
         {
             XRRUpdateConfiguration(event);
             _glfwPollMonitorsX11();
+            _glfwInputMonitorChange(NULL);
             return;
         }
     }
 
+    if (event->type == PropertyNotify && event->xproperty.window == _glfw.x11.root)
+    {
+        if (event->xproperty.atom == _glfw.x11.NET_WORKAREA ||
+            event->xproperty.atom == _glfw.x11.NET_CURRENT_DESKTOP)
+        {
+            _glfwInputMonitorChange(NULL);
+        }
+
+        return;
+    }
+
     if (_glfw.x11.xkb.available)
     {
         if (event->type == _glfw.x11.xkb.eventBase + XkbEventCode)
@@ -1222,6 +1750,22 @@ static void processEvent(XEvent *event)
         return;
     }
 
+    if (event->type == PropertyNotify)
+    {
+        if (handleTransferProperty(&event->xproperty))
+            return;
+    }
+
+    if (event->xany.window == _glfw.x11.clipboardRequestHandle)
+    {
+        if (event->type == SelectionNotify)
+            handleClipboardNotify(&event->xselection);
+        else if (event->type == PropertyNotify)
+            handleClipboardProperty(&event->xproperty);
+
+        return;
+    }
+
     _GLFWwindow* window = NULL;
     if (XFindContext(_glfw.x11.display,
                      event->xany.window,
@@ -1703,16 +2247,7 @@ static void processEvent(XEvent *event)
                                               (unsigned char**) &data);
 
                 if (result)
-                {
-                    int count;
-                    char** paths = _glfwParseUriList(data, &count);
-
-                    _glfwInputDrop(window, count, (const char**) paths);
-
-                    for (int i = 0;  i < count;  i++)
-                        _glfw_free(paths[i]);
-                    _glfw_free(paths);
-                }
+                    _glfwInputDropUriList(window, data);
 
                 if (data)
                     XFree(data);
@@ -1838,6 +2373,44 @@ static void processEvent(XEvent *event)
 //////                       GLFW internal API                      //////
 //////////////////////////////////////////////////////////////////////////
 
+// Starts loading the theme images of all standard cursor shapes in the
+// background, if requested by the application
+//
+void _glfwPreloadStandardCursorsX11(void)
+{
+    if (!_glfw.x11.xcursor.handle || !_glfw.hints.init.preloadCursors)
+        return;
+
+    const char* theme = XcursorGetTheme(_glfw.x11.display);
+    if (!theme)
+        return;
+
+    _glfw.x11.cursorPreload.theme = _glfw_strdup(theme);
+    _glfw.x11.cursorPreload.size = XcursorGetDefaultSize(_glfw.x11.display);
+
+    if (!_glfwStartCursorPreload(loadStandardCursorImages))
+    {
+        _glfw_free(_glfw.x11.cursorPreload.theme);
+        _glfw.x11.cursorPreload.theme = NULL;
+    }
+}
+
+// Waits for the standard cursor images to finish loading and frees them
+//
+void _glfwFreeStandardCursorsX11(void)
+{
+    _glfwFinishCursorPreload();
+
+    for (int i = 0;  i < _GLFW_STANDARD_CURSOR_COUNT;  i++)
+    {
+        if (_glfw.x11.cursorPreload.images[i])
+            XcursorImageDestroy(_glfw.x11.cursorPreload.images[i]);
+    }
+
+    _glfw_free(_glfw.x11.cursorPreload.theme);
+    memset(&_glfw.x11.cursorPreload, 0, sizeof(_glfw.x11.cursorPreload));
+}
+
 // Retrieve a single window property of the specified type
 // Inspired by fghGetWindowProperty from freeglut
 //
@@ -1898,6 +2471,10 @@ void _glfwPushSelectionToManagerX11(void)
                     handleSelectionRequest(&event);
                     break;
 
+                case PropertyNotify:
+                    handleTransferProperty(&event.xproperty);
+                    break;
+
                 case SelectionNotify:
                 {
                     if (event.xselection.target == _glfw.x11.SAVE_TARGETS)
@@ -2119,13 +2696,9 @@ void _glfwSetWindowIconX11(_GLFWwindow* window, int count, const GLFWimage* imag
             *target++ = images[i].width;
             *target++ = images[i].height;
 
-            for (int j = 0;  j < images[i].width * images[i].height;  j++)
-            {
-                *target++ = (((unsigned long) images[i].pixels[j * 4 + 0]) << 16) |
-                            (((unsigned long) images[i].pixels[j * 4 + 1]) <<  8) |
-                            (((unsigned long) images[i].pixels[j * 4 + 2]) <<  0) |
-                            (((unsigned long) images[i].pixels[j * 4 + 3]) << 24);
-            }
+            _glfwConvertRGBAtoARGBLong(images[i].pixels, target,
+                                       images[i].width * images[i].height);
+            target += images[i].width * images[i].height;
         }
 
         // NOTE: XChangeProperty expects 32-bit values like the image data above to be
@@ -2781,11 +3354,9 @@ GLFWbool _glfwRawMouseMotionSupportedX11(void)
 
 void _glfwPollEventsX11(void)
 {
-    drainEmptyEvents();
-
 #if defined(GLFW_BUILD_LINUX_JOYSTICK)
     if (_glfw.joysticksInitialized)
-        _glfwDetectJoystickConnectionLinux();
+        _glfwPollJoysticksLinux();
 #endif
     XPending(_glfw.x11.display);
 
@@ -2828,7 +3399,7 @@ void _glfwWaitEventsTimeoutX11(double timeout)
 
 void _glfwPostEmptyEventX11(void)
 {
-    writeEmptyEvent();
+    _glfwPostEmptyEventPOSIX(&_glfw.x11.emptyEvent);
 }
 
 void _glfwGetCursorPosX11(_GLFWwindow* window, double* xpos, double* ypos)
@@ -2950,51 +3521,29 @@ GLFWbool _glfwCreateStandardCursorX11(_GLFWcursor* cursor, int shape)
 {
     if (_glfw.x11.xcursor.handle)
     {
-        char* theme = XcursorGetTheme(_glfw.x11.display);
-        if (theme)
-        {
-            const int size = XcursorGetDefaultSize(_glfw.x11.display);
-            const char* name = NULL;
+        _glfwFinishCursorPreload();
 
-            switch (shape)
-            {
-                case GLFW_ARROW_CURSOR:
-                    name = "default";
-                    break;
-                case GLFW_IBEAM_CURSOR:
-                    name = "text";
-                    break;
-                case GLFW_CROSSHAIR_CURSOR:
-                    name = "crosshair";
-                    break;
-                case GLFW_POINTING_HAND_CURSOR:
-                    name = "pointer";
-                    break;
-                case GLFW_RESIZE_EW_CURSOR:
-                    name = "ew-resize";
-                    break;
-                case GLFW_RESIZE_NS_CURSOR:
-                    name = "ns-resize";
-                    break;
-                case GLFW_RESIZE_NWSE_CURSOR:
-                    name = "nwse-resize";
-                    break;
-                case GLFW_RESIZE_NESW_CURSOR:
-                    name = "nesw-resize";
-                    break;
-                case GLFW_RESIZE_ALL_CURSOR:
-                    name = "all-scroll";
-                    break;
-                case GLFW_NOT_ALLOWED_CURSOR:
-                    name = "not-allowed";
-                    break;
-            }
-
-            XcursorImage* image = XcursorLibraryLoadImage(name, theme, size);
+        if (_glfw.x11.cursorPreload.theme)
+        {
+            const XcursorImage* image =
+                _glfw.x11.cursorPreload.images[shape - GLFW_ARROW_CURSOR];
             if (image)
-            {
                 cursor->x11.handle = XcursorImageLoadCursor(_glfw.x11.display, image);
-                XcursorImageDestroy(image);
+        }
+        else
+        {
+            char* theme = XcursorGetTheme(_glfw.x11.display);
+            if (theme)
+            {
+                const int size = XcursorGetDefaultSize(_glfw.x11.display);
+                const char* name = getStandardCursorName(shape);
+
+                XcursorImage* image = XcursorLibraryLoadImage(name, theme, size);
+                if (image)
+                {
+                    cursor->x11.handle = XcursorImageLoadCursor(_glfw.x11.display, image);
+                    XcursorImageDestroy(image);
+                }
             }
         }
     }
@@ -3066,6 +3615,9 @@ void _glfwSetClipboardStringX11(const char* string)
     _glfw_free(_glfw.x11.clipboardString);
     _glfw.x11.clipboardString = copy;
 
+    // Any transfers of the previous clipboard data cannot be completed
+    _glfw.x11.transferCount = 0;
+
     XSetSelectionOwner(_glfw.x11.display,
                        _glfw.x11.CLIPBOARD,
                        _glfw.x11.helperWindowHandle,
@@ -3084,6 +3636,142 @@ const char* _glfwGetClipboardStringX11(void)
     return getSelectionString(_glfw.x11.CLIPBOARD);
 }
 
+GLFWbool _glfwSetClipboardDataX11(void)
+{
+    const int count = _glfw.clipboardData.typeCount;
+
+    _glfw_free(_glfw.x11.clipboardTypes);
+    _glfw.x11.clipboardTypes = _glfw_calloc(count, sizeof(Atom));
+    if (!_glfw.x11.clipboardTypes)
+        return GLFW_FALSE;
+
+    XInternAtoms(_glfw.x11.display,
+                 _glfw.clipboardData.types,
+                 count,
+                 False,
+                 _glfw.x11.clipboardTypes);
+
+    _glfw_free(_glfw.x11.clipboardString);
+    _glfw.x11.clipboardString = NULL;
+
+    // Any transfers of the previous clipboard data cannot be completed
+    _glfw.x11.transferCount = 0;
+
+    XSetSelectionOwner(_glfw.x11.display,
+                       _glfw.x11.CLIPBOARD,
+                       _glfw.x11.helperWindowHandle,
+                       CurrentTime);
+
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) !=
+        _glfw.x11.helperWindowHandle)
+    {
+        _glfwInputError(GLFW_PLATFORM_ERROR,
+                        "X11: Failed to become owner of clipboard selection");
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+const void* _glfwGetClipboardDataX11(const char* type, size_t* size)
+{
+    Atom actualType;
+    XEvent notification;
+
+    if (_glfw.x11.clipboardDataIncremental)
+        _glfw_free(_glfw.x11.clipboardData);
+    else if (_glfw.x11.clipboardData)
+        XFree(_glfw.x11.clipboardData);
+
+    _glfw.x11.clipboardData = NULL;
+    _glfw.x11.clipboardDataIncremental = GLFW_FALSE;
+
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) ==
+        _glfw.x11.helperWindowHandle)
+    {
+        // The data is returned directly when the clipboard is ours
+        if (_glfwClipboardDataOffered(type))
+        {
+            const void* data = _glfw.clipboardData.callback(type, size);
+            if (data)
+                return data;
+        }
+        else if (_glfw.x11.clipboardString &&
+                 strcmp(type, "text/plain;charset=utf-8") == 0)
+        {
+            *size = strlen(_glfw.x11.clipboardString);
+            return _glfw.x11.clipboardString;
+        }
+
+        *size = 0;
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Clipboard data is not available as %s", type);
+        return NULL;
+    }
+
+    const Atom target = XInternAtom(_glfw.x11.display, type, False);
+
+    XConvertSelection(_glfw.x11.display,
+                      _glfw.x11.CLIPBOARD,
+                      target,
+                      _glfw.x11.GLFW_SELECTION,
+                      _glfw.x11.helperWindowHandle,
+                      CurrentTime);
+
+    notification.xselection.requestor = _glfw.x11.helperWindowHandle;
+    notification.xselection.selection = _glfw.x11.CLIPBOARD;
+    notification.xselection.target = target;
+    notification.xselection.property = _glfw.x11.GLFW_SELECTION;
+
+    while (!XCheckIfEvent(_glfw.x11.display,
+                          &notification,
+                          isSelectionNotify,
+                          (XPointer) &notification))
+    {
+        waitForX11Event(NULL);
+    }
+
+    if (notification.xselection.property != None)
+    {
+        _glfw.x11.clipboardData = readSelection(&notification, &actualType, size);
+        _glfw.x11.clipboardDataIncremental = (actualType == _glfw.x11.INCR);
+
+        if (actualType == None && _glfw.x11.clipboardData)
+        {
+            XFree(_glfw.x11.clipboardData);
+            _glfw.x11.clipboardData = NULL;
+        }
+    }
+
+    if (!_glfw.x11.clipboardData)
+    {
+        *size = 0;
+        _glfwInputError(GLFW_FORMAT_UNAVAILABLE,
+                        "X11: Clipboard data is not available as %s", type);
+    }
+
+    return _glfw.x11.clipboardData;
+}
+
+void _glfwRequestClipboardStringX11(void)
+{
+    if (XGetSelectionOwner(_glfw.x11.display, _glfw.x11.CLIPBOARD) ==
+        _glfw.x11.helperWindowHandle)
+    {
+        // There is no other client to wait for when the clipboard is ours
+        _glfwInputClipboardString(_glfw.x11.clipboardString);
+        return;
+    }
+
+    convertClipboardRequest(_glfw.x11.UTF8_STRING);
+}
+
+void _glfwCancelClipboardRequestX11(void)
+{
+    _glfw_free(_glfw.x11.clipboardRequest.string);
+    memset(&_glfw.x11.clipboardRequest, 0, sizeof(_glfw.x11.clipboardRequest));
+}
+
 EGLenum _glfwGetEGLPlatformX11(EGLint** attribs)
 {
     if (_glfw.egl.ANGLE_platform_angle)
@@ -43,9 +43,14 @@
  #define MODIFIER GLFW_MOD_CONTROL
 #endif
 
+static int asynchronous = GLFW_FALSE;
+
 static void usage(void)
 {
-    printf("Usage: clipboard [-h]\n");
+    printf("Usage: clipboard [-h] [-a]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -a request the clipboard without waiting for it\n");
 }
 
 static void error_callback(int error, const char* description)
@@ -53,6 +58,14 @@ static void error_callback(int error, const char* description)
     fprintf(stderr, "Error: %s\n", description);
 }
 
+static void clipboard_callback(GLFWwindow* window, const char* string)
+{
+    if (string)
+        printf("Clipboard contains \"%s\"\n", string);
+    else
+        printf("Clipboard does not contain a string\n");
+}
+
 static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
     if (action != GLFW_PRESS)
@@ -65,7 +78,12 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
             break;
 
         case GLFW_KEY_V:
-            if (mods == MODIFIER)
+            if (mods == MODIFIER && asynchronous)
+            {
+                glfwRequestClipboardString(window, clipboard_callback, 1.0);
+                printf("Requested clipboard contents\n");
+            }
+            else if (mods == MODIFIER)
             {
                 const char* string;
 
@@ -93,7 +111,7 @@ int main(int argc, char** argv)
     int ch;
     GLFWwindow* window;
 
-    while ((ch = getopt(argc, argv, "h")) != -1)
+    while ((ch = getopt(argc, argv, "ha")) != -1)
     {
         switch (ch)
         {
@@ -101,6 +119,10 @@ int main(int argc, char** argv)
                 usage();
                 exit(EXIT_SUCCESS);
 
+            case 'a':
+                asynchronous = GLFW_TRUE;
+                break;
+
             default:
                 usage();
                 exit(EXIT_FAILURE);
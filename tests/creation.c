@@ -0,0 +1,231 @@
+//========================================================================
+// Window creation benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates and destroys many hidden windows with OpenGL contexts
+// using the same hints, like a tool opening many views, and measures how long
+// each window takes to create
+//
+// It then does the same with a window pool and checks that windows returned to
+// the pool are handed out again in the state of a new window
+//
+// It uses the platform chosen by GLFW, or with -n the null platform with
+// surfaceless EGL
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: creation [-h] [-n] [-c COUNT]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -n use the null platform with EGL\n");
+    printf("  -c the number of windows to create\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int compare_times(const void* first, const void* second)
+{
+    const double a = *(const double*) first;
+    const double b = *(const double*) second;
+    return (a > b) - (a < b);
+}
+
+static void print_times(const char* label, double* times, int count)
+{
+    printf("%s: first window created in %0.1f us\n", label, times[0] * 1e6);
+
+    // The median is less disturbed by the occasional slow window
+    qsort(times + 1, count - 1, sizeof(double), compare_times);
+    printf("%s: later windows created in %0.1f us median, %0.1f us at most\n",
+           label, times[1 + (count - 1) / 2] * 1e6, times[count - 1] * 1e6);
+}
+
+// Changes state that must not survive the window being returned to its pool
+//
+static void modify_window(GLFWwindow* window)
+{
+    glfwSetWindowUserPointer(window, window);
+    glfwSetWindowShouldClose(window, GLFW_TRUE);
+    glfwSetWindowAttrib(window, GLFW_RESIZABLE, GLFW_FALSE);
+    glfwSetWindowSizeLimits(window, 100, 100, 1000, 1000);
+    glfwSetInputMode(window, GLFW_STICKY_KEYS, GLFW_TRUE);
+    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+    glfwSetInputMode(window, GLFW_UNLIMITED_MOUSE_BUTTONS, GLFW_TRUE);
+}
+
+static int check_window(GLFWwindow* window, int width, int height)
+{
+    int actual_width, actual_height;
+    glfwGetWindowSize(window, &actual_width, &actual_height);
+
+    if (actual_width != width || actual_height != height ||
+        glfwGetWindowUserPointer(window) ||
+        glfwWindowShouldClose(window) ||
+        glfwGetWindowAttrib(window, GLFW_VISIBLE) ||
+        !glfwGetWindowAttrib(window, GLFW_RESIZABLE) ||
+        glfwGetInputMode(window, GLFW_STICKY_KEYS) ||
+        glfwGetInputMode(window, GLFW_CURSOR) != GLFW_CURSOR_NORMAL ||
+        glfwGetInputMode(window, GLFW_UNLIMITED_MOUSE_BUTTONS))
+    {
+        fprintf(stderr, "Pooled window was not handed out in the state of a new window\n");
+        return GLFW_FALSE;
+    }
+
+    return GLFW_TRUE;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, count = 100;
+    int null = GLFW_FALSE;
+    int result = EXIT_SUCCESS;
+    double* times;
+
+    while ((ch = getopt(argc, argv, "hnc:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'n':
+                null = GLFW_TRUE;
+                break;
+
+            case 'c':
+                count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 2)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (null)
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    if (null)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+
+    times = calloc(count, sizeof(double));
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_DEPTH_BITS, 24);
+    glfwWindowHint(GLFW_STENCIL_BITS, 8);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const double start = glfwGetTime();
+
+        GLFWwindow* window = glfwCreateWindow(640, 480, "Window Creation", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        times[i] = glfwGetTime() - start;
+        glfwDestroyWindow(window);
+    }
+
+    print_times("Unpooled", times, count);
+
+    double start = glfwGetTime();
+
+    if (!glfwPoolWindows(1, NULL))
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    printf("Pooled: pool of one window created in %0.3f ms\n",
+           (glfwGetTime() - start) * 1e3);
+
+    GLFWwindow* pooled = NULL;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        // Vary the size to check that it is applied at hand out
+        const int width = 320 + i % 2 * 320;
+        const int height = 240 + i % 2 * 240;
+
+        start = glfwGetTime();
+
+        GLFWwindow* window = glfwCreateWindow(width, height, "Window Creation", NULL, NULL);
+        if (!window)
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        times[i] = glfwGetTime() - start;
+
+        if (i == 0)
+            pooled = window;
+        else if (window != pooled)
+        {
+            fprintf(stderr, "Window was not handed out from the pool\n");
+            result = EXIT_FAILURE;
+        }
+
+        if (!check_window(window, width, height))
+            result = EXIT_FAILURE;
+
+        modify_window(window);
+        glfwDestroyWindow(window);
+    }
+
+    print_times("Pooled", times, count);
+
+    free(times);
+    glfwTerminate();
+    exit(result);
+}
+
@@ -26,6 +26,10 @@
 // This test provides an interface to the cursor image and cursor mode
 // parts of the API.
 //
+// With -i it instead measures how long it takes to switch between the frames
+// of the animated cursor, both with and without the cursor cache, and how long
+// the first use of the standard cursors takes, with and without preloading
+//
 // Custom cursor image generation by urraka.
 //
 //========================================================================
@@ -44,6 +48,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "getopt.h"
 #include "linmath.h"
 
 #define CURSOR_FRAME_COUNT 60
@@ -71,8 +76,29 @@ static int wait_events = GLFW_TRUE;
 static int animate_cursor = GLFW_FALSE;
 static int track_cursor = GLFW_FALSE;
 static GLFWcursor* standard_cursors[10];
+static const int standard_shapes[10] =
+{
+    GLFW_ARROW_CURSOR,
+    GLFW_IBEAM_CURSOR,
+    GLFW_CROSSHAIR_CURSOR,
+    GLFW_POINTING_HAND_CURSOR,
+    GLFW_RESIZE_EW_CURSOR,
+    GLFW_RESIZE_NS_CURSOR,
+    GLFW_RESIZE_NWSE_CURSOR,
+    GLFW_RESIZE_NESW_CURSOR,
+    GLFW_RESIZE_ALL_CURSOR,
+    GLFW_NOT_ALLOWED_CURSOR
+};
 static GLFWcursor* tracking_cursor = NULL;
 
+static void usage(void)
+{
+    printf("Usage: cursor [-h] [-i ITERATIONS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -i benchmark cycling through the animation frames this many times\n");
+}
+
 static void error_callback(int error, const char* description)
 {
     fprintf(stderr, "Error: %s\n", description);
@@ -94,15 +120,13 @@ static float star(int x, int y, float t)
     return (float) fmax(0.f, fmin(1.f, i * salpha * 0.2f + salpha * xalpha * yalpha));
 }
 
-static GLFWcursor* create_cursor_frame(float t)
+static void generate_cursor_frame(unsigned char* buffer, float t)
 {
     int i = 0, x, y;
-    unsigned char buffer[64 * 64 * 4];
-    const GLFWimage image = { 64, 64, buffer };
 
-    for (y = 0;  y < image.width;  y++)
+    for (y = 0;  y < 64;  y++)
     {
-        for (x = 0;  x < image.height;  x++)
+        for (x = 0;  x < 64;  x++)
         {
             buffer[i++] = 255;
             buffer[i++] = 255;
@@ -110,10 +134,154 @@ static GLFWcursor* create_cursor_frame(float t)
             buffer[i++] = (unsigned char) (255 * star(x, y, t));
         }
     }
+}
+
+static GLFWcursor* create_cursor_frame(float t)
+{
+    unsigned char buffer[64 * 64 * 4];
+    const GLFWimage image = { 64, 64, buffer };
 
+    generate_cursor_frame(buffer, t);
     return glfwCreateCursor(&image, image.width / 2, image.height / 2);
 }
 
+// Creates each frame of the animated cursor, sets it and destroys the previous
+// frame, like an application generating its cursor image on the fly, and
+// returns the average time per frame switch in seconds
+//
+static double benchmark_cursor_switch(const unsigned char* frames,
+                                      int iterations,
+                                      int cache_limit)
+{
+    int i, j;
+    double start, elapsed;
+    GLFWwindow* window;
+    GLFWcursor* current = NULL;
+
+    glfwInitHint(GLFW_CURSOR_CACHE_LIMIT, cache_limit);
+
+    if (!glfwInit())
+        return -1.0;
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(640, 480, "Cursor Benchmark", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        return -1.0;
+    }
+
+    glfwPollEvents();
+
+    start = glfwGetTime();
+
+    for (i = 0;  i < iterations;  i++)
+    {
+        for (j = 0;  j < CURSOR_FRAME_COUNT;  j++)
+        {
+            const GLFWimage image = { 64, 64, (unsigned char*) frames + j * 64 * 64 * 4 };
+            GLFWcursor* cursor = glfwCreateCursor(&image, 32, 32);
+            if (!cursor)
+            {
+                glfwTerminate();
+                return -1.0;
+            }
+
+            glfwSetCursor(window, cursor);
+            glfwDestroyCursor(current);
+            current = cursor;
+        }
+    }
+
+    elapsed = glfwGetTime() - start;
+
+    glfwDestroyCursor(current);
+    glfwTerminate();
+
+    return elapsed / ((double) iterations * CURSOR_FRAME_COUNT);
+}
+
+// Creates and sets every standard cursor after the specified delay following
+// initialization and returns how long that first use took in seconds
+//
+static double benchmark_standard_cursors(int preload, double delay)
+{
+    int i;
+    double start, elapsed;
+    GLFWwindow* window;
+
+    glfwInitHint(GLFW_PRELOAD_STANDARD_CURSORS, preload);
+
+    if (!glfwInit())
+        return -1.0;
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(640, 480, "Cursor Benchmark", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        return -1.0;
+    }
+
+    // This stands in for the application doing other work before the cursors
+    // are first needed
+    start = glfwGetTime();
+    while (glfwGetTime() - start < delay)
+        glfwWaitEventsTimeout(delay - (glfwGetTime() - start));
+
+    start = glfwGetTime();
+
+    for (i = 0;  i < sizeof(standard_cursors) / sizeof(standard_cursors[0]);  i++)
+    {
+        standard_cursors[i] = glfwCreateStandardCursor(standard_shapes[i]);
+        glfwSetCursor(window, standard_cursors[i]);
+    }
+
+    elapsed = glfwGetTime() - start;
+
+    glfwTerminate();
+    return elapsed;
+}
+
+static int benchmark(int iterations)
+{
+    int i;
+    double uncached, cached, immediate, preloaded, delayed;
+    unsigned char* frames = malloc(CURSOR_FRAME_COUNT * 64 * 64 * 4);
+
+    for (i = 0;  i < CURSOR_FRAME_COUNT;  i++)
+        generate_cursor_frame(frames + i * 64 * 64 * 4, i / (float) CURSOR_FRAME_COUNT);
+
+    uncached = benchmark_cursor_switch(frames, iterations, 0);
+    cached = benchmark_cursor_switch(frames, iterations, CURSOR_FRAME_COUNT);
+
+    free(frames);
+
+    immediate = benchmark_standard_cursors(GLFW_FALSE, 0.0);
+    preloaded = benchmark_standard_cursors(GLFW_TRUE, 0.0);
+    delayed = benchmark_standard_cursors(GLFW_TRUE, 0.25);
+
+    if (uncached < 0.0 || cached < 0.0 ||
+        immediate < 0.0 || preloaded < 0.0 || delayed < 0.0)
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf("Cursor switch without cache: %0.3f us on average over %i switches\n",
+           uncached * 1e6, iterations * CURSOR_FRAME_COUNT);
+    printf("Cursor switch with cache:    %0.3f us on average over %i switches\n",
+           cached * 1e6, iterations * CURSOR_FRAME_COUNT);
+    printf("Standard cursors without preload: %0.3f ms\n", immediate * 1e3);
+    printf("Standard cursors right after init with preload: %0.3f ms\n",
+           preloaded * 1e3);
+    printf("Standard cursors 250 ms after init with preload: %0.3f ms\n",
+           delayed * 1e3);
+
+    return EXIT_SUCCESS;
+}
+
 static GLFWcursor* create_tracking_cursor(void)
 {
     int i = 0, x, y;
@@ -324,17 +492,38 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
     }
 }
 
-int main(void)
+int main(int argc, char** argv)
 {
-    int i;
+    int ch, i, iterations = 0;
     GLFWwindow* window;
     GLFWcursor* star_cursors[CURSOR_FRAME_COUNT];
     GLFWcursor* current_frame = NULL;
     GLuint vertex_buffer, vertex_shader, fragment_shader, program;
     GLint mvp_location, vpos_location;
 
+    while ((ch = getopt(argc, argv, "hi:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
     glfwSetErrorCallback(error_callback);
 
+    if (iterations > 0)
+        exit(benchmark(iterations));
+
     if (!glfwInit())
         exit(EXIT_FAILURE);
 
@@ -356,22 +545,7 @@ int main(void)
     }
 
     for (i = 0;  i < sizeof(standard_cursors) / sizeof(standard_cursors[0]);  i++)
-    {
-        const int shapes[] = {
-            GLFW_ARROW_CURSOR,
-            GLFW_IBEAM_CURSOR,
-            GLFW_CROSSHAIR_CURSOR,
-            GLFW_POINTING_HAND_CURSOR,
-            GLFW_RESIZE_EW_CURSOR,
-            GLFW_RESIZE_NS_CURSOR,
-            GLFW_RESIZE_NWSE_CURSOR,
-            GLFW_RESIZE_NESW_CURSOR,
-            GLFW_RESIZE_ALL_CURSOR,
-            GLFW_NOT_ALLOWED_CURSOR
-        };
-
-        standard_cursors[i] = glfwCreateStandardCursor(shapes[i]);
-    }
+        standard_cursors[i] = glfwCreateStandardCursor(standard_shapes[i]);
 
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
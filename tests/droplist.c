@@ -0,0 +1,242 @@
+//========================================================================
+// Path drop parsing benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test drops a large synthetic text/uri-list on a null platform window
+// and measures how long it takes to parse it and deliver the paths, both to
+// the path drop callback and in chunks to the path drop stream callback
+//
+// The delivered paths are verified during an initial drop that is not timed
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#define GLFW_EXPOSE_NATIVE_NULL
+#define GLFW_NATIVE_INCLUDE_NONE
+#include <GLFW/glfw3native.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+
+static int delivered = 0;
+static int chunks = 0;
+static int finished = GLFW_FALSE;
+static double first_chunk = 0.0;
+static int valid = GLFW_TRUE;
+static int verify = GLFW_FALSE;
+
+static void usage(void)
+{
+    printf("Usage: droplist [-h] [-n ENTRIES] [-i ITERATIONS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -n the number of entries in the generated URI list\n");
+    printf("  -i the number of times to drop the URI list\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void check_path(const char* path, int index)
+{
+    char expected[256];
+
+    if (!verify)
+        return;
+
+    snprintf(expected, sizeof(expected),
+             "/home/user/assets/level %i/texture_%i#1.png", index / 100, index);
+
+    if (strcmp(path, expected) != 0)
+    {
+        if (valid)
+            fprintf(stderr, "Path %i is %s, expected %s\n", index, path, expected);
+
+        valid = GLFW_FALSE;
+    }
+}
+
+static void drop_callback(GLFWwindow* window, int count, const char* paths[])
+{
+    for (int i = 0;  i < count;  i++)
+        check_path(paths[i], delivered + i);
+
+    delivered += count;
+}
+
+static void drop_stream_callback(GLFWwindow* window, int count, const char* paths[], int last)
+{
+    if (chunks == 0)
+        first_chunk = glfwGetTime();
+
+    for (int i = 0;  i < count;  i++)
+        check_path(paths[i], delivered + i);
+
+    delivered += count;
+    chunks++;
+    finished = last;
+}
+
+// Generates a URI list like those of file managers, with a comment line,
+// percent-encoded characters, a mix of line endings and some files on other
+// hosts that are skipped
+//
+static char* generate_uri_list(int count)
+{
+    const size_t line_size = 128;
+    char* list = calloc(count * 2 + 1, line_size);
+    char* line = list;
+
+    line += sprintf(line, "# Dropped by the benchmark\r\n");
+
+    for (int i = 0;  i < count;  i++)
+    {
+        if (i % 10 == 5)
+            line += sprintf(line, "file://fileserver/share/texture_%i.png\r\n", i);
+
+        line += sprintf(line,
+                        "file://%s/home/user/assets/level%%20%i/texture_%i%%231.png%s",
+                        i % 2 ? "localhost" : "",
+                        i / 100, i,
+                        i % 3 ? "\r\n" : "\n");
+    }
+
+    return list;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, count = 100000, iterations = 10;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "hn:i:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'n':
+                count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 1 || iterations < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(640, 480, "Path Drop Parsing Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    char* list = generate_uri_list(count);
+    double drop_total = 0.0, stream_total = 0.0, first_total = 0.0;
+
+    glfwSetDropCallback(window, drop_callback);
+
+    verify = GLFW_TRUE;
+    glfwInjectNullDrop(window, list);
+    verify = GLFW_FALSE;
+
+    if (delivered != count)
+        valid = GLFW_FALSE;
+
+    for (int i = 0;  i < iterations;  i++)
+    {
+        delivered = 0;
+
+        const double start = glfwGetTime();
+        glfwInjectNullDrop(window, list);
+        drop_total += glfwGetTime() - start;
+
+        if (delivered != count)
+            valid = GLFW_FALSE;
+    }
+
+    glfwSetDropCallback(window, NULL);
+    glfwSetDropStreamCallback(window, drop_stream_callback);
+
+    for (int i = 0;  i < iterations;  i++)
+    {
+        delivered = 0;
+        chunks = 0;
+        finished = GLFW_FALSE;
+
+        const double start = glfwGetTime();
+        glfwInjectNullDrop(window, list);
+        stream_total += glfwGetTime() - start;
+        first_total += first_chunk - start;
+
+        if (delivered != count || !finished)
+            valid = GLFW_FALSE;
+    }
+
+    printf("Drop callback with %i paths: %0.3f ms on average over %i iterations\n",
+           count, drop_total / iterations * 1e3, iterations);
+    printf("Drop stream callback in %i chunks: %0.3f ms on average, "
+           "first chunk after %0.3f ms\n",
+           chunks, stream_total / iterations * 1e3, first_total / iterations * 1e3);
+
+    free(list);
+    glfwTerminate();
+
+    if (!valid)
+    {
+        fprintf(stderr, "The delivered paths did not match the URI list\n");
+        exit(EXIT_FAILURE);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+
@@ -0,0 +1,300 @@
+//========================================================================
+// Extension query test and benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates an OpenGL context on the null platform, with OSMesa by
+// default or with surfaceless EGL, and checks that glfwExtensionSupported
+// finds every extension reported by the context and rejects names that are
+// absent or only prefixes of real ones
+//
+// It then measures how long it takes to query sixty extensions, both with
+// glfwExtensionSupported and by searching the extension list directly
+//
+//========================================================================
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+
+#define PROBE_COUNT 60
+
+static int context_major;
+
+static void usage(void)
+{
+    printf("Usage: extensions [-h] [-e] [-l] [-i ITERATIONS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -e use EGL instead of OSMesa\n");
+    printf("  -l use a legacy OpenGL 2.1 context with a single extension string\n");
+    printf("  -i the number of times to query each extension\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+// Searches the extensions of the current context the way glfwExtensionSupported
+// used to, for comparison
+//
+static int search_extensions(const char* extension)
+{
+    if (context_major >= 3)
+    {
+        GLint count;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        for (GLint i = 0;  i < count;  i++)
+        {
+            if (strcmp((const char*) glGetStringi(GL_EXTENSIONS, i), extension) == 0)
+                return GLFW_TRUE;
+        }
+    }
+    else
+    {
+        const char* extensions = (const char*) glGetString(GL_EXTENSIONS);
+        const size_t length = strlen(extension);
+        const char* start = extensions;
+
+        while ((start = strstr(start, extension)))
+        {
+            if ((start == extensions || start[-1] == ' ') &&
+                (start[length] == ' ' || start[length] == '\0'))
+            {
+                return GLFW_TRUE;
+            }
+
+            start += length;
+        }
+    }
+
+    return GLFW_FALSE;
+}
+
+// Returns the extensions of the current context as a single array of
+// space-separated names
+//
+static char* get_extension_names(int* count)
+{
+    char* names;
+
+    if (context_major >= 3)
+    {
+        GLint i, total;
+        size_t size = 1;
+
+        glGetIntegerv(GL_NUM_EXTENSIONS, &total);
+
+        for (i = 0;  i < total;  i++)
+            size += strlen((const char*) glGetStringi(GL_EXTENSIONS, i)) + 1;
+
+        names = calloc(size, 1);
+
+        for (i = 0;  i < total;  i++)
+        {
+            strcat(names, (const char*) glGetStringi(GL_EXTENSIONS, i));
+            strcat(names, " ");
+        }
+    }
+    else
+    {
+        const char* extensions = (const char*) glGetString(GL_EXTENSIONS);
+        names = calloc(strlen(extensions) + 2, 1);
+        strcpy(names, extensions);
+        strcat(names, " ");
+    }
+
+    *count = 0;
+
+    for (char* c = strchr(names, ' ');  c;  c = strchr(c + 1, ' '))
+    {
+        *c = '\0';
+        (*count)++;
+    }
+
+    return names;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, iterations = 1000, legacy = GLFW_FALSE;
+    int api = GLFW_OSMESA_CONTEXT_API;
+    int result = EXIT_SUCCESS;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "heli:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'e':
+                api = GLFW_EGL_CONTEXT_API;
+                break;
+
+            case 'l':
+                legacy = GLFW_TRUE;
+                break;
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (iterations < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, api);
+
+    if (legacy)
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+    }
+    else
+    {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    }
+
+    window = glfwCreateWindow(64, 64, "Extension Query Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwMakeContextCurrent(window);
+    gladLoadGL(glfwGetProcAddress);
+
+    context_major = glfwGetWindowAttrib(window, GLFW_CONTEXT_VERSION_MAJOR);
+
+    int count;
+    char* names = get_extension_names(&count);
+    const char* probes[PROBE_COUNT];
+    char* absent[PROBE_COUNT];
+    int i, j;
+
+    // Every extension of the context must be found, while prefixes and names
+    // with extra characters must not be
+    for (i = 0, j = 0;  i < count;  i++, j += (int) strlen(names + j) + 1)
+    {
+        const char* name = names + j;
+        char truncated[256], extended[256];
+
+        snprintf(truncated, sizeof(truncated), "%.*s", (int) strlen(name) - 1, name);
+        snprintf(extended, sizeof(extended), "%s_", name);
+
+        if (!glfwExtensionSupported(name) ||
+            (!search_extensions(truncated) && glfwExtensionSupported(truncated)) ||
+            glfwExtensionSupported(extended))
+        {
+            fprintf(stderr, "Extension query for %s is wrong\n", name);
+            result = EXIT_FAILURE;
+        }
+    }
+
+    printf("Verified %i extensions of an OpenGL %i.x context\n", count, context_major);
+
+    // Probe half present and half absent extensions, like a renderer looking
+    // for optional features
+    for (i = 0, j = 0;  i < PROBE_COUNT;  i++)
+    {
+        absent[i] = calloc(64, 1);
+        snprintf(absent[i], 64, "GL_GLFW_absent_extension_%i", i);
+
+        if (i % 2 == 0 && i / 2 < count)
+        {
+            probes[i] = names + j;
+            j += (int) strlen(names + j) + 1;
+        }
+        else
+            probes[i] = absent[i];
+    }
+
+    int found = 0;
+    double start = glfwGetTime();
+
+    for (i = 0;  i < iterations;  i++)
+    {
+        for (j = 0;  j < PROBE_COUNT;  j++)
+            found += glfwExtensionSupported(probes[j]);
+    }
+
+    const double cached = (glfwGetTime() - start) / iterations;
+
+    start = glfwGetTime();
+
+    for (i = 0;  i < iterations;  i++)
+    {
+        for (j = 0;  j < PROBE_COUNT;  j++)
+            found -= search_extensions(probes[j]);
+    }
+
+    const double searched = (glfwGetTime() - start) / iterations;
+
+    if (found != 0)
+    {
+        fprintf(stderr, "Extension queries disagree with the extension list\n");
+        result = EXIT_FAILURE;
+    }
+
+    printf("Querying %i extensions: %0.3f us with glfwExtensionSupported, "
+           "%0.3f us searching the extension list\n",
+           PROBE_COUNT, cached * 1e6, searched * 1e6);
+
+    for (i = 0;  i < PROBE_COUNT;  i++)
+        free(absent[i]);
+
+    free(names);
+    glfwTerminate();
+    exit(result);
+}
+
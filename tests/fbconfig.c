@@ -0,0 +1,372 @@
+//========================================================================
+// Framebuffer config selection test and benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test generates random sets of framebuffer configs and random hints and
+// checks that every framebuffer config chooser supported by the processor
+// chooses the same config as the original one config at a time selection,
+// which is included here
+//
+// It then measures how long each takes to choose from large config sets
+//
+// The framebuffer config module is built into this test, as it is internal to
+// GLFW
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "getopt.h"
+#include "fbconfig.h"
+
+static unsigned int seed = 0x12345678;
+
+static void usage(void)
+{
+    printf("Usage: fbconfig [-h] [-n TRIALS] [-i ITERATIONS] [-s SEED]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -n the number of random config sets to check\n");
+    printf("  -i the number of times to choose from each set when benchmarking\n");
+    printf("  -s the seed of the random config sets\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int random_int(int count)
+{
+    seed = seed * 1103515245 + 12345;
+    return (int) ((seed >> 8) % (unsigned int) count);
+}
+
+// Returns one of the specified values, usually one found in real configs
+//
+static int random_value(const int* values, int count)
+{
+    // Occasionally use an unusual value to catch differences in the arithmetic
+    if (random_int(16) == 0)
+        return random_int(65);
+
+    return values[random_int(count)];
+}
+
+static int random_hint(const int* values, int count)
+{
+    if (random_int(4) == 0)
+        return GLFW_DONT_CARE;
+
+    return random_value(values, count);
+}
+
+static void generate_config(_GLFWfbconfig* config, int hint)
+{
+    static const int colors[] = { 0, 4, 5, 6, 8, 10, 16 };
+    static const int alphas[] = { 0, 1, 2, 8, 16 };
+    static const int depths[] = { 0, 16, 24, 32 };
+    static const int stencils[] = { 0, 1, 8 };
+    static const int accums[] = { 0, 8, 16 };
+    static const int auxes[] = { 0, 1, 2, 4 };
+    static const int samples[] = { 0, 2, 4, 8, 16 };
+    int (*generate)(const int*, int) = hint ? random_hint : random_value;
+
+#define GENERATE(values) generate(values, sizeof(values) / sizeof(values[0]))
+
+    config->redBits = GENERATE(colors);
+    config->greenBits = GENERATE(colors);
+    config->blueBits = GENERATE(colors);
+    config->alphaBits = GENERATE(alphas);
+    config->depthBits = GENERATE(depths);
+    config->stencilBits = GENERATE(stencils);
+    config->accumRedBits = GENERATE(accums);
+    config->accumGreenBits = GENERATE(accums);
+    config->accumBlueBits = GENERATE(accums);
+    config->accumAlphaBits = GENERATE(accums);
+    config->auxBuffers = GENERATE(auxes);
+    config->samples = GENERATE(samples);
+
+#undef GENERATE
+
+    config->stereo = random_int(8) == 0;
+    config->sRGB = random_int(2);
+    config->doublebuffer = random_int(2);
+    config->transparent = random_int(4) == 0;
+    config->handle = 0;
+}
+
+// Generates a set of configs, some of them identical to earlier ones to check
+// that the first of several equally good configs is chosen
+//
+static void generate_configs(_GLFWfbconfig* configs, unsigned int count)
+{
+    for (unsigned int i = 0;  i < count;  i++)
+    {
+        if (i > 0 && random_int(8) == 0)
+            configs[i] = configs[random_int((int) i)];
+        else
+            generate_config(configs + i, GLFW_FALSE);
+
+        configs[i].handle = i;
+    }
+}
+
+// Chooses the framebuffer config that best matches the desired one, the way
+// _glfwChooseFBConfig did before it scored configs in blocks
+//
+static const _GLFWfbconfig* choose_fbconfig(const _GLFWfbconfig* desired,
+                                            const _GLFWfbconfig* alternatives,
+                                            unsigned int count)
+{
+    unsigned int i;
+    unsigned int missing, leastMissing = UINT_MAX;
+    unsigned int colorDiff, leastColorDiff = UINT_MAX;
+    unsigned int extraDiff, leastExtraDiff = UINT_MAX;
+    const _GLFWfbconfig* current;
+    const _GLFWfbconfig* closest = NULL;
+
+    for (i = 0;  i < count;  i++)
+    {
+        current = alternatives + i;
+
+        if (desired->stereo > 0 && current->stereo == 0)
+            continue;
+
+        missing = 0;
+
+        if (desired->alphaBits > 0 && current->alphaBits == 0)
+            missing++;
+        if (desired->depthBits > 0 && current->depthBits == 0)
+            missing++;
+        if (desired->stencilBits > 0 && current->stencilBits == 0)
+            missing++;
+        if (desired->auxBuffers > 0 && current->auxBuffers < desired->auxBuffers)
+            missing += desired->auxBuffers - current->auxBuffers;
+        if (desired->samples > 0 && current->samples == 0)
+            missing++;
+        if (desired->transparent != current->transparent)
+            missing++;
+
+#define SQUARE_DIFF(member) \
+    ((desired->member - current->member) * (desired->member - current->member))
+
+        colorDiff = 0;
+
+        if (desired->redBits != GLFW_DONT_CARE)
+            colorDiff += SQUARE_DIFF(redBits);
+        if (desired->greenBits != GLFW_DONT_CARE)
+            colorDiff += SQUARE_DIFF(greenBits);
+        if (desired->blueBits != GLFW_DONT_CARE)
+            colorDiff += SQUARE_DIFF(blueBits);
+
+        extraDiff = 0;
+
+        if (desired->alphaBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(alphaBits);
+        if (desired->depthBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(depthBits);
+        if (desired->stencilBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(stencilBits);
+        if (desired->accumRedBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(accumRedBits);
+        if (desired->accumGreenBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(accumGreenBits);
+        if (desired->accumBlueBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(accumBlueBits);
+        if (desired->accumAlphaBits != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(accumAlphaBits);
+        if (desired->samples != GLFW_DONT_CARE)
+            extraDiff += SQUARE_DIFF(samples);
+        if (desired->sRGB && !current->sRGB)
+            extraDiff++;
+
+#undef SQUARE_DIFF
+
+        if (missing < leastMissing)
+            closest = current;
+        else if (missing == leastMissing)
+        {
+            if ((colorDiff < leastColorDiff) ||
+                (colorDiff == leastColorDiff && extraDiff < leastExtraDiff))
+            {
+                closest = current;
+            }
+        }
+
+        if (current == closest)
+        {
+            leastMissing = missing;
+            leastColorDiff = colorDiff;
+            leastExtraDiff = extraDiff;
+        }
+    }
+
+    return closest;
+}
+
+static void benchmark(const _GLFWfbconfigchooser* choosers,
+                      int chooserCount,
+                      unsigned int count,
+                      int iterations)
+{
+    _GLFWfbconfig* configs = calloc(count, sizeof(_GLFWfbconfig));
+    _GLFWfbconfig desired;
+    uintptr_t expected = 0;
+    int i, j;
+
+    // The volatile pointer keeps the compiler from choosing only once
+    const _GLFWfbconfig* volatile alternatives = configs;
+
+    generate_configs(configs, count);
+    generate_config(&desired, GLFW_TRUE);
+    desired.stereo = GLFW_FALSE;
+
+    double start = glfwGetTime();
+    for (i = 0;  i < iterations;  i++)
+        expected += choose_fbconfig(&desired, alternatives, count)->handle;
+
+    printf("Choosing from %4u configs: %7.3f us original",
+           count, (glfwGetTime() - start) / iterations * 1e6);
+
+    for (j = 0;  j < chooserCount;  j++)
+    {
+        uintptr_t chosen = 0;
+
+        start = glfwGetTime();
+        for (i = 0;  i < iterations;  i++)
+            chosen += choosers[j].choose(&desired, alternatives, count)->handle;
+
+        printf(", %7.3f us %s%s",
+               (glfwGetTime() - start) / iterations * 1e6, choosers[j].name,
+               chosen != expected ? " (different)" : "");
+    }
+
+    printf("\n");
+    free(configs);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, trials = 100000, iterations = 0;
+    int result = EXIT_SUCCESS, mismatches = 0;
+    _GLFWfbconfig* configs = calloc(1000, sizeof(_GLFWfbconfig));
+    const _GLFWfbconfigchooser* choosers;
+
+    while ((ch = getopt(argc, argv, "hn:i:s:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'n':
+                trials = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 's':
+                seed = (unsigned int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    const int chooserCount = _glfwGetFBConfigChoosers(&choosers);
+
+    printf("Using %s, the fastest of %i framebuffer config choosers\n",
+           choosers[chooserCount - 1].name, chooserCount);
+
+    for (int i = 0;  i < trials;  i++)
+    {
+        // Mostly small sets, with enough large ones to span several blocks
+        const unsigned int count =
+            random_int(4) ? (unsigned int) random_int(80) : (unsigned int) random_int(1000);
+        _GLFWfbconfig desired;
+
+        generate_configs(configs, count);
+        generate_config(&desired, GLFW_TRUE);
+
+        const _GLFWfbconfig* expected = choose_fbconfig(&desired, configs, count);
+
+        for (int j = 0;  j < chooserCount;  j++)
+        {
+            const _GLFWfbconfig* actual = choosers[j].choose(&desired, configs, count);
+            if (expected != actual)
+            {
+                if (mismatches++ < 10)
+                {
+                    fprintf(stderr, "Trial %i with %u configs chose %i instead of %i with %s\n",
+                            i, count,
+                            actual ? (int) actual->handle : -1,
+                            expected ? (int) expected->handle : -1,
+                            choosers[j].name);
+                }
+
+                result = EXIT_FAILURE;
+            }
+        }
+
+        if (_glfwChooseFBConfig(&desired, configs, count) != expected)
+            result = EXIT_FAILURE;
+    }
+
+    if (result == EXIT_SUCCESS)
+        printf("All %i random config sets chose the same config\n", trials);
+    else
+        fprintf(stderr, "%i choices from %i random config sets were different\n",
+                mismatches, trials);
+
+    if (iterations > 0)
+    {
+        benchmark(choosers, chooserCount, 16, iterations * 64);
+        benchmark(choosers, chooserCount, 100, iterations * 16);
+        benchmark(choosers, chooserCount, 300, iterations * 4);
+        benchmark(choosers, chooserCount, 1000, iterations);
+    }
+
+    free(configs);
+    glfwTerminate();
+    exit(result);
+}
+
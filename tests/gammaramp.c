@@ -0,0 +1,308 @@
+//========================================================================
+// Gamma ramp generation test and benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test sets many gamma exponents on the monitors of the null platform
+// and checks that the resulting gamma ramps are within one step of those
+// calculated with powf, the way glfwSetGamma originally did
+//
+// It then measures how long it takes to animate gamma, both with
+// glfwSetMonitorsGamma and by calculating each ramp and setting it with
+// glfwSetGammaRamp
+//
+// Finally it checks that a gamma transition reaches its target ramp in time
+// and wakes up glfwWaitEvents when done, and that setting a ramp stops it
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#define GLFW_EXPOSE_NATIVE_NULL
+#define GLFW_NATIVE_INCLUDE_NONE
+#include <GLFW/glfw3native.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: gammaramp [-h] [-i ITERATIONS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -i the number of gamma changes to time\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static unsigned short calculate_value(unsigned int index, unsigned int size, float gamma)
+{
+    float value = index / (float) (size - 1);
+    value = powf(value, 1.f / gamma) * 65535.f + 0.5f;
+    value = fminf(value, 65535.f);
+    return (unsigned short) value;
+}
+
+// Sets a gamma ramp the way glfwSetGamma originally did, for comparison
+//
+static void set_gamma(GLFWmonitor* monitor, float gamma)
+{
+    const GLFWgammaramp* current = glfwGetGammaRamp(monitor);
+    unsigned short* values = calloc(current->size, sizeof(unsigned short));
+    GLFWgammaramp ramp;
+
+    for (unsigned int i = 0;  i < current->size;  i++)
+        values[i] = calculate_value(i, current->size, gamma);
+
+    ramp.red = values;
+    ramp.green = values;
+    ramp.blue = values;
+    ramp.size = current->size;
+
+    glfwSetGammaRamp(monitor, &ramp);
+    free(values);
+}
+
+// Fills the specified arrays with a ramp for the specified exponent
+//
+static void fill_ramp(GLFWgammaramp* ramp, unsigned short* values, unsigned int size, float gamma)
+{
+    for (unsigned int i = 0;  i < size;  i++)
+        values[i] = calculate_value(i, size, gamma);
+
+    ramp->red = values;
+    ramp->green = values;
+    ramp->blue = values;
+    ramp->size = size;
+}
+
+// Returns the largest difference between the specified ramp and one calculated
+// with powf, or -1 if the channels differ
+//
+static int compare_ramp(const GLFWgammaramp* ramp, float gamma)
+{
+    int largest = 0;
+
+    for (unsigned int i = 0;  i < ramp->size;  i++)
+    {
+        if (ramp->red[i] != ramp->green[i] || ramp->red[i] != ramp->blue[i])
+            return -1;
+
+        const int difference = abs(ramp->red[i] - calculate_value(i, ramp->size, gamma));
+        if (difference > largest)
+            largest = difference;
+    }
+
+    return largest;
+}
+
+// Returns the largest difference between the current ramp and one calculated
+// with powf, or -1 if the channels differ
+//
+static int check_ramp(GLFWmonitor* monitor, float gamma)
+{
+    return compare_ramp(glfwGetGammaRamp(monitor), gamma);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, iterations = 10000;
+    int result = EXIT_SUCCESS;
+
+    while ((ch = getopt(argc, argv, "hi:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (iterations < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    int count;
+    GLFWmonitor** monitors = glfwGetMonitors(&count);
+    GLFWmonitor* monitor = monitors[0];
+    const GLFWgammaramp* ramp = glfwGetGammaRamp(monitor);
+    int largest = 0, checked = 0;
+
+    if (!ramp)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    // Cover the useful exponents densely and the extreme ones sparsely
+    for (float gamma = 1e-6f;  gamma < 1e6f;  gamma *= (gamma < 0.1f || gamma > 10.f) ? 2.f : 1.001f)
+    {
+        glfwSetGamma(monitor, gamma);
+
+        const int difference = check_ramp(monitor, gamma);
+        if (difference < 0 || difference > 1)
+        {
+            fprintf(stderr, "Gamma %g differs by %i from the calculated ramp\n",
+                    gamma, difference);
+            result = EXIT_FAILURE;
+        }
+
+        if (difference > largest)
+            largest = difference;
+
+        checked++;
+    }
+
+    printf("Checked %i exponents, which were at most %i away from powf\n",
+           checked, largest);
+
+    // The remembered ramp must follow changes and keep its arrays
+    glfwSetGamma(monitor, 2.2f);
+    if (glfwGetGammaRamp(monitor) != ramp || check_ramp(monitor, 2.2f) > 1)
+    {
+        fprintf(stderr, "Gamma ramp was not updated in place\n");
+        result = EXIT_FAILURE;
+    }
+
+    set_gamma(monitor, 1.5f);
+    if (check_ramp(monitor, 1.5f) != 0)
+    {
+        fprintf(stderr, "Gamma ramp does not match the one that was set\n");
+        result = EXIT_FAILURE;
+    }
+
+    glfwSetMonitorsGamma(monitors, count, 0.8f);
+    for (int i = 0;  i < count;  i++)
+    {
+        if (check_ramp(monitors[i], 0.8f) > 1)
+        {
+            fprintf(stderr, "Gamma ramp of monitor %i was not set\n", i);
+            result = EXIT_FAILURE;
+        }
+    }
+
+    // Animate gamma back and forth like a night mode fading in and out
+    double start = glfwGetTime();
+
+    for (int i = 0;  i < iterations;  i++)
+        glfwSetMonitorsGamma(monitors, count, 1.f + (i % 100) / 100.f);
+
+    const double generated = (glfwGetTime() - start) / iterations;
+
+    start = glfwGetTime();
+
+    for (int i = 0;  i < iterations;  i++)
+    {
+        for (int j = 0;  j < count;  j++)
+            set_gamma(monitors[j], 1.f + (i % 100) / 100.f);
+    }
+
+    const double calculated = (glfwGetTime() - start) / iterations;
+
+    printf("Setting gamma on %i monitors with %u entry ramps: %0.3f us with "
+           "glfwSetMonitorsGamma, %0.3f us calculating ramps with powf\n",
+           count, ramp->size, generated * 1e6, calculated * 1e6);
+
+    // Fade to a darker ramp while waiting only for events
+    unsigned short* values = calloc(ramp->size, sizeof(unsigned short));
+    GLFWgammaramp target;
+    const double duration = 0.25;
+
+    fill_ramp(&target, values, ramp->size, 0.5f);
+    glfwSetGamma(monitor, 1.f);
+
+    start = glfwGetTime();
+    glfwStartGammaTransition(monitor, &target, duration);
+
+    if (!glfwGammaTransitionActive(monitor) || check_ramp(monitor, 0.5f) != 0)
+    {
+        fprintf(stderr, "Gamma transition did not report its target ramp\n");
+        result = EXIT_FAILURE;
+    }
+
+    while (glfwGammaTransitionActive(monitor) && glfwGetTime() - start < 5.0)
+        glfwWaitEventsTimeout(5.0);
+
+    const double elapsed = glfwGetTime() - start;
+
+    if (glfwGammaTransitionActive(monitor) || elapsed < duration || elapsed > duration + 0.5)
+    {
+        fprintf(stderr, "Gamma transition of %0.3f s took %0.3f s\n", duration, elapsed);
+        result = EXIT_FAILURE;
+    }
+    else
+        printf("Gamma transition of %0.3f s completed after %0.3f s\n", duration, elapsed);
+
+    // The ramp held by the platform must have reached the target, not just the
+    // ramp remembered by GLFW
+    const GLFWgammaramp* platform = glfwGetNullGammaRamp(monitor);
+    if (!platform || compare_ramp(platform, 0.5f) != 0)
+    {
+        fprintf(stderr, "Gamma transition did not reach its target ramp\n");
+        result = EXIT_FAILURE;
+    }
+
+    // Setting a ramp stops a transition in progress
+    fill_ramp(&target, values, ramp->size, 2.f);
+    glfwStartGammaTransition(monitor, &target, 10.0);
+    glfwSetGamma(monitor, 1.f);
+
+    if (glfwGammaTransitionActive(monitor) || check_ramp(monitor, 1.f) > 1)
+    {
+        fprintf(stderr, "Setting gamma did not stop the gamma transition\n");
+        result = EXIT_FAILURE;
+    }
+
+    // A transition still in progress is stopped by termination
+    glfwStartGammaTransition(monitor, &target, 10.0);
+
+    free(values);
+
+    glfwTerminate();
+    exit(result);
+}
+
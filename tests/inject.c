@@ -0,0 +1,506 @@
+//========================================================================
+// Null platform input injection benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test injects a synthetic stream of input events into the null platform
+// and measures how many events per second are delivered to the callbacks
+// It can also record the events and measure the size and replay speed of the
+// recording
+//
+// It then checks that events batched between two event processing calls are
+// returned by the second one, and only once, that events for windows that do
+// not exist are rejected and that a virtual gamepad can be connected, read and
+// disconnected
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#define GLFW_EXPOSE_NATIVE_NULL
+#define GLFW_NATIVE_INCLUDE_NONE
+#include <GLFW/glfw3native.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static int delivered = 0;
+static double cursor_x, cursor_y;
+static int joystick_events[2];
+
+static void usage(void)
+{
+    printf("Usage: inject [-h] [-n EVENTS] [-r RATE] [-o FILE]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -n the number of events to inject\n");
+    printf("  -r replay at the specified events per second instead of full speed\n");
+    printf("  -o record the events to the specified file and replay them\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    delivered++;
+}
+
+static void char_callback(GLFWwindow* window, unsigned int codepoint)
+{
+    delivered++;
+}
+
+static void mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
+{
+    delivered++;
+}
+
+static void cursor_position_callback(GLFWwindow* window, double x, double y)
+{
+    delivered++;
+    cursor_x = x;
+    cursor_y = y;
+}
+
+static void scroll_callback(GLFWwindow* window, double x, double y)
+{
+    delivered++;
+}
+
+static void joystick_callback(int jid, int event)
+{
+    joystick_events[event == GLFW_CONNECTED ? 0 : 1]++;
+}
+
+// Generates a stream of mostly cursor motion with regular key, text, mouse
+// button and scroll input, each event producing exactly one callback
+//
+static void generate_events(GLFWwindow* window, GLFWevent* events, int count, double rate)
+{
+    for (int i = 0;  i < count;  i++)
+    {
+        GLFWevent* event = events + i;
+        const int phase = i % 16;
+
+        event->window = window;
+        event->time = rate > 0.0 ? i / rate : 0.0;
+
+        if (phase == 10 || phase == 12)
+        {
+            event->type = GLFW_EVENT_KEY;
+            event->data.key.key = GLFW_KEY_A + (i / 16) % 26;
+            event->data.key.scancode = 0;
+            event->data.key.action = phase == 10 ? GLFW_PRESS : GLFW_RELEASE;
+            event->data.key.mods = 0;
+        }
+        else if (phase == 11)
+        {
+            event->type = GLFW_EVENT_CHAR;
+            event->data.character.codepoint = 'a' + (i / 16) % 26;
+            event->data.character.mods = 0;
+        }
+        else if (phase == 13 || phase == 14)
+        {
+            event->type = GLFW_EVENT_MOUSE_BUTTON;
+            event->data.button.button = GLFW_MOUSE_BUTTON_LEFT;
+            event->data.button.action = phase == 13 ? GLFW_PRESS : GLFW_RELEASE;
+            event->data.button.mods = 0;
+        }
+        else if (phase == 15)
+        {
+            event->type = GLFW_EVENT_SCROLL;
+            event->data.scroll.x = 0.0;
+            event->data.scroll.y = 1.0;
+        }
+        else
+        {
+            // Consecutive positions always differ and never match the
+            // initial cursor position, so every motion event is reported
+            event->type = GLFW_EVENT_CURSOR_POS;
+            event->data.cursor.x = (double) (i % 640 + 1);
+            event->data.cursor.y = (double) ((i / 640) % 480);
+        }
+    }
+}
+
+// Returns the number of batched events of the specified type
+//
+static int count_batched(int type)
+{
+    int i, count, found = 0;
+    const GLFWevent* events = glfwGetEventBatch(&count);
+
+    for (i = 0;  i < count;  i++)
+    {
+        if (events[i].type == type)
+            found++;
+    }
+
+    return found;
+}
+
+static int check_batch(GLFWwindow* window)
+{
+    int result = GLFW_TRUE;
+    GLFWevent event = {0};
+
+    glfwSetInputMode(window, GLFW_EVENT_BATCH, GLFW_TRUE);
+    glfwPollEvents();
+
+    // The null platform reports the new size before returning
+    glfwSetWindowSize(window, 320, 240);
+
+    event.type = GLFW_EVENT_KEY;
+    event.window = window;
+    event.data.key.key = GLFW_KEY_B;
+    event.data.key.action = GLFW_PRESS;
+    glfwInjectNullEvents(&event, 1, GLFW_FALSE);
+
+    glfwPollEvents();
+
+    if (count_batched(GLFW_EVENT_WINDOW_SIZE) != 1 || count_batched(GLFW_EVENT_KEY) != 1)
+    {
+        fprintf(stderr, "Events batched between polls were not returned\n");
+        result = GLFW_FALSE;
+    }
+
+    // Events batched outside of event processing and already retrieved must
+    // not be returned again
+    glfwSetWindowSize(window, 640, 480);
+
+    if (count_batched(GLFW_EVENT_WINDOW_SIZE) != 2)
+    {
+        fprintf(stderr, "Events batched after a poll were not retrieved\n");
+        result = GLFW_FALSE;
+    }
+
+    glfwPollEvents();
+
+    if (count_batched(GLFW_EVENT_WINDOW_SIZE) != 0)
+    {
+        fprintf(stderr, "Batched events were returned twice\n");
+        result = GLFW_FALSE;
+    }
+
+    glfwSetInputMode(window, GLFW_EVENT_BATCH, GLFW_FALSE);
+
+    if (result)
+        printf("Events batched between polls were returned once\n");
+
+    return result;
+}
+
+static int check_coalescing(GLFWwindow* window)
+{
+    GLFWevent events[100] = {{0}};
+    const int count = sizeof(events) / sizeof(events[0]);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        events[i].type = GLFW_EVENT_CURSOR_POS;
+        events[i].window = window;
+        events[i].data.cursor.x = (double) (i + 1);
+        events[i].data.cursor.y = (double) (count - i);
+    }
+
+    glfwSetInputMode(window, GLFW_COALESCE_CURSOR_MOTION, GLFW_TRUE);
+    glfwPollEvents();
+
+    delivered = 0;
+
+    glfwInjectNullEvents(events, count, GLFW_FALSE);
+    glfwPollEvents();
+
+    glfwSetInputMode(window, GLFW_COALESCE_CURSOR_MOTION, GLFW_FALSE);
+
+    if (delivered != 1)
+    {
+        fprintf(stderr, "%i cursor motion events were reported as %i\n",
+                count, delivered);
+        return GLFW_FALSE;
+    }
+
+    if (cursor_x != events[count - 1].data.cursor.x ||
+        cursor_y != events[count - 1].data.cursor.y)
+    {
+        fprintf(stderr, "Coalesced cursor motion reported %0.0f,%0.0f\n",
+                cursor_x, cursor_y);
+        return GLFW_FALSE;
+    }
+
+    printf("%i cursor motion events were reported once\n", count);
+    return GLFW_TRUE;
+}
+
+static int check_invalid_window(GLFWwindow* window)
+{
+    GLFWevent events[2] = {{0}};
+
+    events[0].type = GLFW_EVENT_KEY;
+    events[0].window = window;
+    events[0].data.key.key = GLFW_KEY_C;
+    events[0].data.key.action = GLFW_PRESS;
+    events[1] = events[0];
+    events[1].window = (GLFWwindow*) events;
+
+    delivered = 0;
+
+    // The whole array is rejected, including the event for the valid window
+    if (glfwInjectNullEvents(events, 2, GLFW_FALSE))
+    {
+        fprintf(stderr, "Event for a window that does not exist was accepted\n");
+        return GLFW_FALSE;
+    }
+
+    glfwPollEvents();
+
+    if (delivered != 0)
+    {
+        fprintf(stderr, "Rejected events were delivered\n");
+        return GLFW_FALSE;
+    }
+
+    printf("Events for a window that does not exist were rejected\n");
+    return GLFW_TRUE;
+}
+
+static int check_gamepad(void)
+{
+    const char* mapping =
+        "030000006c66000047616d6570616400,Injected Gamepad,"
+        "a:b0,b:b1,leftx:a0,lefty:a1,dpup:h0.1,dpdown:h0.4,";
+    const float axes[2] = { 0.5f, -1.f };
+    const unsigned char buttons[2] = { GLFW_PRESS, GLFW_RELEASE };
+    const unsigned char hats[1] = { GLFW_HAT_UP };
+    GLFWgamepadstate state;
+    int result = GLFW_TRUE;
+
+    glfwSetJoystickCallback(joystick_callback);
+
+    if (!glfwUpdateGamepadMappings(mapping))
+        return GLFW_FALSE;
+
+    const int jid = glfwInjectNullJoystick("Injected Gamepad",
+                                           "030000006c66000047616d6570616400",
+                                           2, 2, 1);
+    if (jid == -1)
+        return GLFW_FALSE;
+
+    if (joystick_events[0] != 1 || !glfwJoystickIsGamepad(jid))
+    {
+        fprintf(stderr, "Virtual gamepad was not connected\n");
+        result = GLFW_FALSE;
+    }
+
+    glfwInjectNullJoystickState(jid, axes, buttons, hats);
+
+    if (!glfwGetGamepadState(jid, &state) ||
+        state.buttons[GLFW_GAMEPAD_BUTTON_A] != GLFW_PRESS ||
+        state.buttons[GLFW_GAMEPAD_BUTTON_B] != GLFW_RELEASE ||
+        state.buttons[GLFW_GAMEPAD_BUTTON_DPAD_UP] != GLFW_PRESS ||
+        state.buttons[GLFW_GAMEPAD_BUTTON_DPAD_DOWN] != GLFW_RELEASE ||
+        state.axes[GLFW_GAMEPAD_AXIS_LEFT_X] != 0.5f ||
+        state.axes[GLFW_GAMEPAD_AXIS_LEFT_Y] != -1.f)
+    {
+        fprintf(stderr, "Virtual gamepad has the wrong state\n");
+        result = GLFW_FALSE;
+    }
+
+    glfwInjectNullJoystickDisconnect(jid);
+
+    if (joystick_events[1] != 1 || glfwJoystickPresent(jid))
+    {
+        fprintf(stderr, "Virtual gamepad was not disconnected\n");
+        result = GLFW_FALSE;
+    }
+
+    glfwSetJoystickCallback(NULL);
+
+    if (result)
+        printf("Virtual gamepad was connected, read and disconnected\n");
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, count = 1000000;
+    int result = EXIT_SUCCESS;
+    double rate = 0.0;
+    const char* path = NULL;
+    GLFWwindow* window;
+    GLFWevent* events;
+
+    while ((ch = getopt(argc, argv, "hn:r:o:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'n':
+                count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 'r':
+                rate = strtod(optarg, NULL);
+                break;
+
+            case 'o':
+                path = optarg;
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 1 || rate < 0.0)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(640, 480, "Input Injection Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetKeyCallback(window, key_callback);
+    glfwSetCharCallback(window, char_callback);
+    glfwSetMouseButtonCallback(window, mouse_button_callback);
+    glfwSetCursorPosCallback(window, cursor_position_callback);
+    glfwSetScrollCallback(window, scroll_callback);
+
+    events = calloc(count, sizeof(GLFWevent));
+    generate_events(window, events, count, rate);
+
+    if (!glfwInjectNullEvents(events, count, rate > 0.0))
+    {
+        free(events);
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    free(events);
+
+    if (path && !glfwStartInputRecording(path))
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    const double start = glfwGetTime();
+    int wakeups = 0;
+
+    while (delivered < count)
+    {
+        if (rate > 0.0)
+            glfwWaitEvents();
+        else
+            glfwPollEvents();
+
+        wakeups++;
+    }
+
+    const double elapsed = glfwGetTime() - start;
+
+    if (path)
+        glfwStopInputRecording();
+
+    printf("Delivered %i events in %0.3f seconds over %i event processing calls\n",
+           delivered, elapsed, wakeups);
+    printf("%0.0f events per second through the callback path\n",
+           delivered / elapsed);
+
+    if (rate > 0.0)
+    {
+        printf("Expected %0.3f seconds at %0.0f events per second\n",
+               (count - 1) / rate, rate);
+    }
+
+    if (path)
+    {
+        FILE* file = fopen(path, "rb");
+        if (file)
+        {
+            fseek(file, 0, SEEK_END);
+            const long size = ftell(file);
+            fclose(file);
+
+            printf("Recorded %li bytes, %0.2f bytes per event\n",
+                   size, (double) size / count);
+        }
+
+        delivered = 0;
+
+        const double replay_start = glfwGetTime();
+
+        if (!glfwReplayInputRecording(path, &window, 1))
+        {
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        const double replay_elapsed = glfwGetTime() - replay_start;
+
+        printf("Replayed %i of %i events in %0.3f seconds\n",
+               delivered, count, replay_elapsed);
+        printf("%0.0f events per second through the replay path\n",
+               delivered / replay_elapsed);
+    }
+
+    if (!check_batch(window))
+        result = EXIT_FAILURE;
+
+    if (!check_coalescing(window))
+        result = EXIT_FAILURE;
+
+    if (!check_invalid_window(window))
+        result = EXIT_FAILURE;
+
+    if (!check_gamepad())
+        result = EXIT_FAILURE;
+
+    glfwTerminate();
+    exit(result);
+}
+
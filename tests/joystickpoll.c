@@ -0,0 +1,263 @@
+//========================================================================
+// Linux joystick polling benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures how long it takes to process events and read the state
+// of several busy Linux joysticks each frame
+//
+// It creates virtual gamepads with uinput, which requires write access to
+// /dev/uinput and read access to the event devices it creates.  Each frame
+// every gamepad reports two axis changes and a button, then the events are
+// processed and the axes and buttons of every gamepad are read, the way a game
+// would.  The state read back is checked against what was sent.
+//
+// This test only builds on Linux and needs the X11 or Wayland platform, as the
+// Null platform does not use the Linux joystick backend
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+#define MAX_PADS 16
+
+static int devices[MAX_PADS];
+static int joysticks[MAX_PADS];
+
+static void usage(void)
+{
+    printf("Usage: joystickpoll [-h] [-p COUNT] [-f COUNT]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -p the number of gamepads to create (default 8)\n");
+    printf("  -f the number of frames to measure (default 1000)\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static int create_device(int index)
+{
+    const int fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+    if (fd < 0)
+    {
+        perror("Failed to open /dev/uinput");
+        return -1;
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_KEY);
+    ioctl(fd, UI_SET_EVBIT, EV_ABS);
+    ioctl(fd, UI_SET_EVBIT, EV_SYN);
+    ioctl(fd, UI_SET_KEYBIT, BTN_SOUTH);
+    ioctl(fd, UI_SET_KEYBIT, BTN_EAST);
+    ioctl(fd, UI_SET_ABSBIT, ABS_X);
+    ioctl(fd, UI_SET_ABSBIT, ABS_Y);
+
+    for (int code = ABS_X;  code <= ABS_Y;  code++)
+    {
+        struct uinput_abs_setup setup = { .code = code };
+        setup.absinfo.minimum = -32768;
+        setup.absinfo.maximum = 32767;
+
+        if (ioctl(fd, UI_ABS_SETUP, &setup) < 0)
+        {
+            perror("Failed to set up gamepad axis");
+            close(fd);
+            return -1;
+        }
+    }
+
+    struct uinput_setup setup = { .id = { BUS_VIRTUAL, 0x6c66, 0x7766, 1 } };
+    snprintf(setup.name, sizeof(setup.name), "GLFW benchmark pad %i", index);
+
+    if (ioctl(fd, UI_DEV_SETUP, &setup) < 0 || ioctl(fd, UI_DEV_CREATE) < 0)
+    {
+        perror("Failed to create gamepad");
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+static int find_joysticks(int count)
+{
+    int found = 0;
+
+    for (int jid = GLFW_JOYSTICK_1;  jid <= GLFW_JOYSTICK_LAST;  jid++)
+    {
+        const char* name = glfwGetJoystickName(jid);
+        int index;
+
+        if (name && sscanf(name, "GLFW benchmark pad %i", &index) == 1 &&
+            index >= 0 && index < count)
+        {
+            joysticks[index] = jid;
+            found++;
+        }
+    }
+
+    return found;
+}
+
+static void send_frame(int fd, int frame)
+{
+    struct input_event events[] =
+    {
+        { .type = EV_ABS, .code = ABS_X, .value = frame % 32768 },
+        { .type = EV_ABS, .code = ABS_Y, .value = -(frame % 32768) },
+        { .type = EV_KEY, .code = BTN_SOUTH, .value = frame & 1 },
+        { .type = EV_SYN, .code = SYN_REPORT }
+    };
+
+    if (write(fd, events, sizeof(events)) != sizeof(events))
+        perror("Failed to send gamepad events");
+}
+
+int main(int argc, char** argv)
+{
+    int ch, count = 8, frames = 1000, result = EXIT_SUCCESS;
+
+    while ((ch = getopt(argc, argv, "hp:f:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'p':
+                count = atoi(optarg);
+                break;
+
+            case 'f':
+                frames = atoi(optarg);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 1 || count > MAX_PADS || frames < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    for (int i = 0;  i < count;  i++)
+    {
+        devices[i] = create_device(i);
+        if (devices[i] < 0)
+        {
+            while (i--)
+                close(devices[i]);
+
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    // udev may need a moment to grant access to the new event devices
+    const double deadline = glfwGetTime() + 5.0;
+
+    while (find_joysticks(count) < count)
+    {
+        if (glfwGetTime() > deadline)
+        {
+            fprintf(stderr, "Only found %i of %i gamepads\n",
+                    find_joysticks(count), count);
+            result = EXIT_FAILURE;
+            break;
+        }
+
+        glfwWaitEventsTimeout(0.1);
+    }
+
+    if (result == EXIT_SUCCESS)
+    {
+        const uint64_t start = glfwGetTimerValue();
+
+        for (int frame = 0;  frame < frames;  frame++)
+        {
+            for (int i = 0;  i < count;  i++)
+                send_frame(devices[i], frame);
+
+            glfwPollEvents();
+
+            for (int i = 0;  i < count;  i++)
+            {
+                int axisCount, buttonCount;
+                const float* axes = glfwGetJoystickAxes(joysticks[i], &axisCount);
+                const unsigned char* buttons =
+                    glfwGetJoystickButtons(joysticks[i], &buttonCount);
+
+                if (!axes || !buttons || axisCount < 1 || buttonCount < 1 ||
+                    buttons[0] != (frame & 1))
+                {
+                    if (result == EXIT_SUCCESS)
+                    {
+                        fprintf(stderr, "Gamepad %i has the wrong state in frame %i\n",
+                                i, frame);
+                    }
+
+                    result = EXIT_FAILURE;
+                }
+            }
+        }
+
+        const double elapsed = (glfwGetTimerValue() - start) /
+                               (double) glfwGetTimerFrequency();
+
+        printf("%i gamepads, %i frames: %0.2f us per frame\n",
+               count, frames, elapsed * 1e6 / frames);
+    }
+
+    glfwTerminate();
+
+    for (int i = 0;  i < count;  i++)
+    {
+        ioctl(devices[i], UI_DEV_DESTROY);
+        close(devices[i]);
+    }
+
+    exit(result);
+}
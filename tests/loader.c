@@ -0,0 +1,260 @@
+//========================================================================
+// Entry point loading test and benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test creates hidden OpenGL contexts on the null platform the way the
+// offscreen example does, with OSMesa by default or with surfaceless EGL, and
+// measures the time from context creation to the first finished draw, for
+// a first context, for contexts sharing objects with it and for unrelated
+// contexts
+//
+// It also checks that glfwGetProcAddresses returns the same addresses as
+// glfwGetProcAddress for every entry point the loader asked for
+//
+//========================================================================
+
+#define GLAD_GL_IMPLEMENTATION
+#include <glad/gl.h>
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+
+static const char** names = NULL;
+static GLFWglproc* procs = NULL;
+static int name_count = 0;
+
+typedef struct Timing
+{
+    double create;
+    double load;
+    double draw;
+} Timing;
+
+static void usage(void)
+{
+    printf("Usage: loader [-h] [-e] [-n CONTEXTS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -e use EGL instead of OSMesa\n");
+    printf("  -n the number of shared and unrelated contexts to create\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+// Remembers every entry point the loader asks for, along with its address
+//
+static GLADapiproc record_proc(void* user, const char* name)
+{
+    names = realloc(names, (name_count + 1) * sizeof(char*));
+    procs = realloc(procs, (name_count + 1) * sizeof(GLFWglproc));
+
+    names[name_count] = name;
+    procs[name_count] = glfwGetProcAddress(name);
+    return procs[name_count++];
+}
+
+static GLADapiproc load_proc(void* user, const char* name)
+{
+    return glfwGetProcAddress(name);
+}
+
+// Creates a hidden window with a context, loads its entry points and draws to
+// it, timing each step
+//
+static GLFWwindow* create_context(GLFWwindow* share, GLADuserptrloadfunc load, Timing* timing)
+{
+    const double start = glfwGetTime();
+    unsigned char pixel[4];
+
+    GLFWwindow* window = glfwCreateWindow(640, 480, "Loader Test", NULL, share);
+    if (!window)
+        return NULL;
+
+    glfwMakeContextCurrent(window);
+
+    const double created = glfwGetTime();
+
+    gladLoadGLUserPtr(load, NULL);
+
+    const double loaded = glfwGetTime();
+
+    glClearColor(0.2f, 0.4f, 0.8f, 1.f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+
+    const double drawn = glfwGetTime();
+
+    timing->create += created - start;
+    timing->load += loaded - created;
+    timing->draw += drawn - loaded;
+    return window;
+}
+
+static void print_timing(const char* label, const Timing* timing, int count)
+{
+    printf("%-22s create %8.3f ms  load %8.3f ms  first draw %8.3f ms\n",
+           label,
+           timing->create / count * 1e3,
+           timing->load / count * 1e3,
+           timing->draw / count * 1e3);
+}
+
+// Checks that bulk retrieval agrees with the addresses recorded during the
+// first load
+//
+static int check_addresses(void)
+{
+    GLFWglproc* bulk = calloc(name_count, sizeof(GLFWglproc));
+    int i, expected = 0, result = GLFW_TRUE;
+
+    for (i = 0;  i < name_count;  i++)
+    {
+        if (procs[i])
+            expected++;
+    }
+
+    if (glfwGetProcAddresses(names, name_count, bulk) != expected)
+    {
+        fprintf(stderr, "glfwGetProcAddresses found the wrong number of entry points\n");
+        result = GLFW_FALSE;
+    }
+
+    for (i = 0;  i < name_count;  i++)
+    {
+        if (bulk[i] != procs[i] || glfwGetProcAddress(names[i]) != procs[i])
+        {
+            fprintf(stderr, "Entry point %s has changed address\n", names[i]);
+            result = GLFW_FALSE;
+        }
+    }
+
+    free(bulk);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, i, count = 16;
+    int api = GLFW_OSMESA_CONTEXT_API;
+    int result = EXIT_SUCCESS;
+    Timing first = {0}, shared = {0}, unrelated = {0};
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "hen:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'e':
+                api = GLFW_EGL_CONTEXT_API;
+                break;
+
+            case 'n':
+                count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, api);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 2);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 0);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    window = create_context(NULL, record_proc, &first);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    if (!check_addresses())
+        result = EXIT_FAILURE;
+
+    printf("Loaded %i entry points\n", name_count);
+
+    for (i = 0;  i < count;  i++)
+    {
+        GLFWwindow* other = create_context(window, load_proc, &shared);
+        if (!other)
+        {
+            result = EXIT_FAILURE;
+            break;
+        }
+
+        if (i == 0 && !check_addresses())
+            result = EXIT_FAILURE;
+
+        glfwDestroyWindow(other);
+    }
+
+    for (i = 0;  i < count;  i++)
+    {
+        GLFWwindow* other = create_context(NULL, load_proc, &unrelated);
+        if (!other)
+        {
+            result = EXIT_FAILURE;
+            break;
+        }
+
+        glfwDestroyWindow(other);
+    }
+
+    print_timing("First context", &first, 1);
+    print_timing("Shared contexts", &shared, count);
+    print_timing("Unrelated contexts", &unrelated, count);
+
+    free(names);
+    free(procs);
+    glfwTerminate();
+    exit(result);
+}
+
@@ -0,0 +1,267 @@
+//========================================================================
+// Gamepad mapping database benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures how long it takes to initialize GLFW, to initialize
+// joystick support and to load a large synthetic mapping database like the
+// community SDL_GameControllerDB with glfwUpdateGamepadMappings
+//
+// It uses the null platform by default so that the results are not affected by
+// the window system or by connected joysticks
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "getopt.h"
+
+static void usage(void)
+{
+    printf("Usage: mappings [-h] [-d] [-m] [-n LINES] [-i ITERATIONS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -d use the default platform instead of the null platform\n");
+    printf("  -m use glfwUpdateGamepadMappingsFromMemory\n");
+    printf("  -n the number of lines in the generated mapping database\n");
+    printf("  -i the number of times to initialize GLFW and load the database\n");
+}
+
+static int fail_allocations = GLFW_FALSE;
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void* allocate(size_t size, void* user)
+{
+    return fail_allocations ? NULL : malloc(size);
+}
+
+static void deallocate(void* block, void* user)
+{
+    free(block);
+}
+
+static void* reallocate(void* block, size_t size, void* user)
+{
+    return fail_allocations ? NULL : realloc(block, size);
+}
+
+// Generates a mapping database where every tenth line updates the mapping of
+// an earlier line, as happens when merging several databases
+//
+static char* generate_mappings(int count)
+{
+    const size_t line_size = 512;
+    char* database = calloc(count, line_size);
+    char* line = database;
+
+    for (int i = 0;  i < count;  i++)
+    {
+        const unsigned int id = (i % 10 == 9) ? (unsigned int) (i / 2) : (unsigned int) i;
+        const unsigned int vendor = 0x045e + (id >> 16);
+        const unsigned int product = id & 0xffff;
+
+        line += snprintf(line, line_size,
+                         "03000000%02x%02x0000%02x%02x000011010000,"
+                         "Benchmark Gamepad %u,"
+                         "a:b0,b:b1,x:b2,y:b3,back:b6,start:b7,guide:b8,"
+                         "leftshoulder:b4,rightshoulder:b5,leftstick:b9,"
+                         "rightstick:b10,dpup:h0.1,dpright:h0.2,dpdown:h0.4,"
+                         "dpleft:h0.8,leftx:a0,lefty:a1,rightx:a3,righty:a4,"
+                         "lefttrigger:a2,righttrigger:a5,\n",
+                         vendor & 0xff, vendor >> 8,
+                         product & 0xff, product >> 8,
+                         id);
+    }
+
+    return database;
+}
+
+// Checks that both update functions report running out of memory and that
+// a later update after memory is available again succeeds
+//
+static int check_out_of_memory(const char* database, size_t size)
+{
+    const GLFWallocator allocator =
+    {
+        .allocate = allocate,
+        .deallocate = deallocate,
+        .reallocate = reallocate
+    };
+    int result = GLFW_TRUE;
+
+    glfwInitAllocator(&allocator);
+
+    if (!glfwInit())
+        return GLFW_FALSE;
+
+    glfwJoystickPresent(GLFW_JOYSTICK_1);
+
+    fail_allocations = GLFW_TRUE;
+
+    if (glfwUpdateGamepadMappings(database) ||
+        glfwGetError(NULL) != GLFW_OUT_OF_MEMORY)
+    {
+        fprintf(stderr, "glfwUpdateGamepadMappings did not report running out of memory\n");
+        result = GLFW_FALSE;
+    }
+
+    if (glfwUpdateGamepadMappingsFromMemory(database, size) ||
+        glfwGetError(NULL) != GLFW_OUT_OF_MEMORY)
+    {
+        fprintf(stderr, "glfwUpdateGamepadMappingsFromMemory did not report running out of memory\n");
+        result = GLFW_FALSE;
+    }
+
+    fail_allocations = GLFW_FALSE;
+
+    if (!glfwUpdateGamepadMappings(database))
+    {
+        fprintf(stderr, "Mappings could not be added after running out of memory\n");
+        result = GLFW_FALSE;
+    }
+
+    glfwTerminate();
+    glfwInitAllocator(NULL);
+
+    if (result)
+        printf("Running out of memory was reported by both update functions\n");
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, count = 5000, iterations = 20, platform = GLFW_PLATFORM_NULL;
+    int memory = GLFW_FALSE;
+
+    while ((ch = getopt(argc, argv, "hdmn:i:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'd':
+                platform = GLFW_ANY_PLATFORM;
+                break;
+
+            case 'm':
+                memory = GLFW_TRUE;
+                break;
+
+            case 'n':
+                count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (count < 1 || iterations < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    char* database = generate_mappings(count);
+    const size_t size = strlen(database);
+    double init_total = 0.0, joystick_total = 0.0, update_total = 0.0;
+
+    glfwInitHint(GLFW_PLATFORM, platform);
+
+    // The timer functions of GLFW are not available before initialization, so
+    // processor time is used throughout
+    for (int i = 0;  i < iterations;  i++)
+    {
+        const clock_t start = clock();
+
+        if (!glfwInit())
+        {
+            free(database);
+            exit(EXIT_FAILURE);
+        }
+
+        const clock_t initialized = clock();
+
+        // Joystick support is initialized on first use
+        glfwJoystickPresent(GLFW_JOYSTICK_1);
+
+        const clock_t joysticks = clock();
+
+        if (memory)
+        {
+            // The repeated GUIDs are reported as a single error
+            glfwUpdateGamepadMappingsFromMemory(database, size);
+        }
+        else if (!glfwUpdateGamepadMappings(database))
+        {
+            free(database);
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+
+        const clock_t updated = clock();
+
+        init_total += (double) (initialized - start) / CLOCKS_PER_SEC;
+        joystick_total += (double) (joysticks - initialized) / CLOCKS_PER_SEC;
+        update_total += (double) (updated - joysticks) / CLOCKS_PER_SEC;
+
+        glfwTerminate();
+    }
+
+    printf("glfwInit: %0.3f ms on average over %i iterations\n",
+           init_total / iterations * 1e3, iterations);
+    printf("Joystick initialization: %0.3f ms on average\n",
+           joystick_total / iterations * 1e3);
+    printf("%s with %i lines: %0.3f ms on average\n",
+           memory ? "glfwUpdateGamepadMappingsFromMemory" : "glfwUpdateGamepadMappings",
+           count, update_total / iterations * 1e3);
+
+    int result = EXIT_SUCCESS;
+
+    if (!check_out_of_memory(database, size))
+        result = EXIT_FAILURE;
+
+    free(database);
+    exit(result);
+}
+
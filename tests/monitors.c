@@ -26,6 +26,11 @@
 // This test prints monitor and video mode information or verifies video
 // modes
 //
+// With -b it instead measures how long monitor enumeration and video mode
+// queries take, which on X11 is mostly spent waiting for RandR replies from
+// the server.  To compare two builds, run each under the same virtual server,
+// for example with xvfb-run -s "-screen 0 1920x1080x24" monitors -b 3
+//
 //========================================================================
 
 #define GLAD_GL_IMPLEMENTATION
@@ -36,18 +41,21 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 
 #include "getopt.h"
 
 enum Mode
 {
     LIST_MODE,
-    TEST_MODE
+    TEST_MODE,
+    BENCHMARK_MODE
 };
 
 static void usage(void)
 {
     printf("Usage: monitors [-t]\n");
+    printf("       monitors -b SECONDS\n");
     printf("       monitors -h\n");
 }
 
@@ -219,12 +227,56 @@ static void test_modes(GLFWmonitor* monitor)
     }
 }
 
+// Measures monitor enumeration by initializing and terminating GLFW for the
+// specified number of seconds, as the timer of GLFW is only available while
+// it is initialized and the time is mostly spent waiting for the server
+//
+static void benchmark_enumeration(int seconds)
+{
+    int count = 0;
+    time_t start = time(NULL);
+
+    // Start at the beginning of a second so that the whole seconds are measured
+    while (time(NULL) == start)
+        ;
+
+    start = time(NULL);
+
+    while (time(NULL) - start < seconds)
+    {
+        if (!glfwInit())
+            exit(EXIT_FAILURE);
+
+        glfwTerminate();
+        count++;
+    }
+
+    printf("glfwInit and glfwTerminate: %0.3f ms on average over %i iterations\n",
+           seconds * 1e3 / count, count);
+}
+
+static void benchmark_modes(GLFWmonitor* monitor, int seconds)
+{
+    int count = 0, modeCount;
+    const double start = glfwGetTime();
+
+    while (glfwGetTime() - start < seconds)
+    {
+        glfwGetVideoModes(monitor, &modeCount);
+        count++;
+    }
+
+    printf("%s: glfwGetVideoModes with %i modes: %0.3f ms on average\n",
+           glfwGetMonitorName(monitor), modeCount,
+           (glfwGetTime() - start) * 1e3 / count);
+}
+
 int main(int argc, char** argv)
 {
-    int ch, i, count, mode = LIST_MODE;
+    int ch, i, count, mode = LIST_MODE, seconds = 0;
     GLFWmonitor** monitors;
 
-    while ((ch = getopt(argc, argv, "th")) != -1)
+    while ((ch = getopt(argc, argv, "tb:h")) != -1)
     {
         switch (ch)
         {
@@ -234,6 +286,10 @@ int main(int argc, char** argv)
             case 't':
                 mode = TEST_MODE;
                 break;
+            case 'b':
+                mode = BENCHMARK_MODE;
+                seconds = (int) strtoul(optarg, NULL, 10);
+                break;
             default:
                 usage();
                 exit(EXIT_FAILURE);
@@ -242,8 +298,17 @@ int main(int argc, char** argv)
 
     glfwSetErrorCallback(error_callback);
 
+    if (mode == BENCHMARK_MODE && seconds < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
     glfwInitHint(GLFW_COCOA_MENUBAR, GLFW_FALSE);
 
+    if (mode == BENCHMARK_MODE)
+        benchmark_enumeration(seconds);
+
     if (!glfwInit())
         exit(EXIT_FAILURE);
 
@@ -255,6 +320,8 @@ int main(int argc, char** argv)
             list_modes(monitors[i]);
         else if (mode == TEST_MODE)
             test_modes(monitors[i]);
+        else if (mode == BENCHMARK_MODE)
+            benchmark_modes(monitors[i], seconds);
     }
 
     glfwTerminate();
@@ -0,0 +1,245 @@
+//========================================================================
+// Pixel conversion test and benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test checks that every pixel conversion kernel supported by the
+// processor produces exactly the same output as the scalar fallback, for
+// image sizes from 16x16 to 1024x1024 and for every combination of color and
+// alpha values, and measures the throughput of each kernel
+//
+// The pixel conversion module is built into this test, as it is internal to
+// GLFW
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+#include "pixel.h"
+
+static void usage(void)
+{
+    printf("Usage: pixels [-h] [-i ITERATIONS]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -i the number of times to convert each image when benchmarking\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+// Fills the pixels so that the first 65536 cover every combination of color
+// and alpha value, followed by pseudo-random pixels
+//
+static void generate_pixels(unsigned char* pixels, size_t count)
+{
+    unsigned int seed = 0x12345678;
+
+    for (size_t i = 0;  i < count;  i++)
+    {
+        if (i < 65536)
+        {
+            pixels[i * 4 + 0] = (unsigned char) (i & 0xff);
+            pixels[i * 4 + 1] = (unsigned char) (255 - (i & 0xff));
+            pixels[i * 4 + 2] = (unsigned char) ((i * 7) & 0xff);
+            pixels[i * 4 + 3] = (unsigned char) (i >> 8);
+        }
+        else
+        {
+            for (int j = 0;  j < 4;  j++)
+            {
+                seed = seed * 1103515245 + 12345;
+                pixels[i * 4 + j] = (unsigned char) (seed >> 16);
+            }
+        }
+    }
+}
+
+static int check_converter(const _GLFWpixelconverter* reference,
+                           const _GLFWpixelconverter* converter,
+                           const unsigned char* pixels,
+                           int width, int height)
+{
+    const size_t count = (size_t) width * height;
+    uint32_t* expected32 = calloc(count, sizeof(uint32_t));
+    uint32_t* actual32 = calloc(count, sizeof(uint32_t));
+    unsigned long* expectedLong = calloc(count, sizeof(unsigned long));
+    unsigned long* actualLong = calloc(count, sizeof(unsigned long));
+    int result = GLFW_TRUE;
+
+    reference->argb32(pixels, expected32, count);
+    converter->argb32(pixels, actual32, count);
+    if (memcmp(expected32, actual32, count * sizeof(uint32_t)) != 0)
+    {
+        fprintf(stderr, "%s ARGB32 conversion of %ix%i differs\n",
+                converter->name, width, height);
+        result = GLFW_FALSE;
+    }
+
+    reference->premultipliedARGB32(pixels, expected32, count);
+    converter->premultipliedARGB32(pixels, actual32, count);
+    if (memcmp(expected32, actual32, count * sizeof(uint32_t)) != 0)
+    {
+        fprintf(stderr, "%s premultiplied ARGB32 conversion of %ix%i differs\n",
+                converter->name, width, height);
+        result = GLFW_FALSE;
+    }
+
+    reference->argbLong(pixels, expectedLong, count);
+    converter->argbLong(pixels, actualLong, count);
+    if (memcmp(expectedLong, actualLong, count * sizeof(unsigned long)) != 0)
+    {
+        fprintf(stderr, "%s ARGB long conversion of %ix%i differs\n",
+                converter->name, width, height);
+        result = GLFW_FALSE;
+    }
+
+    free(expected32);
+    free(actual32);
+    free(expectedLong);
+    free(actualLong);
+    return result;
+}
+
+static void benchmark_converter(const _GLFWpixelconverter* converter,
+                                const unsigned char* pixels,
+                                int size, int iterations)
+{
+    const size_t count = (size_t) size * size;
+    uint32_t* target32 = calloc(count, sizeof(uint32_t));
+    unsigned long* targetLong = calloc(count, sizeof(unsigned long));
+    double elapsed[3];
+    double start;
+
+    start = glfwGetTime();
+    for (int i = 0;  i < iterations;  i++)
+        converter->argb32(pixels, target32, count);
+    elapsed[0] = glfwGetTime() - start;
+
+    start = glfwGetTime();
+    for (int i = 0;  i < iterations;  i++)
+        converter->premultipliedARGB32(pixels, target32, count);
+    elapsed[1] = glfwGetTime() - start;
+
+    start = glfwGetTime();
+    for (int i = 0;  i < iterations;  i++)
+        converter->argbLong(pixels, targetLong, count);
+    elapsed[2] = glfwGetTime() - start;
+
+    printf("%-6s %4ix%-4i  ARGB32 %8.1f  premultiplied %8.1f  long %8.1f Mpixels/s\n",
+           converter->name, size, size,
+           count * iterations / elapsed[0] / 1e6,
+           count * iterations / elapsed[1] / 1e6,
+           count * iterations / elapsed[2] / 1e6);
+
+    free(target32);
+    free(targetLong);
+}
+
+int main(int argc, char** argv)
+{
+    int ch, iterations = 0;
+    int result = EXIT_SUCCESS;
+    const _GLFWpixelconverter* converters;
+
+    // Sizes that are not multiples of the vector widths exercise the tails
+    const int sizes[][2] =
+    {
+        { 16, 16 }, { 32, 32 }, { 48, 48 }, { 64, 64 }, { 128, 128 },
+        { 256, 256 }, { 512, 512 }, { 1024, 1024 }, { 17, 13 }, { 1, 1 }
+    };
+
+    while ((ch = getopt(argc, argv, "hi:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'i':
+                iterations = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    const int count = _glfwGetPixelConverters(&converters);
+    unsigned char* pixels = calloc(1024 * 1024, 4);
+    generate_pixels(pixels, 1024 * 1024);
+
+    printf("Using %s pixel conversion, %i kernel sets supported\n",
+           converters[count - 1].name, count);
+
+    for (int i = 1;  i < count;  i++)
+    {
+        for (size_t j = 0;  j < sizeof(sizes) / sizeof(sizes[0]);  j++)
+        {
+            if (!check_converter(converters, converters + i, pixels,
+                                 sizes[j][0], sizes[j][1]))
+            {
+                result = EXIT_FAILURE;
+            }
+        }
+
+        // Unaligned source and target pointers
+        if (!check_converter(converters, converters + i, pixels + 4, 255, 3))
+            result = EXIT_FAILURE;
+    }
+
+    if (result == EXIT_SUCCESS)
+        printf("All kernels match the scalar conversion\n");
+
+    if (iterations > 0)
+    {
+        for (int i = 0;  i < count;  i++)
+        {
+            benchmark_converter(converters + i, pixels, 16, iterations * 4096);
+            benchmark_converter(converters + i, pixels, 256, iterations * 16);
+            benchmark_converter(converters + i, pixels, 1024, iterations);
+        }
+    }
+
+    free(pixels);
+    glfwTerminate();
+    exit(result);
+}
+
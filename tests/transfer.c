@@ -0,0 +1,231 @@
+//========================================================================
+// Clipboard data transfer benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures how fast large clipboard payloads are transferred
+// between two processes
+//
+// Run one instance with -s to take ownership of the clipboard and serve
+// payloads of 1, 16 and 64 MB, each generated only when first requested, then
+// run a second instance to read them back, verify them and report the
+// throughput of each transfer
+//
+// Run a single instance with -l to serve and read back the payloads within one
+// process, which checks the payload handling on any platform
+//
+//========================================================================
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "getopt.h"
+
+#define PAYLOAD_COUNT 3
+
+static const char* types[PAYLOAD_COUNT] =
+{
+    "application/x-glfw-transfer-1",
+    "application/x-glfw-transfer-16",
+    "application/x-glfw-transfer-64"
+};
+
+static const size_t sizes[PAYLOAD_COUNT] =
+{
+    1 << 20,
+    16 << 20,
+    64 << 20
+};
+
+static unsigned char* payloads[PAYLOAD_COUNT];
+
+static void usage(void)
+{
+    printf("Usage: transfer [-h] [-l|-s]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -l serve and read back the payloads within this process\n");
+    printf("  -s serve the payloads instead of reading them\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static unsigned char pattern(size_t offset, int index)
+{
+    return (unsigned char) ((offset * 31 + offset / 4096 + index) & 0xff);
+}
+
+static const void* data_callback(const char* type, size_t* size)
+{
+    for (int i = 0;  i < PAYLOAD_COUNT;  i++)
+    {
+        if (strcmp(type, types[i]) != 0)
+            continue;
+
+        if (!payloads[i])
+        {
+            payloads[i] = malloc(sizes[i]);
+            if (!payloads[i])
+                return NULL;
+
+            for (size_t j = 0;  j < sizes[i];  j++)
+                payloads[i][j] = pattern(j, i);
+
+            printf("Generated %s\n", type);
+        }
+
+        *size = sizes[i];
+        return payloads[i];
+    }
+
+    return NULL;
+}
+
+static void free_payloads(void)
+{
+    for (int i = 0;  i < PAYLOAD_COUNT;  i++)
+    {
+        free(payloads[i]);
+        payloads[i] = NULL;
+    }
+}
+
+static int serve(GLFWwindow* window)
+{
+    glfwSetClipboardData(types, PAYLOAD_COUNT, data_callback);
+
+    printf("Serving clipboard payloads until the window is closed\n");
+
+    while (!glfwWindowShouldClose(window))
+        glfwWaitEvents();
+
+    return EXIT_SUCCESS;
+}
+
+static int receive(void)
+{
+    int result = EXIT_SUCCESS;
+
+    for (int i = 0;  i < PAYLOAD_COUNT;  i++)
+    {
+        size_t size;
+
+        const double start = glfwGetTime();
+        const unsigned char* data = glfwGetClipboardData(types[i], &size);
+        const double elapsed = glfwGetTime() - start;
+
+        if (!data)
+        {
+            result = EXIT_FAILURE;
+            continue;
+        }
+
+        size_t offset;
+
+        for (offset = 0;  offset < size;  offset++)
+        {
+            if (data[offset] != pattern(offset, i))
+                break;
+        }
+
+        if (size != sizes[i] || offset != size)
+        {
+            fprintf(stderr, "Payload %s is corrupt at byte %zu of %zu\n",
+                    types[i], offset, size);
+            result = EXIT_FAILURE;
+            continue;
+        }
+
+        printf("Received %zu bytes of %s in %0.3f ms, %0.1f MB/s\n",
+               size, types[i], elapsed * 1e3, size / elapsed / (1 << 20));
+    }
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, server = GLFW_FALSE, local = GLFW_FALSE, result;
+    GLFWwindow* window;
+
+    while ((ch = getopt(argc, argv, "hls")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 'l':
+                local = GLFW_TRUE;
+                break;
+
+            case 's':
+                server = GLFW_TRUE;
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    // Some platforms only allow focused windows to access the clipboard
+    glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+
+    window = glfwCreateWindow(200, 200, "Clipboard Transfer Test", NULL, NULL);
+    if (!window)
+    {
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwPollEvents();
+
+    if (server)
+        result = serve(window);
+    else if (local)
+    {
+        glfwSetClipboardData(types, PAYLOAD_COUNT, data_callback);
+        result = receive();
+    }
+    else
+        result = receive();
+
+    glfwTerminate();
+    free_payloads();
+    exit(result);
+}
+
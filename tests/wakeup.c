@@ -0,0 +1,233 @@
+//========================================================================
+// Empty event wakeup benchmark
+// Copyright (c) Camilla Löwy <elmindreda@glfw.org>
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would
+//    be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not
+//    be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source
+//    distribution.
+//
+//========================================================================
+//
+// This test measures how many empty events per second can be posted from
+// a number of threads and how long it takes for glfwWaitEvents to return
+// after an empty event has been posted
+//
+//========================================================================
+
+#include "tinycthread.h"
+
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "getopt.h"
+
+static volatile int finished = 0;
+static volatile int waiting = GLFW_FALSE;
+static volatile double post_time = 0.0;
+static int post_count = 100000;
+static int sample_count = 1000;
+
+static void usage(void)
+{
+    printf("Usage: wakeup [-h] [-t THREADS] [-n POSTS] [-s SAMPLES]\n");
+    printf("Options:\n");
+    printf("  -h show this help\n");
+    printf("  -t the number of posting threads\n");
+    printf("  -n the number of empty events posted by each thread\n");
+    printf("  -s the number of wake-up latency samples\n");
+}
+
+static void error_callback(int error, const char* description)
+{
+    fprintf(stderr, "Error: %s\n", description);
+}
+
+static void sleep_msec(long msec)
+{
+    struct timespec time;
+    time.tv_sec = 0;
+    time.tv_nsec = msec * 1000000;
+    thrd_sleep(&time, NULL);
+}
+
+static int post_thread_main(void* data)
+{
+    mtx_t* lock = data;
+
+    for (int i = 0;  i < post_count;  i++)
+        glfwPostEmptyEvent();
+
+    mtx_lock(lock);
+    finished++;
+    mtx_unlock(lock);
+
+    // Make sure the main thread notices that this thread is done
+    glfwPostEmptyEvent();
+    return 0;
+}
+
+static int latency_thread_main(void* data)
+{
+    for (int i = 0;  i < sample_count;  i++)
+    {
+        while (!waiting)
+            thrd_yield();
+
+        // Give the main thread time to go to sleep in glfwWaitEvents
+        sleep_msec(1);
+
+        waiting = GLFW_FALSE;
+        post_time = glfwGetTime();
+        glfwPostEmptyEvent();
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ch, result, thread_count = 4;
+    thrd_t* threads;
+    thrd_t thread;
+    mtx_t lock;
+
+    while ((ch = getopt(argc, argv, "ht:n:s:")) != -1)
+    {
+        switch (ch)
+        {
+            case 'h':
+                usage();
+                exit(EXIT_SUCCESS);
+
+            case 't':
+                thread_count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 'n':
+                post_count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            case 's':
+                sample_count = (int) strtoul(optarg, NULL, 10);
+                break;
+
+            default:
+                usage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    if (thread_count < 1 || sample_count < 1)
+    {
+        usage();
+        exit(EXIT_FAILURE);
+    }
+
+    glfwSetErrorCallback(error_callback);
+
+    if (!glfwInit())
+        exit(EXIT_FAILURE);
+
+    threads = calloc(thread_count, sizeof(thrd_t));
+    mtx_init(&lock, mtx_plain);
+
+    const double start = glfwGetTime();
+    int wakeups = 0;
+
+    for (int i = 0;  i < thread_count;  i++)
+    {
+        if (thrd_create(threads + i, post_thread_main, &lock) != thrd_success)
+        {
+            fprintf(stderr, "Failed to create posting thread\n");
+
+            glfwTerminate();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    for (;;)
+    {
+        mtx_lock(&lock);
+        const int done = finished;
+        mtx_unlock(&lock);
+
+        if (done == thread_count)
+            break;
+
+        glfwWaitEvents();
+        wakeups++;
+    }
+
+    const double elapsed = glfwGetTime() - start;
+
+    for (int i = 0;  i < thread_count;  i++)
+        thrd_join(threads[i], &result);
+
+    printf("%i threads posted %i empty events in %0.3f seconds\n",
+           thread_count, thread_count * post_count, elapsed);
+    printf("%0.0f posts per second, %i main thread wake-ups\n",
+           thread_count * post_count / elapsed, wakeups);
+
+    // Drain any posts left over from the throughput test
+    glfwPollEvents();
+
+    if (thrd_create(&thread, latency_thread_main, NULL) != thrd_success)
+    {
+        fprintf(stderr, "Failed to create latency thread\n");
+
+        glfwTerminate();
+        exit(EXIT_FAILURE);
+    }
+
+    double min = 1e9, max = 0.0, total = 0.0;
+
+    for (int i = 0;  i < sample_count;  i++)
+    {
+        post_time = 0.0;
+        waiting = GLFW_TRUE;
+
+        do
+        {
+            glfwWaitEvents();
+        }
+        while (post_time == 0.0);
+
+        const double latency = glfwGetTime() - post_time;
+        if (latency < min)
+            min = latency;
+        if (latency > max)
+            max = latency;
+        total += latency;
+    }
+
+    thrd_join(thread, &result);
+
+    printf("glfwWaitEvents wake-up latency over %i samples:\n", sample_count);
+    printf("min %0.1f us, avg %0.1f us, max %0.1f us\n",
+           min * 1e6, total / sample_count * 1e6, max * 1e6);
+
+    mtx_destroy(&lock);
+    free(threads);
+
+    glfwTerminate();
+    exit(EXIT_SUCCESS);
+}
+